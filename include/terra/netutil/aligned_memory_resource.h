@@ -0,0 +1,91 @@
+/*
+ *  aligned_memory_resource.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines the AlignedMemoryResource object.  This is a
+ *      std::pmr::memory_resource that allocates memory with a given alignment
+ *      (e.g., the 64-octet cache line size or the 4096-octet page size) and
+ *      that may back large allocations with huge pages.  It is intended to be
+ *      given to the DataBuffer constructor that accepts a memory resource, in
+ *      which case the buffer (and any buffer allocated when it grows) starts
+ *      on an aligned address, allowing vectorized code to assume aligned
+ *      access, and large buffers incur fewer TLB misses.
+ *
+ *      The allocation behavior is controlled by the AlignedMemoryOptions
+ *      given to the constructor:
+ *
+ *          alignment           The minimum alignment of each allocation.
+ *                              This is rounded up to a power of two no
+ *                              smaller than alignof(std::max_align_t).
+ *
+ *          huge_pages          If true, allocations of at least the huge
+ *                              page threshold are backed by huge pages.
+ *                              Explicitly reserved huge pages (MAP_HUGETLB)
+ *                              are used if available, otherwise the memory is
+ *                              aligned to the huge page size and transparent
+ *                              huge pages are requested via madvise().
+ *
+ *          huge_page_threshold The minimum allocation size for which huge
+ *                              pages are used.
+ *
+ *          prefault            If true, each page of an allocation is
+ *                              touched when allocated so that page faults
+ *                              are not incurred when the memory is first
+ *                              written (e.g., while receiving data).
+ *
+ *      An AlignedMemoryResource holds no state other than its options, so it
+ *      may be shared by any number of threads and DataBuffer objects.  It
+ *      must outlive every DataBuffer that uses it.
+ *
+ *  Portability Issues:
+ *      Huge pages are only supported on Linux; elsewhere, the huge_pages
+ *      option is ignored.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace Terra::NetUtil
+{
+
+// Options controlling how an AlignedMemoryResource allocates memory
+struct AlignedMemoryOptions
+{
+    std::size_t alignment = 64;                 // Alignment of allocations
+    bool huge_pages = false;                    // Use huge pages if large
+    std::size_t huge_page_threshold = 2097152;  // Minimum size for huge pages
+    bool prefault = false;                      // Touch pages on allocation
+};
+
+// Define the AlignedMemoryResource object
+class AlignedMemoryResource : public std::pmr::memory_resource
+{
+    public:
+        explicit AlignedMemoryResource(AlignedMemoryOptions options = {});
+        virtual ~AlignedMemoryResource() = default;
+
+        const AlignedMemoryOptions &GetOptions() const { return options; }
+
+    protected:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void *memory,
+                           std::size_t bytes,
+                           std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource &other)
+            const noexcept override;
+
+        bool UseHugePages(std::size_t bytes) const;
+
+        AlignedMemoryOptions options;
+};
+
+} // namespace Terra::NetUtil
@@ -0,0 +1,74 @@
+/*
+ *  base64.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines functions to encode data as base64 text and to decode
+ *      such text into a DataBuffer, per RFC 4648.  Either the standard
+ *      alphabet (using '+' and '/') or the URL and filename safe alphabet
+ *      (using '-' and '_') may be used.
+ *
+ *      Base64Encode() writes the text into a caller-provided character
+ *      buffer, which must be at least Base64EncodedLength() characters in
+ *      length, or returns the text as a string.  When given a DataBuffer, the
+ *      unread portion of the buffer is encoded.  Padding ('=') is appended
+ *      unless disabled, as is common with the URL alphabet.
+ *
+ *      Base64Decode() decodes text with or without padding, either returning
+ *      a new DataBuffer or appending the decoded octets to the given
+ *      DataBuffer, which is grown if necessary and possible.  The octets are
+ *      written directly into the DataBuffer.  An exception is thrown if the
+ *      text contains characters outside of the alphabet (including white
+ *      space) or has an invalid length.
+ *
+ *      Groups of 24 octets are encoded and groups of 32 characters decoded
+ *      using AVX2 instructions on x86 processors that support them (as
+ *      determined at run time) or 48 octets and 64 characters at a time using
+ *      NEON instructions on 64-bit ARM processors, with the remainder
+ *      processed using lookup tables.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include "data_buffer.h"
+
+namespace Terra::NetUtil
+{
+
+// Base64 alphabets defined in RFC 4648
+enum class Base64Alphabet
+{
+    Standard = 0,                               // Uses '+' and '/'
+    URL = 1                                     // Uses '-' and '_'
+};
+
+std::size_t Base64EncodedLength(std::size_t length, bool padding = true);
+std::size_t Base64Encode(std::span<const std::uint8_t> data,
+                         std::span<char> output,
+                         Base64Alphabet alphabet = Base64Alphabet::Standard,
+                         bool padding = true);
+std::string Base64Encode(const DataBuffer &data_buffer,
+                         Base64Alphabet alphabet = Base64Alphabet::Standard,
+                         bool padding = true);
+
+DataBuffer Base64Decode(std::string_view text,
+                        Base64Alphabet alphabet = Base64Alphabet::Standard);
+std::size_t Base64Decode(std::string_view text,
+                         DataBuffer &data_buffer,
+                         Base64Alphabet alphabet = Base64Alphabet::Standard);
+
+} // namespace Terra::NetUtil
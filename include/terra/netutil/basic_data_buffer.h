@@ -0,0 +1,239 @@
+/*
+ *  basic_data_buffer.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines the BasicDataBuffer object.  A BasicDataBuffer is a
+ *      DataBuffer that serializes numeric values in the byte order given as
+ *      the template parameter, rather than in network byte order.  This is
+ *      useful for file formats and protocols that are little endian (e.g.,
+ *      pcap files), which would otherwise require values to be swapped before
+ *      being given to the DataBuffer only to be swapped again by it.  The
+ *      byte order is resolved at compile time, so serializing a value in
+ *      host byte order is a simple copy.
+ *
+ *      LittleEndianDataBuffer is defined as BasicDataBuffer<ByteOrder::Little>.
+ *      BasicDataBuffer<ByteOrder::Big> serializes values exactly as does
+ *      DataBuffer.
+ *
+ *      The SetValue(), GetValue(), AppendValue(), ReadValue(), and PeekValue()
+ *      functions (and their Try counterparts) operate as they do for
+ *      DataBuffer.  The byte order may be overridden for a single value by
+ *      specifying it explicitly, e.g., AppendValue<ByteOrder::Big>(value).
+ *      Likewise, length fields written using BeginLength() and EndLength()
+ *      are in the given byte order by default.  Since the DataBuffer array
+ *      functions and the DataWriter and DataReader cursors serialize values
+ *      in network byte order, they are not available.  One may use
+ *      GetDataBuffer() to access the underlying DataBuffer (e.g., to perform
+ *      I/O), though values serialized through it are in network byte order.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "byte_order.h"
+#include "data_buffer.h"
+
+namespace Terra::NetUtil
+{
+
+// Define the BasicDataBuffer object
+template<ByteOrder Order>
+class BasicDataBuffer : protected DataBuffer
+{
+    public:
+        // Rely on the base class constructors
+        using DataBuffer::DataBuffer;
+
+        virtual ~BasicDataBuffer() = default;
+
+        // Underlying DataBuffer, which serializes in network byte order
+        DataBuffer &GetDataBuffer() { return *this; }
+        const DataBuffer &GetDataBuffer() const { return *this; }
+
+        using DataBuffer::GetBufferPointer;
+        using DataBuffer::GetBufferSpan;
+        using DataBuffer::GetBufferSize;
+        using DataBuffer::SetBuffer;
+
+        using DataBuffer::IsGrowable;
+        using DataBuffer::SetGrowable;
+        using DataBuffer::Reserve;
+        using DataBuffer::Resize;
+
+        using DataBuffer::GetDataLength;
+        using DataBuffer::SetDataLength;
+        using DataBuffer::Empty;
+
+        using DataBuffer::GetReadPosition;
+        using DataBuffer::SetReadPosition;
+        using DataBuffer::AdvanceReadPosition;
+        using DataBuffer::GetUnreadLength;
+
+        using DataBuffer::ReadSpan;
+        using DataBuffer::PeekSpan;
+        using DataBuffer::TryReadSpan;
+
+        using DataBuffer::operator[];
+        using DataBuffer::begin;
+        using DataBuffer::end;
+
+        bool operator==(const BasicDataBuffer &other) const
+        {
+            return DataBuffer::operator==(other);
+        }
+        bool operator!=(const BasicDataBuffer &other) const
+        {
+            return DataBuffer::operator!=(other);
+        }
+
+        // Octet strings are not affected by byte order
+        void SetValue(std::span<const std::uint8_t> value, std::size_t offset)
+        {
+            DataBuffer::SetValue(value, offset);
+        }
+        void SetValue(std::span<const char> value, std::size_t offset)
+        {
+            DataBuffer::SetValue(value, offset);
+        }
+        void GetValue(std::span<std::uint8_t> value, std::size_t offset) const
+        {
+            DataBuffer::GetValue(value, offset);
+        }
+        void GetValue(std::span<char> value, std::size_t offset) const
+        {
+            DataBuffer::GetValue(value, offset);
+        }
+        void AppendValue(std::span<const std::uint8_t> value)
+        {
+            DataBuffer::AppendValue(value);
+        }
+        void AppendValue(std::span<const char> value)
+        {
+            DataBuffer::AppendValue(value);
+        }
+        void ReadValue(std::span<std::uint8_t> value)
+        {
+            DataBuffer::ReadValue(value);
+        }
+        void ReadValue(std::span<char> value)
+        {
+            DataBuffer::ReadValue(value);
+        }
+        DataBufferStatus TryGetValue(std::span<std::uint8_t> value,
+                                     std::size_t offset) const noexcept
+        {
+            return DataBuffer::TryGetValue(value, offset);
+        }
+        DataBufferStatus TryGetValue(std::span<char> value,
+                                     std::size_t offset) const noexcept
+        {
+            return DataBuffer::TryGetValue(value, offset);
+        }
+        DataBufferStatus TryAppendValue(std::span<const std::uint8_t> value)
+        {
+            return DataBuffer::TryAppendValue(value);
+        }
+        DataBufferStatus TryAppendValue(std::span<const char> value)
+        {
+            return DataBuffer::TryAppendValue(value);
+        }
+        DataBufferStatus TryReadValue(std::span<std::uint8_t> value) noexcept
+        {
+            return DataBuffer::TryReadValue(value);
+        }
+        DataBufferStatus TryReadValue(std::span<char> value) noexcept
+        {
+            return DataBuffer::TryReadValue(value);
+        }
+
+        // Numeric values are serialized in the given byte order by default
+        template<ByteOrder ValueOrder = Order, DataBufferValue T>
+        void SetValue(T value, std::size_t offset)
+        {
+            DataBuffer::SetValue<ValueOrder>(value, offset);
+        }
+        template<ByteOrder ValueOrder = Order, DataBufferValue T>
+        void GetValue(T &value, std::size_t offset) const
+        {
+            DataBuffer::GetValue<ValueOrder>(value, offset);
+        }
+        template<ByteOrder ValueOrder = Order, DataBufferValue T>
+        void AppendValue(T value)
+        {
+            DataBuffer::AppendValue<ValueOrder>(value);
+        }
+        template<ByteOrder ValueOrder = Order, DataBufferValue T>
+        void ReadValue(T &value)
+        {
+            DataBuffer::ReadValue<ValueOrder>(value);
+        }
+        template<ByteOrder ValueOrder = Order, DataBufferValue T>
+        DataBufferStatus TryGetValue(T &value,
+                                     std::size_t offset) const noexcept
+        {
+            return DataBuffer::TryGetValue<ValueOrder>(value, offset);
+        }
+        template<ByteOrder ValueOrder = Order, DataBufferValue T>
+        DataBufferStatus TryAppendValue(T value)
+        {
+            return DataBuffer::TryAppendValue<ValueOrder>(value);
+        }
+        template<ByteOrder ValueOrder = Order, DataBufferValue T>
+        DataBufferStatus TryReadValue(T &value) noexcept
+        {
+            return DataBuffer::TryReadValue<ValueOrder>(value);
+        }
+        template<ByteOrder ValueOrder = Order, DataBufferValue T>
+        void PeekValue(T &value) const
+        {
+            DataBuffer::PeekValue<ValueOrder>(value);
+        }
+        template<ByteOrder ValueOrder = Order, DataBufferValue T>
+        DataBufferStatus TryPeekValue(T &value) const noexcept
+        {
+            return DataBuffer::TryPeekValue<ValueOrder>(value);
+        }
+        template<std::unsigned_integral T, ByteOrder ValueOrder = Order>
+            requires DataBufferValue<T>
+        std::size_t BeginLength()
+        {
+            return DataBuffer::BeginLength<T, ValueOrder>();
+        }
+        template<std::unsigned_integral T, ByteOrder ValueOrder = Order>
+            requires DataBufferValue<T>
+        std::size_t EndLength(std::size_t offset)
+        {
+            return DataBuffer::EndLength<T, ValueOrder>(offset);
+        }
+
+        // Streaming operators that call function AppendValue / ReadValue
+        template<typename T>
+        BasicDataBuffer &operator<<(const T &value)
+        {
+            AppendValue(value);
+            return *this;
+        }
+        template<typename T>
+        BasicDataBuffer &operator>>(T &value)
+        {
+            ReadValue(value);
+            return *this;
+        }
+};
+
+// Define a DataBuffer that serializes values in little endian byte order
+using LittleEndianDataBuffer = BasicDataBuffer<ByteOrder::Little>;
+
+} // namespace Terra::NetUtil
@@ -0,0 +1,100 @@
+/*
+ *  buffer_pool.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines the BufferPool object.  A BufferPool maintains
+ *      free lists of memory blocks grouped into size classes so that
+ *      memory used for buffers (e.g., by DataBuffer objects) may be reused
+ *      rather than repeatedly allocated from and returned to the heap.
+ *
+ *      Size classes are powers of two between the minimum and maximum block
+ *      sizes given to the constructor.  A request is satisfied using a block
+ *      from the smallest size class that can hold the requested size.
+ *      Requests larger than the maximum block size are not pooled, but are
+ *      allocated from and returned directly to the heap.
+ *
+ *      Each thread using a BufferPool has its own cache of free blocks for
+ *      each size class, allowing most allocations and releases to proceed
+ *      without locking.  When a thread's cache for a size class is empty, a
+ *      batch of blocks is taken from the pool's shared free list.  Likewise,
+ *      when a thread's cache grows too large, a batch of blocks is returned to
+ *      the shared free list.  When a thread exits, its cached blocks are
+ *      returned to the pool.
+ *
+ *      A block must be released to the same BufferPool from which it was
+ *      allocated and with the same size as was requested.  Any thread may
+ *      release a block, regardless of which thread allocated it.  All
+ *      blocks must be released before the BufferPool is destroyed.
+ *
+ *      Statistics, including the number of requests satisfied with a
+ *      previously used block (hits), the number of requests requiring a
+ *      new allocation (misses), and the number of bytes outstanding, are
+ *      maintained both in total and per size class to help in selecting
+ *      appropriate size class bounds.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Terra::NetUtil
+{
+
+// Statistics for a single BufferPool size class
+struct BufferPoolClassStatistics
+{
+    std::size_t block_size;                     // Size of blocks in this class
+    std::uint64_t hits;                         // Requests using a free block
+    std::uint64_t misses;                       // Requests needing allocation
+    std::size_t blocks_outstanding;             // Blocks not yet released
+};
+
+// Statistics for the BufferPool
+struct BufferPoolStatistics
+{
+    std::uint64_t hits;                         // Requests using a free block
+    std::uint64_t misses;                       // Requests needing allocation
+    std::size_t bytes_outstanding;              // Bytes not yet released
+    std::vector<BufferPoolClassStatistics> size_classes;
+};
+
+// Define the BufferPool object
+class BufferPool
+{
+    public:
+        BufferPool(std::size_t minimum_block_size = 64,
+                   std::size_t maximum_block_size = 65536,
+                   std::size_t thread_cache_blocks = 32);
+        BufferPool(const BufferPool &) = delete;
+        BufferPool(BufferPool &&) = delete;
+        ~BufferPool();
+
+        BufferPool &operator=(const BufferPool &) = delete;
+        BufferPool &operator=(BufferPool &&) = delete;
+
+        std::uint8_t *Allocate(std::size_t size);
+        void Release(std::uint8_t *block, std::size_t size);
+
+        std::size_t GetBlockSize(std::size_t size) const;
+        BufferPoolStatistics GetStatistics() const;
+
+    protected:
+        struct PoolState;
+
+        std::shared_ptr<PoolState> state;
+};
+
+} // namespace Terra::NetUtil
@@ -0,0 +1,100 @@
+/*
+ *  byte_order.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines the ByteOrder type used to specify the order in
+ *      which the octets of numeric values are serialized and the function
+ *      ConvertByteOrder(), which converts a value between host byte order and
+ *      the given byte order.  The conversion is performed at compile time,
+ *      so converting to or from host byte order costs nothing and converting
+ *      to or from the opposite byte order is a single byte swap.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#ifdef _MSC_VER
+#include <cstdlib>
+#endif
+
+namespace Terra::NetUtil
+{
+
+// Order in which the octets of numeric values are serialized
+enum class ByteOrder
+{
+    Big = 0,                                    // Most significant first
+    Little = 1,                                 // Least significant first
+    Network = Big,                              // Network byte order
+    Host = (std::endian::native == std::endian::big) ? Big : Little
+};
+
+/*
+ *  ConvertByteOrder()
+ *
+ *  Description:
+ *      Convert the given value between host byte order and the specified
+ *      byte order.  Since the conversion is symmetric, this function is used
+ *      both for values to be serialized and for values deserialized.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The integer or floating point value to convert.
+ *
+ *  Returns:
+ *      The converted value.
+ *
+ *  Comments:
+ *      None.
+ */
+template<ByteOrder Order, typename T>
+constexpr T ConvertByteOrder(T value) noexcept
+{
+    static_assert((sizeof(T) == 1) || (sizeof(T) == 2) || (sizeof(T) == 4) ||
+                  (sizeof(T) == 8));
+
+    if constexpr ((Order == ByteOrder::Host) || (sizeof(T) == 1))
+    {
+        return value;
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        auto bits = std::bit_cast<std::uint16_t>(value);
+#ifdef _MSC_VER
+        return std::bit_cast<T>(_byteswap_ushort(bits));
+#else
+        return std::bit_cast<T>(__builtin_bswap16(bits));
+#endif
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        auto bits = std::bit_cast<std::uint32_t>(value);
+#ifdef _MSC_VER
+        return std::bit_cast<T>(_byteswap_ulong(bits));
+#else
+        return std::bit_cast<T>(__builtin_bswap32(bits));
+#endif
+    }
+    else
+    {
+        auto bits = std::bit_cast<std::uint64_t>(value);
+#ifdef _MSC_VER
+        return std::bit_cast<T>(_byteswap_uint64(bits));
+#else
+        return std::bit_cast<T>(__builtin_bswap64(bits));
+#endif
+    }
+}
+
+} // namespace Terra::NetUtil
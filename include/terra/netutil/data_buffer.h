@@ -49,6 +49,15 @@
  *                          to the current read position and data length,
  *                          updating the read position on success.
  *
+ *      Each group has a counterpart (SetValues(), GetValues(), AppendValues(),
+ *      and ReadValues()) that operates on an array of 16-, 32-, or 64-bit
+ *      integer or floating point values given as a span.  These check the
+ *      buffer bounds once for the entire array and then convert the values
+ *      using vector instructions where available, which is much faster than
+ *      operating on each value individually.  Likewise, the DataWriter and
+ *      DataReader cursors (see data_cursor.h) check the bounds once for a
+ *      series of values, such as the fields of a fixed-size header.
+ *
  *      Calling GetBufferPointer() returns a pointer into the buffer without
  *      respect to the length of the underlying data (i.e., data length and
  *      read position are ignored), though the offset is checked to ensure a
@@ -57,6 +66,16 @@
  *      Calling GetBufferSpan() returns a span over the DataBuffer with respect
  *      to the current read position and data length.
  *
+ *      For reading a stream (e.g., from a TCP socket), GetFreeSpan() returns
+ *      a span over the free space following the data into which data may be
+ *      received, after which AdvanceDataLength() is called with the number of
+ *      octets received.  Once a message has been parsed, Consume() advances
+ *      the read position past it and, when the octets already read occupy at
+ *      least the given fraction of the buffer, calls Compact() to move the
+ *      unread data to the front of the buffer.  Compact() may also be called
+ *      directly.  This allows a stream to be read without allocating memory
+ *      or copying data other than the occasional move of a partial message.
+ *
  *      Numeric values are written to the DataBuffer in Network Byte Order
  *      (big endian).  Likewise, numeric values in the DataBuffer are read
  *      in Network Byte Order and converted to host byte order.  That is
@@ -75,6 +94,77 @@
  *      if an attempt is made to read or write beyond the actual underlying
  *      buffer.
  *
+ *      A DataBuffer that allocates its own memory may optionally be made
+ *      growable, either via the constructor or by calling SetGrowable().  When
+ *      growable, the AppendValue() functions will reallocate the buffer
+ *      (growing it geometrically and preserving its contents) rather than
+ *      throwing an exception when there is insufficient space.  One may also
+ *      explicitly call Reserve() or Resize() to change the size of an owned
+ *      buffer.  A DataBuffer operating over memory it does not own will never
+ *      grow, though it may be growable once it no longer has such a buffer.
+ *
+ *      Rather than allocating memory from the heap, a DataBuffer may be
+ *      constructed to borrow its memory from a BufferPool.  Memory is returned
+ *      to the pool when the DataBuffer is destroyed or its buffer is replaced.
+ *      A copy of such a DataBuffer will borrow memory from the same pool.
+ *      Likewise, a DataBuffer may be constructed to allocate its memory from
+ *      a std::pmr::memory_resource (e.g., a per-request arena), in which case
+ *      copies will allocate from the same memory resource unless another is
+ *      specified.  The copy assignment operator always allocates memory in
+ *      the manner in which the receiving DataBuffer was constructed.  An
+ *      AlignedMemoryResource (see aligned_memory_resource.h) may be given to
+ *      align the buffer (e.g., to a cache line or page boundary) and to back
+ *      large buffers with huge pages.
+ *
+ *      Copying a DataBuffer copies only the data (i.e., the octets up to the
+ *      data length), though the copy has the same buffer size as the original.
+ *      Any octets beyond the data length (e.g., those written using SetValue()
+ *      or the [] operator) are not copied unless DataBufferCopyMode::Buffer is
+ *      given to the copy constructor or to Assign().  One may instead copy
+ *      only the unread data using DataBufferCopyMode::Unread, in which case the
+ *      copy has a read position of zero.  Clone() returns a copy whose buffer
+ *      is sized to fit just the copied octets, if requested.
+ *
+ *      Each of the GetValue(), AppendValue(), and ReadValue() functions has a
+ *      counterpart (TryGetValue(), TryAppendValue(), and TryReadValue()) that
+ *      returns a DataBufferStatus rather than throwing an exception when
+ *      there is insufficient space or data.  These are intended for parsing
+ *      untrusted input (e.g., datagrams received from the network) where
+ *      truncated input is common and the cost of throwing and catching an
+ *      exception would be significant.  On failure, the value, data length,
+ *      and read position are left unchanged.
+ *
+ *      While numeric values are normally serialized in network byte order,
+ *      the byte order may be given explicitly for any single value, e.g.,
+ *      AppendValue<ByteOrder::Little>(value).  The conversion is resolved at
+ *      compile time, so a value in host byte order is simply copied.  For
+ *      formats that are predominantly little endian, BasicDataBuffer (see
+ *      basic_data_buffer.h) serializes values in a given byte order by
+ *      default.
+ *
+ *      To avoid copying, ReadSpan() returns a span over the given number of
+ *      octets at the read position within the buffer and advances the read
+ *      position past them.  PeekSpan() and PeekValue() return a span or
+ *      value at the read position without advancing it (e.g., to examine a
+ *      message type before deciding how to parse the message).  Spans
+ *      remain valid only until the buffer is grown, compacted, or replaced.
+ *
+ *      To write a length-prefixed structure (e.g., a TLV) in a single pass,
+ *      BeginLength<T>() appends a placeholder for a length field of type T
+ *      and returns its offset.  After the structure's contents are appended,
+ *      EndLength<T>() is called with that offset to set the field to the
+ *      number of octets appended since.  Structures may be nested, so long
+ *      as each EndLength<T>() call is made in the reverse order of the
+ *      BeginLength<T>() calls.  VarIntDataBuffer provides the same for
+ *      variable-width length fields.
+ *
+ *      The most frequently called functions (e.g., accessors and those that
+ *      set, get, append, or read a single value) are defined in
+ *      data_buffer_inline.h.  If the library is built with the netutil_INLINE
+ *      CMake option, NETUTIL_INLINE_DEFINITIONS is defined for users of the
+ *      library and those functions are defined inline so they may be inlined
+ *      into the calling code.  Otherwise, they are compiled into the library.
+ *
  *  Portability Issues:
  *      None.
  */
@@ -87,10 +177,21 @@
 #include <span>
 #include <ostream>
 #include <limits>
+#include <memory_resource>
+#include <concepts>
+#include <cstring>
+#include "byte_order.h"
 
 namespace Terra::NetUtil
 {
 
+// Pool from which DataBuffer memory may be borrowed (see buffer_pool.h)
+class BufferPool;
+
+// Cursors that access the DataBuffer directly (see data_cursor.h)
+class DataWriter;
+class DataReader;
+
 // Define an exception that will be thrown if an attempt is made to access
 // memory outside the underlying memory buffer
 class DataBufferException : public std::runtime_error
@@ -98,23 +199,71 @@ class DataBufferException : public std::runtime_error
     using std::runtime_error::runtime_error;
 };
 
+// Portion of a DataBuffer to copy when copying a DataBuffer
+enum class DataBufferCopyMode
+{
+    Buffer = 0,                                 // Entire underlying buffer
+    Data = 1,                                   // Data up to the data length
+    Unread = 2                                  // Data not yet read
+};
+
+// Result of the TryGetValue(), TryAppendValue(), and TryReadValue() functions
+enum class [[nodiscard]] DataBufferStatus
+{
+    Success = 0,                                // Operation succeeded
+    BeyondBuffer = 1,                           // Exceeds the buffer size
+    BeyondDataLength = 2,                       // Exceeds the data length
+    OutOfRange = 3,                             // Value exceeds target type
+    Malformed = 4                               // Value is malformed
+};
+
+// Numeric types that may be serialized in a specified byte order
+template<typename T>
+concept DataBufferValue =
+    std::same_as<T, std::uint8_t> || std::same_as<T, std::int8_t> ||
+    std::same_as<T, std::uint16_t> || std::same_as<T, std::int16_t> ||
+    std::same_as<T, std::uint32_t> || std::same_as<T, std::int32_t> ||
+    std::same_as<T, std::uint64_t> || std::same_as<T, std::int64_t> ||
+    std::same_as<T, float> || std::same_as<T, double>;
+
 // Define the DataBuffer object
 class DataBuffer
 {
+    friend class DataWriter;
+    friend class DataReader;
+
     public:
         DataBuffer();
-        DataBuffer(std::size_t buffer_size);
+        DataBuffer(std::size_t buffer_size, bool growable = false);
+        DataBuffer(std::size_t buffer_size,
+                   BufferPool &buffer_pool,
+                   bool growable = false);
+        DataBuffer(std::size_t buffer_size,
+                   std::pmr::memory_resource *memory_resource,
+                   bool growable = false);
         DataBuffer(std::span<std::uint8_t> buffer);
         DataBuffer(std::uint8_t *buffer,
                    std::size_t buffer_size,
                    std::size_t data_length = 0);
         DataBuffer(const DataBuffer &other);
+        DataBuffer(const DataBuffer &other,
+                   DataBufferCopyMode copy_mode,
+                   bool shrink_to_fit = false);
+        DataBuffer(const DataBuffer &other,
+                   std::pmr::memory_resource *memory_resource);
         DataBuffer(DataBuffer &&other) noexcept;
         virtual ~DataBuffer();
 
         DataBuffer &operator=(const DataBuffer &other);
         DataBuffer &operator=(DataBuffer &&other) noexcept;
 
+        void Assign(const DataBuffer &other,
+                    DataBufferCopyMode copy_mode,
+                    bool shrink_to_fit = false);
+        DataBuffer Clone(bool shrink_to_fit = true,
+                         DataBufferCopyMode copy_mode =
+                             DataBufferCopyMode::Data) const;
+
         std::uint8_t *GetBufferPointer(std::size_t offset = 0) const;
         std::span<std::uint8_t> GetBufferSpan() const;
         std::size_t GetBufferSize() const;
@@ -123,6 +272,14 @@ class DataBuffer
                        std::size_t new_buffer_size,
                        std::size_t new_data_length = 0);
 
+        BufferPool *GetBufferPool() const;
+        std::pmr::memory_resource *GetMemoryResource() const;
+
+        bool IsGrowable() const;
+        void SetGrowable(bool growable);
+        void Reserve(std::size_t size);
+        void Resize(std::size_t size);
+
         std::size_t GetDataLength() const;
         void SetDataLength(std::size_t length);
         bool Empty() const;
@@ -132,8 +289,13 @@ class DataBuffer
         void AdvanceReadPosition(std::size_t distance);
         std::size_t GetUnreadLength() const;
 
-        bool operator==(const DataBuffer &other);
-        bool operator!=(const DataBuffer &other);
+        void Consume(std::size_t length, double compact_fraction = 0.5);
+        void Compact();
+        std::span<std::uint8_t> GetFreeSpan(std::size_t length = 0);
+        void AdvanceDataLength(std::size_t length);
+
+        bool operator==(const DataBuffer &other) const;
+        bool operator!=(const DataBuffer &other) const;
 
         std::uint8_t &operator[](std::size_t index);
         const std::uint8_t &operator[](std::size_t index) const;
@@ -155,6 +317,23 @@ class DataBuffer
         void SetValue(float value, std::size_t offset);
         void SetValue(double value, std::size_t offset);
 
+        void SetValues(std::span<const std::uint16_t> values,
+                       std::size_t offset);
+        void SetValues(std::span<const std::int16_t> values,
+                       std::size_t offset);
+        void SetValues(std::span<const std::uint32_t> values,
+                       std::size_t offset);
+        void SetValues(std::span<const std::int32_t> values,
+                       std::size_t offset);
+        void SetValues(std::span<const std::uint64_t> values,
+                       std::size_t offset);
+        void SetValues(std::span<const std::int64_t> values,
+                       std::size_t offset);
+        void SetValues(std::span<const float> values,
+                       std::size_t offset);
+        void SetValues(std::span<const double> values,
+                       std::size_t offset);
+
         void GetValue(std::span<std::uint8_t> value, std::size_t offset) const;
         void GetValue(std::span<char> value, std::size_t offset) const;
         void GetValue(std::uint8_t &value, std::size_t offset) const;
@@ -168,6 +347,23 @@ class DataBuffer
         void GetValue(float &value, std::size_t offset) const;
         void GetValue(double &value, std::size_t offset) const;
 
+        void GetValues(std::span<std::uint16_t> values,
+                       std::size_t offset) const;
+        void GetValues(std::span<std::int16_t> values,
+                       std::size_t offset) const;
+        void GetValues(std::span<std::uint32_t> values,
+                       std::size_t offset) const;
+        void GetValues(std::span<std::int32_t> values,
+                       std::size_t offset) const;
+        void GetValues(std::span<std::uint64_t> values,
+                       std::size_t offset) const;
+        void GetValues(std::span<std::int64_t> values,
+                       std::size_t offset) const;
+        void GetValues(std::span<float> values,
+                       std::size_t offset) const;
+        void GetValues(std::span<double> values,
+                       std::size_t offset) const;
+
         void AppendValue(const std::span<const std::uint8_t> value);
         void AppendValue(const std::span<const char> value);
         void AppendValue(std::uint8_t value);
@@ -181,6 +377,15 @@ class DataBuffer
         void AppendValue(float value);
         void AppendValue(double value);
 
+        void AppendValues(std::span<const std::uint16_t> values);
+        void AppendValues(std::span<const std::int16_t> values);
+        void AppendValues(std::span<const std::uint32_t> values);
+        void AppendValues(std::span<const std::int32_t> values);
+        void AppendValues(std::span<const std::uint64_t> values);
+        void AppendValues(std::span<const std::int64_t> values);
+        void AppendValues(std::span<const float> values);
+        void AppendValues(std::span<const double> values);
+
         void ReadValue(std::span<std::uint8_t> value);
         void ReadValue(std::span<char> value);
         void ReadValue(std::uint8_t &value);
@@ -194,6 +399,103 @@ class DataBuffer
         void ReadValue(float &value);
         void ReadValue(double &value);
 
+        void ReadValues(std::span<std::uint16_t> values);
+        void ReadValues(std::span<std::int16_t> values);
+        void ReadValues(std::span<std::uint32_t> values);
+        void ReadValues(std::span<std::int32_t> values);
+        void ReadValues(std::span<std::uint64_t> values);
+        void ReadValues(std::span<std::int64_t> values);
+        void ReadValues(std::span<float> values);
+        void ReadValues(std::span<double> values);
+
+        std::span<std::uint8_t> ReadSpan(std::size_t length);
+        std::span<std::uint8_t> PeekSpan(std::size_t length) const;
+
+        DataBufferStatus TryGetValue(std::span<std::uint8_t> value,
+                                     std::size_t offset) const noexcept;
+        DataBufferStatus TryGetValue(std::span<char> value,
+                                     std::size_t offset) const noexcept;
+        DataBufferStatus TryGetValue(std::uint8_t &value,
+                                     std::size_t offset) const noexcept;
+        DataBufferStatus TryGetValue(std::int8_t &value,
+                                     std::size_t offset) const noexcept;
+        DataBufferStatus TryGetValue(std::uint16_t &value,
+                                     std::size_t offset) const noexcept;
+        DataBufferStatus TryGetValue(std::int16_t &value,
+                                     std::size_t offset) const noexcept;
+        DataBufferStatus TryGetValue(std::uint32_t &value,
+                                     std::size_t offset) const noexcept;
+        DataBufferStatus TryGetValue(std::int32_t &value,
+                                     std::size_t offset) const noexcept;
+        DataBufferStatus TryGetValue(std::uint64_t &value,
+                                     std::size_t offset) const noexcept;
+        DataBufferStatus TryGetValue(std::int64_t &value,
+                                     std::size_t offset) const noexcept;
+        DataBufferStatus TryGetValue(float &value,
+                                     std::size_t offset) const noexcept;
+        DataBufferStatus TryGetValue(double &value,
+                                     std::size_t offset) const noexcept;
+
+        DataBufferStatus TryAppendValue(std::span<const std::uint8_t> value);
+        DataBufferStatus TryAppendValue(std::span<const char> value);
+        DataBufferStatus TryAppendValue(std::uint8_t value);
+        DataBufferStatus TryAppendValue(std::int8_t value);
+        DataBufferStatus TryAppendValue(std::uint16_t value);
+        DataBufferStatus TryAppendValue(std::int16_t value);
+        DataBufferStatus TryAppendValue(std::uint32_t value);
+        DataBufferStatus TryAppendValue(std::int32_t value);
+        DataBufferStatus TryAppendValue(std::uint64_t value);
+        DataBufferStatus TryAppendValue(std::int64_t value);
+        DataBufferStatus TryAppendValue(float value);
+        DataBufferStatus TryAppendValue(double value);
+
+        DataBufferStatus TryReadValue(std::span<std::uint8_t> value) noexcept;
+        DataBufferStatus TryReadValue(std::span<char> value) noexcept;
+        DataBufferStatus TryReadValue(std::uint8_t &value) noexcept;
+        DataBufferStatus TryReadValue(std::int8_t &value) noexcept;
+        DataBufferStatus TryReadValue(std::uint16_t &value) noexcept;
+        DataBufferStatus TryReadValue(std::int16_t &value) noexcept;
+        DataBufferStatus TryReadValue(std::uint32_t &value) noexcept;
+        DataBufferStatus TryReadValue(std::int32_t &value) noexcept;
+        DataBufferStatus TryReadValue(std::uint64_t &value) noexcept;
+        DataBufferStatus TryReadValue(std::int64_t &value) noexcept;
+        DataBufferStatus TryReadValue(float &value) noexcept;
+        DataBufferStatus TryReadValue(double &value) noexcept;
+
+        DataBufferStatus TryReadSpan(std::span<std::uint8_t> &value,
+                                     std::size_t length) noexcept;
+
+        // Functions that serialize values in the specified byte order
+        template<ByteOrder Order, DataBufferValue T>
+        void SetValue(T value, std::size_t offset);
+        template<ByteOrder Order, DataBufferValue T>
+        void GetValue(T &value, std::size_t offset) const;
+        template<ByteOrder Order, DataBufferValue T>
+        void AppendValue(T value);
+        template<ByteOrder Order, DataBufferValue T>
+        void ReadValue(T &value);
+        template<ByteOrder Order, DataBufferValue T>
+        DataBufferStatus TryGetValue(T &value,
+                                     std::size_t offset) const noexcept;
+        template<ByteOrder Order, DataBufferValue T>
+        DataBufferStatus TryAppendValue(T value);
+        template<ByteOrder Order, DataBufferValue T>
+        DataBufferStatus TryReadValue(T &value) noexcept;
+
+        // Functions that read a value without advancing the read position
+        template<ByteOrder Order = ByteOrder::Network, DataBufferValue T>
+        void PeekValue(T &value) const;
+        template<ByteOrder Order = ByteOrder::Network, DataBufferValue T>
+        DataBufferStatus TryPeekValue(T &value) const noexcept;
+
+        // Functions that reserve a length field and later set its value
+        template<std::unsigned_integral T, ByteOrder Order = ByteOrder::Network>
+            requires DataBufferValue<T>
+        std::size_t BeginLength();
+        template<std::unsigned_integral T, ByteOrder Order = ByteOrder::Network>
+            requires DataBufferValue<T>
+        std::size_t EndLength(std::size_t offset);
+
         // Streaming operators that call function AppendValue / ReadValue
         template<typename T>
         DataBuffer &operator<<(const T &value)
@@ -209,10 +511,30 @@ class DataBuffer
         }
 
     protected:
+        std::uint8_t *AcquireMemory(std::size_t size);
+        void ReleaseMemory(std::uint8_t *memory, std::size_t size);
         void AllocateBuffer(std::size_t buffer_size);
         void FreeBuffer();
+        void ReallocateBuffer(std::size_t size);
+        void EnsureAppendSpace(std::size_t length);
+        static bool InBounds(std::size_t offset,
+                             std::size_t length,
+                             std::size_t limit) noexcept
+        {
+            return (offset <= limit) && (length <= (limit - offset));
+        }
+        void GrowBuffer(std::size_t length);
+        template<typename T>
+        void SetArray(std::span<const T> values, std::size_t offset);
+        template<typename T>
+        void GetArray(std::span<T> values, std::size_t offset) const;
 
         bool owns_buffer;                       // Is the buffer owned?
+        bool growable;                          // Grow when appending?
+        BufferPool *buffer_pool;                // Pool providing memory
+        std::pmr::memory_resource *memory_resource; // Resource providing memory
+        std::uint8_t *inline_buffer;            // Inline storage, if any
+        std::size_t inline_buffer_size;         // Size of inline storage
         std::uint8_t *buffer;                   // Pointer to buffer
         std::size_t buffer_size;                // Size of buffer
         std::size_t data_length;                // Length of data in buffer
@@ -222,4 +544,380 @@ class DataBuffer
 // Produce a hex dump of the DataBuffer contents
 std::ostream &operator<<(std::ostream &o, const DataBuffer &data_buffer);
 
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset in the specified byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the value will be inserted.
+ *
+ *  Returns:
+ *      Nothing, though an exception will be thrown if there is an attempt to
+ *      write outside of the buffer.
+ *
+ *  Comments:
+ *      If the specified byte order is the host byte order, the value is
+ *      copied into the buffer without conversion.
+ */
+template<ByteOrder Order, DataBufferValue T>
+void DataBuffer::SetValue(T value, std::size_t offset)
+{
+    // Ensure this operation will not write beyond the buffer
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        throw DataBufferException("Attempt to write beyond the buffer");
+    }
+
+    value = ConvertByteOrder<Order>(value);
+    std::memcpy(buffer + offset, &value, sizeof(value));
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read a value in the specified byte order from the
+ *      buffer at the given offset.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+template<ByteOrder Order, DataBufferValue T>
+void DataBuffer::GetValue(T &value, std::size_t offset) const
+{
+    // Ensure this operation will not read beyond the buffer
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        throw DataBufferException("Attempt to read beyond the buffer");
+    }
+
+    std::memcpy(&value, buffer + offset, sizeof(value));
+    value = ConvertByteOrder<Order>(value);
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value in the specified byte order
+ *      to the end of the existing data in the buffer as determined by the
+ *      data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+template<ByteOrder Order, DataBufferValue T>
+void DataBuffer::AppendValue(T value)
+{
+    EnsureAppendSpace(sizeof(value));
+    SetValue<Order>(value, data_length);
+    data_length += sizeof(value);
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value in the specified byte order from the
+ *      buffer at the current read position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+template<ByteOrder Order, DataBufferValue T>
+void DataBuffer::ReadValue(T &value)
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue<Order>(value, read_position);
+    read_position += sizeof(value);
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value in the specified byte order from the
+ *      buffer at the given offset without throwing an exception if the
+ *      buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+template<ByteOrder Order, DataBufferValue T>
+DataBufferStatus DataBuffer::TryGetValue(T &value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    std::memcpy(&value, buffer + offset, sizeof(value));
+    value = ConvertByteOrder<Order>(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value in the specified byte order
+ *      to the end of the existing data in the buffer without throwing an
+ *      exception if there is insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+template<ByteOrder Order, DataBufferValue T>
+DataBufferStatus DataBuffer::TryAppendValue(T value)
+{
+    EnsureAppendSpace(sizeof(value));
+    if (!InBounds(data_length, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    value = ConvertByteOrder<Order>(value);
+    std::memcpy(buffer + data_length, &value, sizeof(value));
+    data_length += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value in the specified byte order from the
+ *      buffer at the current read position without throwing an exception if
+ *      there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+template<ByteOrder Order, DataBufferValue T>
+DataBufferStatus DataBuffer::TryReadValue(T &value) noexcept
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    std::memcpy(&value, buffer + read_position, sizeof(value));
+    value = ConvertByteOrder<Order>(value);
+    read_position += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::PeekValue()
+ *
+ *  Description:
+ *      This function will read a value in the specified byte order from the
+ *      buffer at the current read position without advancing the read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      The byte order defaults to network byte order.
+ */
+template<ByteOrder Order, DataBufferValue T>
+void DataBuffer::PeekValue(T &value) const
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue<Order>(value, read_position);
+}
+
+/*
+ *  DataBuffer::TryPeekValue()
+ *
+ *  Description:
+ *      This function will read a value in the specified byte order from the
+ *      buffer at the current read position without advancing the read
+ *      position or throwing an exception if there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      The byte order defaults to network byte order.
+ */
+template<ByteOrder Order, DataBufferValue T>
+DataBufferStatus DataBuffer::TryPeekValue(T &value) const noexcept
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    std::memcpy(&value, buffer + read_position, sizeof(value));
+    value = ConvertByteOrder<Order>(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::BeginLength()
+ *
+ *  Description:
+ *      This function will append a placeholder for a length field of type T
+ *      that is to be set by EndLength() once the data it covers has been
+ *      appended.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The offset of the length field, which is to be given to EndLength().
+ *
+ *  Comments:
+ *      The placeholder is initially zero.
+ */
+template<std::unsigned_integral T, ByteOrder Order>
+    requires DataBufferValue<T>
+std::size_t DataBuffer::BeginLength()
+{
+    const std::size_t offset = data_length;
+
+    AppendValue<Order>(T{0});
+
+    return offset;
+}
+
+/*
+ *  DataBuffer::EndLength()
+ *
+ *  Description:
+ *      This function will set the length field at the given offset to the
+ *      number of octets appended after that field.
+ *
+ *  Parameters:
+ *      offset [in]
+ *          The offset of the length field returned by BeginLength().
+ *
+ *  Returns:
+ *      The length written into the length field.  An exception will be
+ *      thrown if the length field is not within the data or if the length
+ *      exceeds the maximum value of type T.
+ *
+ *  Comments:
+ *      The type T and byte order must be the same as given to BeginLength().
+ */
+template<std::unsigned_integral T, ByteOrder Order>
+    requires DataBufferValue<T>
+std::size_t DataBuffer::EndLength(std::size_t offset)
+{
+    if (!InBounds(offset, sizeof(T), data_length))
+    {
+        throw DataBufferException("Length field is beyond the data length");
+    }
+
+    const std::size_t length = data_length - offset - sizeof(T);
+
+    if (length > std::numeric_limits<T>::max())
+    {
+        throw DataBufferException("Length exceeds the length field maximum");
+    }
+
+    SetValue<Order>(static_cast<T>(length), offset);
+
+    return length;
+}
+
 } // namespace Terra::NetUtil
+
+// Define the most frequently called functions inline if so configured
+#ifdef NETUTIL_INLINE_DEFINITIONS
+#include "data_buffer_inline.h"
+#endif
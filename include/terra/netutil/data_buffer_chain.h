@@ -0,0 +1,142 @@
+/*
+ *  data_buffer_chain.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines the DataBufferChain object.  A DataBufferChain is
+ *      an ordered list of DataBuffer segments that are treated as a single
+ *      logical sequence of octets.  This allows, for example, a header and
+ *      several payloads to be sent together using scatter/gather I/O (e.g.,
+ *      writev() or sendmsg()) without first copying them into a single
+ *      contiguous buffer.
+ *
+ *      Segments are added via AppendBuffer().  A DataBuffer given to
+ *      AppendBuffer() is moved into the chain without copying its contents,
+ *      while a span given to AppendBuffer() is referenced by the chain (the
+ *      caller must ensure the memory outlives the chain).
+ *
+ *      The AppendValue() and ReadValue() functions operate as they do for
+ *      a DataBuffer, except that values may span segment boundaries.  When
+ *      appending and there is no free space in the final segment, a new
+ *      segment is allocated of at least the segment size given to the
+ *      constructor.  Reading consumes data across segments in order.
+ *
+ *      GetIOVec() returns an array of iovec structures covering the unread
+ *      data in each segment, suitable for use with writev() or sendmsg().
+ *      After sending, AdvanceReadPosition() should be called with the number
+ *      of octets sent.  GetFreeIOVec() returns an array of iovec structures
+ *      covering the free space following the data, suitable for use with
+ *      readv() or recvmsg().  After receiving, AdvanceDataLength() should be
+ *      called with the number of octets received.  The returned arrays remain
+ *      valid until the next call to either function or until the chain is
+ *      modified.
+ *
+ *  Portability Issues:
+ *      The iovec-related functions are not available on Windows.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#ifndef _WIN32
+#include <sys/uio.h>
+#endif
+#include "data_buffer.h"
+
+namespace Terra::NetUtil
+{
+
+// Define the DataBufferChain object
+class DataBufferChain
+{
+    public:
+        DataBufferChain(std::size_t segment_size = 4096);
+        ~DataBufferChain() = default;
+
+        void AppendBuffer(DataBuffer &&data_buffer);
+        void AppendBuffer(std::span<std::uint8_t> buffer);
+
+        std::size_t GetSegmentCount() const;
+        DataBuffer &GetSegment(std::size_t index);
+        const DataBuffer &GetSegment(std::size_t index) const;
+        void Clear();
+
+        std::size_t GetDataLength() const;
+        void AdvanceDataLength(std::size_t length);
+        bool Empty() const;
+
+        std::size_t GetUnreadLength() const;
+        void AdvanceReadPosition(std::size_t distance);
+
+#ifndef _WIN32
+        std::span<const iovec> GetIOVec();
+        std::span<const iovec> GetFreeIOVec();
+#endif
+
+        void AppendValue(const std::span<const std::uint8_t> value);
+        void AppendValue(const std::span<const char> value);
+        void AppendValue(std::uint8_t value);
+        void AppendValue(std::int8_t value);
+        void AppendValue(std::uint16_t value);
+        void AppendValue(std::int16_t value);
+        void AppendValue(std::uint32_t value);
+        void AppendValue(std::int32_t value);
+        void AppendValue(std::uint64_t value);
+        void AppendValue(std::int64_t value);
+        void AppendValue(float value);
+        void AppendValue(double value);
+
+        void ReadValue(std::span<std::uint8_t> value);
+        void ReadValue(std::span<char> value);
+        void ReadValue(std::uint8_t &value);
+        void ReadValue(std::int8_t &value);
+        void ReadValue(std::uint16_t &value);
+        void ReadValue(std::int16_t &value);
+        void ReadValue(std::uint32_t &value);
+        void ReadValue(std::int32_t &value);
+        void ReadValue(std::uint64_t &value);
+        void ReadValue(std::int64_t &value);
+        void ReadValue(float &value);
+        void ReadValue(double &value);
+
+        // Streaming operators that call function AppendValue / ReadValue
+        template<typename T>
+        DataBufferChain &operator<<(const T &value)
+        {
+            AppendValue(value);
+            return *this;
+        }
+        template<typename T>
+        DataBufferChain &operator>>(T &value)
+        {
+            ReadValue(value);
+            return *this;
+        }
+
+    protected:
+        DataBuffer *GetWriteSegment(std::size_t length);
+        DataBuffer *GetReadSegment();
+        template<typename T>
+        void AppendNumeric(T value);
+        template<typename T>
+        void ReadNumeric(T &value);
+
+        std::size_t segment_size;               // Size of new segments
+        std::vector<DataBuffer> segments;       // Chain of segments
+        std::size_t read_segment;               // Segment being read
+        std::size_t write_segment;              // Segment being written
+#ifndef _WIN32
+        std::vector<iovec> io_vector;           // Last iovec array produced
+#endif
+};
+
+} // namespace Terra::NetUtil
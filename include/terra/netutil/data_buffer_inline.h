@@ -0,0 +1,3250 @@
+/*
+ *  data_buffer_inline.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines the DataBuffer functions that are called most often,
+ *      such as the accessors and the functions that set, get, append, or read
+ *      individual values.  These functions are small enough that the cost of
+ *      calling them is significant relative to the work they perform.
+ *
+ *      When NETUTIL_INLINE_DEFINITIONS is defined (see the netutil_INLINE
+ *      CMake option), this file is included by data_buffer.h and the
+ *      functions are defined inline so the compiler may inline them into the
+ *      calling code.  Otherwise, this file is included only by
+ *      data_buffer.cpp and the functions are compiled into the library.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <terra/bitutil/byte_order.h>
+#include "data_buffer.h"
+
+#ifdef NETUTIL_INLINE_DEFINITIONS
+#define NETUTIL_INLINE inline
+#else
+#define NETUTIL_INLINE
+#endif
+
+namespace Terra::NetUtil
+{
+
+/*
+ *  DataBuffer::EnsureAppendSpace()
+ *
+ *  Description:
+ *      Ensure that there is space to append the given number of octets
+ *      following the existing data if this DataBuffer is growable.
+ *
+ *  Parameters:
+ *      length [in]
+ *          The number of octets that are about to be appended.
+ *
+ *  Returns:
+ *      Nothing.  However, an exception of std::bad_alloc may be thrown if
+ *      memory allocation fails.
+ *
+ *  Comments:
+ *      If the DataBuffer is not growable or if it operates over a buffer it
+ *      does not own, this function does nothing and the subsequent write
+ *      will fail as it would for any fixed-size buffer.
+ */
+NETUTIL_INLINE
+void DataBuffer::EnsureAppendSpace(std::size_t length)
+{
+    // Nothing to do if not growable or if there is already sufficient space
+    if (!growable || ((data_length + length) <= buffer_size)) return;
+
+    GrowBuffer(length);
+}
+
+/*
+ *  DataBuffer::GetBufferPointer()
+ *
+ *  Description:
+ *      Get a pointer to the underlying buffer and specified offset.
+ *
+ *  Parameters:
+ *      offset [in]
+ *          Offset into the buffer between zero and the size of the buffer.
+ *
+ *  Returns:
+ *      A pointer to the underlying buffer + the offset value.  An exception is
+ *      thrown if the requested offset is beyond the size of the underlying
+ *      buffer.  If, however, no buffer is assigned, nullptr is returned,
+ *      regardless of the offset value.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+std::uint8_t *DataBuffer::GetBufferPointer(std::size_t offset) const
+{
+    // If there is no underlying buffer assigned, return nullptr
+    if (buffer == nullptr) return nullptr;
+
+    // Ensure the request is not beyond the buffer length
+    if (offset >= buffer_size)
+    {
+        throw DataBufferException("Invalid buffer pointer requested");
+    }
+
+    return buffer + offset;
+}
+
+/*
+ *  DataBuffer::GetBufferPointer()
+ *
+ *  Description:
+ *      Get a span over the data buffer with respect to both the data length
+ *      and the read position.
+ *
+ *  Parameters:
+ *      offset [in]
+ *          Offset into the buffer between zero and the size of the buffer.
+ *
+ *  Returns:
+ *      A span over the octets in the DataBuffer that take into account the
+ *      data_length and read_position variables.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+std::span<std::uint8_t> DataBuffer::GetBufferSpan() const
+{
+    return {buffer + read_position, data_length - read_position};
+}
+
+/*
+ *  DataBuffer::GetBufferSize()
+ *
+ *  Description:
+ *      Returns the size of the underlying buffer.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The size of the underlying buffer.  If there is no buffer, the value
+ *      returned will be zero.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+std::size_t DataBuffer::GetBufferSize() const
+{
+    return buffer_size;
+}
+
+/*
+ *  DataBuffer::IsGrowable()
+ *
+ *  Description:
+ *      Indicates whether this DataBuffer will grow when appending data
+ *      beyond the size of the buffer.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      True if the DataBuffer is growable, false if not.
+ *
+ *  Comments:
+ *      A growable DataBuffer that operates over memory it does not own will
+ *      not grow.
+ */
+NETUTIL_INLINE
+bool DataBuffer::IsGrowable() const
+{
+    return growable;
+}
+
+/*
+ *  DataBuffer::GetDataLength()
+ *
+ *  Description:
+ *      Get the length of the data stored in the DataBuffer.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The length of the data stored in the DataBuffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+std::size_t DataBuffer::GetDataLength() const
+{
+    return data_length;
+}
+
+/*
+ *  DataBuffer::Empty()
+ *
+ *  Description:
+ *      Check to see if the DataBuffer is emtpy or not.  Specifically, the
+ *      check is for a non-zero data length.  The data length is updated
+ *      either by using the AppendValue() functions, calling SetDataLength(),
+ *      or by using the constructor that accepts a data length as an argument.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      True if the DataBuffer is empty, false if not.  Having a zero
+ *      size data length indicates an empty DataBuffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+bool DataBuffer::Empty() const
+{
+    return (data_length == 0);
+}
+
+/*
+ *  DataBuffer::GetReadPosition()
+ *
+ *  Description:
+ *      Get the current read position in the buffer.  The read position
+ *      is the position from which values will be read when ReadValue()
+ *      functions are called.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The the current read position in the internal data buffer.
+ *
+ *  Comments:
+ *      The current read position will always have a value between 0 and
+ *      the data length.  If the data length is set and the read position
+ *      is beyond that value, it will be changed toe be one less than the
+ *      data length or zero if the data length is zero.
+ */
+NETUTIL_INLINE
+std::size_t DataBuffer::GetReadPosition() const
+{
+    return read_position;
+}
+
+/*
+ *  DataBuffer::SetReadPosition()
+ *
+ *  Description:
+ *      Set the current read position to the specified value.  The value
+ *      cannot be equal to or greater than the data length, except for the
+ *      case where the value is zero.
+ *
+ *  Parameters:
+ *      position [in]
+ *          The new read position value to set.  This must be in the range
+ *          of zero to the data length value.
+ *
+ *  Returns:
+ *      Nothing.  However, an exception will be thrown is an attempt is made
+ *      to set the read position to an invalid position.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetReadPosition(std::size_t position)
+{
+    // Ensure the given value is acceptable
+    if (position > data_length)
+    {
+        throw DataBufferException("Attempt to set data buffer read position "
+                                  "beyond the data length");
+    }
+
+    read_position = position;
+}
+
+/*
+ *  DataBuffer::AdvanceReadPosition()
+ *
+ *  Description:
+ *      Advance the current read position by the specified distance in octets.
+ *
+ *  Parameters:
+ *      distance [in]
+ *          The distance in octets to advance the read position.
+ *
+ *  Returns:
+ *      Nothing.  However, an exception will be thrown is an attempt is made
+ *      to advance the read position beyond the actual data in the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AdvanceReadPosition(std::size_t distance)
+{
+    SetReadPosition(read_position + distance);
+}
+
+/*
+ *  DataBuffer::GetUnreadLength()
+ *
+ *  Description:
+ *      This function will return the number of octets in the DataBuffer that
+ *      have not been read using the ReadValue() functions.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The number of unread octets in the DataBuffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+std::size_t DataBuffer::GetUnreadLength() const
+{
+    return data_length - read_position;
+}
+
+/*
+ *  DataBuffer::operator[]()
+ *
+ *  Description:
+ *      This operator will return a reference to the octet in the buffer
+ *      at the specified offset.  This operates on the buffer irrespective of
+ *      the data length in the buffer.
+ *
+ *  Parameters:
+ *      index [in]
+ *          The buffer index for which an octet reference is requested.
+ *
+ *  Returns:
+ *      A reference to the octet at the given index.  If the index is beyond
+ *      the data buffer size, an exception will be thrown.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+std::uint8_t &DataBuffer::operator[](std::size_t index)
+{
+    if (index >= buffer_size)
+    {
+        throw DataBufferException("Index is beyond the data buffer");
+    }
+
+    return buffer[index];
+}
+
+/*
+ *  DataBuffer::operator[]()
+ *
+ *  Description:
+ *      This operator will return a reference to the octet in the buffer
+ *      at the specified offset.  This operates on the buffer irrespective of
+ *      the data length in the buffer.
+ *
+ *  Parameters:
+ *      index [in]
+ *          The buffer index for which an octet reference is requested.
+ *
+ *  Returns:
+ *      A reference to the octet at the given index.  If the index is beyond
+ *      the data buffer size, an exception will be thrown.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+const std::uint8_t &DataBuffer::operator[](std::size_t index) const
+{
+    if (index >= buffer_size)
+    {
+        throw DataBufferException("Index is beyond the data buffer");
+    }
+
+    return buffer[index];
+}
+
+/*
+ *  DataBuffer::begin()
+ *
+ *  Description:
+ *      This function is used to facilitate passing the DataBuffer object
+ *      to functions that utilize iterators.  This allows the DataBuffer to
+ *      be passed to functions accepting spans or used in range-based for loops.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      An span iterator for the underlying data buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+std::span<std::uint8_t>::iterator DataBuffer::begin() const noexcept
+{
+    return GetBufferSpan().begin();
+}
+
+/*
+ *  DataBuffer::end()
+ *
+ *  Description:
+ *      This function is used to facilitate passing the DataBuffer object
+ *      to functions that utilize iterators.  This allows the DataBuffer to
+ *      be passed to functions accepting spans or used in range-based for loops.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      An span iterator for the underlying data buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+std::span<std::uint8_t>::iterator DataBuffer::end() const noexcept
+{
+    return GetBufferSpan().end();
+}
+
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The span of octets to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the octets will be inserted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetValue(const std::span<const std::uint8_t> value,
+                          std::size_t offset)
+{
+    // If there is nothing to write, just return
+    if (value.empty()) return;
+
+    // Ensure this operation will not write beyond the buffer
+    if ((offset + value.size()) > buffer_size)
+    {
+        throw DataBufferException("Attempt to write beyond the buffer");
+    }
+
+    // Copy the octets from the data buffer into the span
+    std::copy_n(value.data(), value.size(), buffer + offset);
+}
+
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The span of octets to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the octets will be inserted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetValue(const std::span<const char> value, std::size_t offset)
+{
+    // This library assumes a character is 8 bits
+    static_assert(CHAR_BIT == 8);
+
+    SetValue(
+        { reinterpret_cast<const std::uint8_t *>(value.data()), value.size() },
+        offset);
+}
+
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the values will be inserted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetValue(std::uint8_t value, std::size_t offset)
+{
+    // Ensure this operation will not write beyond the buffer
+    if (offset >= buffer_size)
+    {
+        throw DataBufferException("Attempt to write beyond the buffer");
+    }
+
+    // Put the value into the buffer
+    buffer[offset] = value;
+}
+
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the value will be inserted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetValue(std::int8_t value, std::size_t offset)
+{
+    // Ensure this operation will not write beyond the buffer
+    if (offset >= buffer_size)
+    {
+        throw DataBufferException("Attempt to write beyond the buffer");
+    }
+
+    // Put the value into the buffer
+    buffer[offset] = static_cast<std::uint8_t>(value);
+}
+
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the value will be inserted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetValue(std::uint16_t value, std::size_t offset)
+{
+    value = BitUtil::NetworkByteOrder(value);
+
+    SetValue({ reinterpret_cast<const std::uint8_t *>(&value), sizeof(value) },
+             offset);
+}
+
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the value will be inserted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetValue(std::int16_t value, std::size_t offset)
+{
+    SetValue(static_cast<uint16_t>(value), offset);
+}
+
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the value will be inserted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetValue(std::uint32_t value, std::size_t offset)
+{
+    value = BitUtil::NetworkByteOrder(value);
+
+    SetValue({ reinterpret_cast<const std::uint8_t *>(&value), sizeof(value) },
+             offset);
+}
+
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the value will be inserted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetValue(std::int32_t value, std::size_t offset)
+{
+    SetValue(static_cast<std::uint32_t>(value), offset);
+}
+
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the value will be inserted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetValue(std::uint64_t value, std::size_t offset)
+{
+    value = BitUtil::NetworkByteOrder(value);
+    SetValue({ reinterpret_cast<const std::uint8_t *>(&value), sizeof(value) },
+             offset);
+}
+
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the value will be inserted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetValue(std::int64_t value, std::size_t offset)
+{
+    SetValue(static_cast<std::uint64_t>(value), offset);
+}
+
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the value will be inserted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetValue(float value, std::size_t offset)
+{
+    // Ensure the assumption that a float is 32 bits in length
+    static_assert(sizeof(value) == 4, "Float values are not the expected size");
+
+    std::uint32_t binary32{};
+
+    std::copy_n(reinterpret_cast<std::uint8_t *>(&value),
+                sizeof(binary32),
+                reinterpret_cast<std::uint8_t *>(&binary32));
+
+    SetValue(binary32, offset);
+}
+
+/*
+ *  DataBuffer::SetValue()
+ *
+ *  Description:
+ *      This function will place the given value into the buffer at the
+ *      given offset.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to insert into the data buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer at which the value will be inserted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::SetValue(double value, std::size_t offset)
+{
+    // Ensure the assumption that a float is 64 bits in length
+    static_assert(sizeof(value) == 8,
+                  "Double values are not the expected size");
+
+    std::uint64_t binary64{};
+
+    std::copy_n(reinterpret_cast<std::uint8_t *>(&value),
+                sizeof(binary64),
+                reinterpret_cast<std::uint8_t *>(&binary64));
+
+    SetValue(binary64, offset);
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read octets from the buffer at the given offset
+ *      and place them in the span "value".
+ *
+ *  Parameters:
+ *      value [out]
+ *          The span into which octets will be copied out of the data
+ *          buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the octets will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::GetValue(std::span<std::uint8_t> value,
+                          std::size_t offset) const
+{
+    // If there is nothing to read, just return
+    if (value.empty()) return;
+
+    // Ensure this operation will not read beyond the buffer
+    if ((offset + value.size()) > buffer_size)
+    {
+        throw DataBufferException("Attempt to read beyond the buffer");
+    }
+
+    // Copy the octets from the data buffer into the span
+    std::copy_n(buffer + offset, value.size(), value.data());
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read octets from the buffer at the given offset
+ *      and place them in the span referred to by "value".
+ *
+ *  Parameters:
+ *      value [out]
+ *          The span into which octets will be copied out of the data
+ *          buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the octets will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::GetValue(std::span<char> value, std::size_t offset) const
+{
+    // If there is nothing to read, just return
+    if (value.empty()) return;
+
+    // Ensure this operation will not read beyond the buffer
+    if ((offset + value.size()) > buffer_size)
+    {
+        throw DataBufferException("Attempt to read beyond the buffer");
+    }
+
+    // Copy the octets from the data buffer into the span
+    std::copy_n(buffer + offset,
+                value.size(),
+                reinterpret_cast<std::uint8_t *>(value.data()));
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::GetValue(std::uint8_t &value, std::size_t offset) const
+{
+    // Ensure this operation will not read beyond the buffer
+    if (offset >= buffer_size)
+    {
+        throw DataBufferException("Attempt to read beyond the buffer");
+    }
+
+    // Assign the value
+    value = buffer[offset];
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::GetValue(std::int8_t &value, std::size_t offset) const
+{
+    // Ensure this operation will not read beyond the buffer
+    if (offset >= buffer_size)
+    {
+        throw DataBufferException("Attempt to read beyond the buffer");
+    }
+
+    value = static_cast<std::int8_t>(buffer[offset]);
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::GetValue(std::uint16_t &value, std::size_t offset) const
+{
+    GetValue({ reinterpret_cast<std::uint8_t *>(&value), sizeof(value) },
+             offset);
+    value = BitUtil::NetworkByteOrder(value);
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::GetValue(std::int16_t &value, std::size_t offset) const
+{
+    GetValue({ reinterpret_cast<std::uint8_t *>(&value), sizeof(value) },
+             offset);
+    value = static_cast<std::int16_t>(
+        BitUtil::NetworkByteOrder(static_cast<std::uint16_t>(value)));
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::GetValue(std::uint32_t &value, std::size_t offset) const
+{
+    GetValue({ reinterpret_cast<std::uint8_t *>(&value), sizeof(value) },
+             offset);
+    value = BitUtil::NetworkByteOrder(value);
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::GetValue(std::int32_t &value, std::size_t offset) const
+{
+    GetValue({ reinterpret_cast<std::uint8_t *>(&value), sizeof(value) },
+             offset);
+    value = static_cast<std::int32_t>(
+        BitUtil::NetworkByteOrder(static_cast<std::uint32_t>(value)));
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::GetValue(std::uint64_t &value, std::size_t offset) const
+{
+    GetValue({ reinterpret_cast<std::uint8_t *>(&value), sizeof(value) },
+             offset);
+    value = BitUtil::NetworkByteOrder(value);
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::GetValue(std::int64_t &value, std::size_t offset) const
+{
+    GetValue({ reinterpret_cast<std::uint8_t *>(&value), sizeof(value) },
+             offset);
+    value = static_cast<std::int64_t>(
+        BitUtil::NetworkByteOrder(static_cast<std::uint64_t>(value)));
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::GetValue(float &value, std::size_t offset) const
+{
+    std::uint32_t binary32{};
+
+    GetValue(binary32, offset);
+
+    // Copy the octets from the data buffer into the span
+    std::copy_n(reinterpret_cast<std::uint8_t *>(&binary32),
+                sizeof(binary32),
+                reinterpret_cast<std::uint8_t *>(&value));
+}
+
+/*
+ *  DataBuffer::GetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data outside of the buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::GetValue(double &value, std::size_t offset) const
+{
+    std::uint64_t binary64{};
+
+    GetValue(binary64, offset);
+
+    // Copy the octets from the data buffer into the span
+    std::copy_n(reinterpret_cast<std::uint8_t *>(&binary64),
+                sizeof(binary64),
+                reinterpret_cast<std::uint8_t *>(&value));
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given span of octets to the end of the
+ *      existing data in the buffer as determined by the data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The span of octets to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AppendValue(const std::span<const std::uint8_t> value)
+{
+    EnsureAppendSpace(value.size());
+    SetValue(value, data_length);
+    data_length += value.size();
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given span to the end of the
+ *      existing data in the buffer as determined by the data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The span of characters to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AppendValue(const std::span<const char> value)
+{
+    EnsureAppendSpace(value.size());
+    SetValue(value, data_length);
+    data_length += value.size();
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer as determined by the data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AppendValue(std::uint8_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer as determined by the data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AppendValue(std::int8_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer as determined by the data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AppendValue(std::uint16_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer as determined by the data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AppendValue(std::int16_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer as determined by the data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AppendValue(std::uint32_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer as determined by the data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AppendValue(std::int32_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer as determined by the data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AppendValue(std::uint64_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer as determined by the data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AppendValue(std::int64_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer as determined by the data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AppendValue(float value)
+{
+    EnsureAppendSpace(sizeof(value));
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+}
+
+/*
+ *  DataBuffer::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer as determined by the data length value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::AppendValue(double value)
+{
+    EnsureAppendSpace(sizeof(value));
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read octets from the buffer at the current read
+ *      position and place them in the span "value".
+ *
+ *  Parameters:
+ *      value [out]
+ *          The span into which octets will be copied out of the data buffer.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::ReadValue(std::span<std::uint8_t> value)
+{
+    if ((read_position + value.size()) > data_length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue(value, read_position);
+    read_position += value.size();
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read octets from the buffer at the current read
+ *      position and place them in the span "value".
+ *
+ *  Parameters:
+ *      value [out]
+ *          The span into which octets will be copied out of the data buffer.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::ReadValue(std::span<char> value)
+{
+    if ((read_position + value.size()) > data_length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue(value, read_position);
+    read_position += value.size();
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::ReadValue(std::uint8_t &value)
+{
+    if ((read_position + sizeof(value)) > data_length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::ReadValue(std::int8_t &value)
+{
+    if ((read_position + sizeof(value)) > data_length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::ReadValue(std::uint16_t &value)
+{
+    if ((read_position + sizeof(value)) > data_length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::ReadValue(std::int16_t &value)
+{
+    if ((read_position + sizeof(value)) > data_length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::ReadValue(std::uint32_t &value)
+{
+    if ((read_position + sizeof(value)) > data_length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::ReadValue(std::int32_t &value)
+{
+    if ((read_position + sizeof(value)) > data_length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::ReadValue(std::uint64_t &value)
+{
+    if ((read_position + sizeof(value)) > data_length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::ReadValue(std::int64_t &value)
+{
+    if ((read_position + sizeof(value)) > data_length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::ReadValue(float &value)
+{
+    if ((read_position + sizeof(value)) > data_length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+}
+
+/*
+ *  DataBuffer::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+void DataBuffer::ReadValue(double &value)
+{
+    if ((read_position + sizeof(value)) > data_length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a span of octets from the buffer at the given
+ *      offset without throwing an exception if the buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The span of octets to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the span of octets will be
+ *          read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryGetValue(std::span<std::uint8_t> value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, value.size(), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    GetValue(value, offset);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a span of octets from the buffer at the given
+ *      offset without throwing an exception if the buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The span of octets to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the span of octets will be
+ *          read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryGetValue(std::span<char> value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, value.size(), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    GetValue(value, offset);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset
+ *      without throwing an exception if the buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryGetValue(std::uint8_t &value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    GetValue(value, offset);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset
+ *      without throwing an exception if the buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryGetValue(std::int8_t &value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    GetValue(value, offset);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset
+ *      without throwing an exception if the buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryGetValue(std::uint16_t &value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    GetValue(value, offset);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset
+ *      without throwing an exception if the buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryGetValue(std::int16_t &value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    GetValue(value, offset);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset
+ *      without throwing an exception if the buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryGetValue(std::uint32_t &value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    GetValue(value, offset);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset
+ *      without throwing an exception if the buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryGetValue(std::int32_t &value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    GetValue(value, offset);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset
+ *      without throwing an exception if the buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryGetValue(std::uint64_t &value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    GetValue(value, offset);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset
+ *      without throwing an exception if the buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryGetValue(std::int64_t &value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    GetValue(value, offset);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset
+ *      without throwing an exception if the buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryGetValue(float &value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    GetValue(value, offset);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset
+ *      without throwing an exception if the buffer is too short.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondBuffer if doing so would read beyond the buffer,
+ *      in which case the value parameter is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryGetValue(double &value,
+                                         std::size_t offset) const noexcept
+{
+    if (!InBounds(offset, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    GetValue(value, offset);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given span of octets to the end of the
+ *      existing data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The span of octets to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the span of octets was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryAppendValue(std::span<const std::uint8_t> value)
+{
+    EnsureAppendSpace(value.size());
+    if (!InBounds(data_length, value.size(), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    SetValue(value, data_length);
+    data_length += value.size();
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given span of octets to the end of the
+ *      existing data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The span of octets to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the span of octets was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryAppendValue(std::span<const char> value)
+{
+    EnsureAppendSpace(value.size());
+    if (!InBounds(data_length, value.size(), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    SetValue(value, data_length);
+    data_length += value.size();
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryAppendValue(std::uint8_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    if (!InBounds(data_length, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryAppendValue(std::int8_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    if (!InBounds(data_length, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryAppendValue(std::uint16_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    if (!InBounds(data_length, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryAppendValue(std::int16_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    if (!InBounds(data_length, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryAppendValue(std::uint32_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    if (!InBounds(data_length, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryAppendValue(std::int32_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    if (!InBounds(data_length, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryAppendValue(std::uint64_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    if (!InBounds(data_length, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryAppendValue(std::int64_t value)
+{
+    EnsureAppendSpace(sizeof(value));
+    if (!InBounds(data_length, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryAppendValue(float value)
+{
+    EnsureAppendSpace(sizeof(value));
+    if (!InBounds(data_length, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryAppendValue(double value)
+{
+    EnsureAppendSpace(sizeof(value));
+    if (!InBounds(data_length, sizeof(value), buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    SetValue(value, data_length);
+    data_length += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a span of octets from the buffer at the current
+ *      read position without throwing an exception if there is insufficient
+ *      data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The span of octets read from the data buffer at the current read
+ *          position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadValue(
+    std::span<std::uint8_t> value) noexcept
+{
+    if (!InBounds(read_position, value.size(), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    GetValue(value, read_position);
+    read_position += value.size();
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a span of octets from the buffer at the current
+ *      read position without throwing an exception if there is insufficient
+ *      data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The span of octets read from the data buffer at the current read
+ *          position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadValue(std::span<char> value) noexcept
+{
+    if (!InBounds(read_position, value.size(), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    GetValue(value, read_position);
+    read_position += value.size();
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position without throwing an exception if there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadValue(std::uint8_t &value) noexcept
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position without throwing an exception if there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadValue(std::int8_t &value) noexcept
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position without throwing an exception if there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadValue(std::uint16_t &value) noexcept
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position without throwing an exception if there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadValue(std::int16_t &value) noexcept
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position without throwing an exception if there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadValue(std::uint32_t &value) noexcept
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position without throwing an exception if there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadValue(std::int32_t &value) noexcept
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position without throwing an exception if there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadValue(std::uint64_t &value) noexcept
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position without throwing an exception if there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadValue(std::int64_t &value) noexcept
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position without throwing an exception if there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadValue(float &value) noexcept
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position without throwing an exception if there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadValue(double &value) noexcept
+{
+    if (!InBounds(read_position, sizeof(value), data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    GetValue(value, read_position);
+    read_position += sizeof(value);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  DataBuffer::ReadSpan()
+ *
+ *  Description:
+ *      This function will return a span over the given number of octets at
+ *      the current read position and advance the read position past them.
+ *
+ *  Parameters:
+ *      length [in]
+ *          The number of octets to read.
+ *
+ *  Returns:
+ *      A span over the octets within the buffer.  An exception will be thrown
+ *      if there is a request to read beyond the data length.
+ *
+ *  Comments:
+ *      Unlike ReadValue(), the octets are not copied.  The span is
+ *      invalidated if the buffer is grown, compacted, or replaced.
+ */
+NETUTIL_INLINE
+std::span<std::uint8_t> DataBuffer::ReadSpan(std::size_t length)
+{
+    if (!InBounds(read_position, length, data_length))
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    std::span<std::uint8_t> value{buffer + read_position, length};
+    read_position += length;
+
+    return value;
+}
+
+/*
+ *  DataBuffer::PeekSpan()
+ *
+ *  Description:
+ *      This function will return a span over the given number of octets at
+ *      the current read position without advancing the read position.
+ *
+ *  Parameters:
+ *      length [in]
+ *          The number of octets to peek.
+ *
+ *  Returns:
+ *      A span over the octets within the buffer.  An exception will be thrown
+ *      if there is a request to read beyond the data length.
+ *
+ *  Comments:
+ *      The span is invalidated if the buffer is grown, compacted, or
+ *      replaced.
+ */
+NETUTIL_INLINE
+std::span<std::uint8_t> DataBuffer::PeekSpan(std::size_t length) const
+{
+    if (!InBounds(read_position, length, data_length))
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    return {buffer + read_position, length};
+}
+
+/*
+ *  DataBuffer::TryReadSpan()
+ *
+ *  Description:
+ *      This function will return a span over the given number of octets at
+ *      the current read position and advance the read position past them
+ *      without throwing an exception if there is insufficient data.
+ *
+ *  Parameters:
+ *      value [out]
+ *          A span over the octets within the buffer.
+ *
+ *      length [in]
+ *          The number of octets to read.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value parameter was populated or
+ *      DataBufferStatus::BeyondDataLength if doing so would read beyond the
+ *      data length, in which case the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      The span is invalidated if the buffer is grown, compacted, or
+ *      replaced.
+ */
+NETUTIL_INLINE
+DataBufferStatus DataBuffer::TryReadSpan(std::span<std::uint8_t> &value,
+                                         std::size_t length) noexcept
+{
+    if (!InBounds(read_position, length, data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    value = {buffer + read_position, length};
+    read_position += length;
+
+    return DataBufferStatus::Success;
+}
+
+} // namespace Terra::NetUtil
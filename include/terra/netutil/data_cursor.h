@@ -0,0 +1,244 @@
+/*
+ *  data_cursor.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines the DataWriter and DataReader objects.  These are
+ *      cursors used to serialize values to or deserialize values from a
+ *      DataBuffer with the bounds checked once, up front, rather than for
+ *      each value.  This makes writing or parsing fixed-size headers cost only
+ *      a few instructions per field.
+ *
+ *      A cursor is constructed over a DataBuffer and Require() is called with
+ *      the number of octets that will be written or read (or that number is
+ *      given to the constructor).  Require() throws an exception if the
+ *      DataBuffer does not have that many octets available.  For a DataWriter,
+ *      the space available is that following the data (a growable DataBuffer
+ *      will grow as needed), and for a DataReader, it is the unread data.
+ *      Require() may be called again to extend the region as needed.
+ *
+ *      The WriteValue() and ReadValue() functions then write or read values in
+ *      network byte order without any bounds checking.  It is the caller's
+ *      responsibility not to write or read more octets than were required.
+ *      Doing so results in undefined behavior.
+ *
+ *      Values written or read are not reflected in the DataBuffer until
+ *      Commit() is called, which advances the DataBuffer's data length (for
+ *      a DataWriter) or read position (for a DataReader).  If the cursor is
+ *      destroyed without calling Commit(), the DataBuffer's data length or
+ *      read position is left unchanged.  This allows, for example, parsing
+ *      of a message to be abandoned upon encountering an error.
+ *
+ *      The DataBuffer must not be otherwise modified while a cursor is in
+ *      use, as the cursor refers directly to the underlying buffer.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#pragma once
+
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include "byte_order.h"
+#include "data_buffer.h"
+
+namespace Terra::NetUtil
+{
+
+// Define the DataCursor object, which is the base for cursor types
+class DataCursor
+{
+    public:
+        DataCursor(const DataCursor &) = delete;
+        DataCursor &operator=(const DataCursor &) = delete;
+
+        // Number of octets written or read since the last commit
+        std::size_t GetLength() const
+        {
+            return static_cast<std::size_t>(cursor - start);
+        }
+
+        // Number of required octets not yet written or read
+        std::size_t GetRemaining() const
+        {
+            return static_cast<std::size_t>(limit - cursor);
+        }
+
+    protected:
+        DataCursor(DataBuffer &data_buffer) :
+            data_buffer(data_buffer),
+            start(nullptr),
+            cursor(nullptr),
+            limit(nullptr)
+        {
+        }
+        ~DataCursor() = default;
+
+        DataBuffer &data_buffer;                // Buffer being accessed
+        std::uint8_t *start;                    // Position at last commit
+        std::uint8_t *cursor;                   // Current position
+        std::uint8_t *limit;                    // End of the required region
+};
+
+// Define the DataWriter object
+class DataWriter : public DataCursor
+{
+    public:
+        DataWriter(DataBuffer &data_buffer, std::size_t length = 0);
+        ~DataWriter() = default;
+
+        void Require(std::size_t length);
+        void Commit();
+
+        void WriteValue(const std::span<const std::uint8_t> value)
+        {
+            if (!value.empty()) std::memcpy(cursor, value.data(), value.size());
+            cursor += value.size();
+        }
+        void WriteValue(const std::span<const char> value)
+        {
+            // This library assumes a character is 8 bits
+            static_assert(CHAR_BIT == 8);
+
+            if (!value.empty()) std::memcpy(cursor, value.data(), value.size());
+            cursor += value.size();
+        }
+        void WriteValue(std::uint8_t value) { *cursor++ = value; }
+        void WriteValue(std::int8_t value)
+        {
+            *cursor++ = static_cast<std::uint8_t>(value);
+        }
+        void WriteValue(std::uint16_t value) { Store(value); }
+        void WriteValue(std::int16_t value)
+        {
+            Store(static_cast<std::uint16_t>(value));
+        }
+        void WriteValue(std::uint32_t value) { Store(value); }
+        void WriteValue(std::int32_t value)
+        {
+            Store(static_cast<std::uint32_t>(value));
+        }
+        void WriteValue(std::uint64_t value) { Store(value); }
+        void WriteValue(std::int64_t value)
+        {
+            Store(static_cast<std::uint64_t>(value));
+        }
+        void WriteValue(float value)
+        {
+            // Ensure the assumption that a float is 32 bits in length
+            static_assert(sizeof(value) == 4,
+                          "Float values are not the expected size");
+
+            Store(std::bit_cast<std::uint32_t>(value));
+        }
+        void WriteValue(double value)
+        {
+            // Ensure the assumption that a double is 64 bits in length
+            static_assert(sizeof(value) == 8,
+                          "Double values are not the expected size");
+
+            Store(std::bit_cast<std::uint64_t>(value));
+        }
+
+        // Streaming operator that calls function WriteValue
+        template<typename T>
+        DataWriter &operator<<(const T &value)
+        {
+            WriteValue(value);
+            return *this;
+        }
+
+    protected:
+        template<typename T>
+        void Store(T value)
+        {
+            value = ConvertByteOrder<ByteOrder::Network>(value);
+            std::memcpy(cursor, &value, sizeof(value));
+            cursor += sizeof(value);
+        }
+};
+
+// Define the DataReader object
+class DataReader : public DataCursor
+{
+    public:
+        DataReader(DataBuffer &data_buffer, std::size_t length = 0);
+        ~DataReader() = default;
+
+        void Require(std::size_t length);
+        void Commit();
+
+        void Skip(std::size_t length) { cursor += length; }
+
+        void ReadValue(std::span<std::uint8_t> value)
+        {
+            if (!value.empty()) std::memcpy(value.data(), cursor, value.size());
+            cursor += value.size();
+        }
+        void ReadValue(std::span<char> value)
+        {
+            if (!value.empty()) std::memcpy(value.data(), cursor, value.size());
+            cursor += value.size();
+        }
+        void ReadValue(std::uint8_t &value) { value = *cursor++; }
+        void ReadValue(std::int8_t &value)
+        {
+            value = static_cast<std::int8_t>(*cursor++);
+        }
+        void ReadValue(std::uint16_t &value) { value = Load<std::uint16_t>(); }
+        void ReadValue(std::int16_t &value)
+        {
+            value = static_cast<std::int16_t>(Load<std::uint16_t>());
+        }
+        void ReadValue(std::uint32_t &value) { value = Load<std::uint32_t>(); }
+        void ReadValue(std::int32_t &value)
+        {
+            value = static_cast<std::int32_t>(Load<std::uint32_t>());
+        }
+        void ReadValue(std::uint64_t &value) { value = Load<std::uint64_t>(); }
+        void ReadValue(std::int64_t &value)
+        {
+            value = static_cast<std::int64_t>(Load<std::uint64_t>());
+        }
+        void ReadValue(float &value)
+        {
+            value = std::bit_cast<float>(Load<std::uint32_t>());
+        }
+        void ReadValue(double &value)
+        {
+            value = std::bit_cast<double>(Load<std::uint64_t>());
+        }
+
+        // Streaming operator that calls function ReadValue
+        template<typename T>
+        DataReader &operator>>(T &value)
+        {
+            ReadValue(value);
+            return *this;
+        }
+
+    protected:
+        template<typename T>
+        T Load()
+        {
+            T value;
+
+            std::memcpy(&value, cursor, sizeof(value));
+            cursor += sizeof(value);
+
+            return ConvertByteOrder<ByteOrder::Network>(value);
+        }
+};
+
+} // namespace Terra::NetUtil
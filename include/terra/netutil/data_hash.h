@@ -0,0 +1,96 @@
+/*
+ *  data_hash.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines functions to compute a CRC-32C and a fast 64-bit
+ *      hash over data, such as the contents of a DataBuffer.
+ *
+ *      Crc32c() computes the CRC-32C (Castagnoli) used by iSCSI, SCTP, ext4,
+ *      and other protocols.  It is computed using the SSE4.2 crc32
+ *      instruction on x86 processors that support it (as determined at run
+ *      time) or the ARMv8 CRC instructions when compiling for a processor
+ *      that has them, and otherwise using a slicing-by-8 table lookup.  The
+ *      CRC may be computed incrementally by passing the CRC of the preceding
+ *      data as the second argument, so a CRC can be updated as data is
+ *      appended to a DataBuffer:
+ *
+ *          crc = Crc32c(data_buffer.GetBufferSpan());
+ *          ...
+ *          crc = Crc32c(more_data, crc);
+ *
+ *      ContentHash() computes a non-cryptographic 64-bit hash using the
+ *      XXH64 algorithm, suitable for hash tables and for detecting duplicate
+ *      messages, but not for protection against deliberate collisions.  The
+ *      ContentHasher object computes the same hash incrementally, with
+ *      Update() called for each piece of data and Digest() returning the hash
+ *      of all data given so far.
+ *
+ *      The ContentHash() function that accepts a DataBuffer hashes the
+ *      octets up to the data length (the same octets compared by the
+ *      DataBuffer equality operator), allowing DataBuffer objects to be
+ *      stored in unordered containers via the std::hash specialization.
+ *
+ *  Portability Issues:
+ *      The CRC instructions on ARM processors are used only when the compiler
+ *      targets a processor that has them (i.e., __ARM_FEATURE_CRC32 is
+ *      defined).
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include "data_buffer.h"
+
+namespace Terra::NetUtil
+{
+
+std::uint32_t Crc32c(std::span<const std::uint8_t> data, std::uint32_t crc = 0);
+
+std::uint64_t ContentHash(std::span<const std::uint8_t> data,
+                          std::uint64_t seed = 0);
+std::uint64_t ContentHash(const DataBuffer &data_buffer,
+                          std::uint64_t seed = 0);
+
+// Object to compute the ContentHash() of data given in pieces
+class ContentHasher
+{
+    public:
+        ContentHasher(std::uint64_t seed = 0);
+        ~ContentHasher() = default;
+
+        void Reset(std::uint64_t seed = 0);
+        void Update(std::span<const std::uint8_t> data);
+        std::uint64_t Digest() const;
+
+    protected:
+        std::uint64_t seed;
+        std::uint64_t total_length;
+        std::array<std::uint64_t, 4> accumulators;
+        std::array<std::uint8_t, 32> pending;
+        std::size_t pending_length;
+};
+
+} // namespace Terra::NetUtil
+
+// Hash object to facilitate use of DataBuffer with std::unordered_map
+template<>
+struct std::hash<Terra::NetUtil::DataBuffer>
+{
+    std::size_t operator()(
+        const Terra::NetUtil::DataBuffer &data_buffer) const noexcept
+    {
+        return static_cast<std::size_t>(
+            Terra::NetUtil::ContentHash(data_buffer));
+    }
+};
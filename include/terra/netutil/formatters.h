@@ -0,0 +1,162 @@
+/*
+ *  formatters.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines std::formatter specializations so that NetworkAddress
+ *      and DataBuffer objects may be given to std::format() and related
+ *      functions.  The text is written directly to the output iterator
+ *      without allocating memory.
+ *
+ *      A NetworkAddress accepts the following format specifications:
+ *
+ *          {}      Like the stream operator: "192.0.2.1:80" or
+ *                  "[2001:db8::1]:80", omitting the port if zero
+ *          {:a}    Address only: "192.0.2.1" or "2001:db8::1"
+ *          {:b}    Address only, IPv6 in brackets: "[2001:db8::1]"
+ *          {:p}    Address and port, even if zero: "[2001:db8::1]:0"
+ *
+ *      A DataBuffer accepts the following format specifications, each
+ *      applying to the unread portion of the buffer:
+ *
+ *          {}      A hex dump, as produced by the stream operator
+ *          {:d}    Same as {}
+ *          {:x}    Compact hex using lowercase digits: "0a1b2c"
+ *          {:X}    Compact hex using uppercase digits: "0A1B2C"
+ *
+ *      Width, fill, and other standard format specifications are not
+ *      supported.
+ *
+ *  Portability Issues:
+ *      The specializations are defined only if the standard library provides
+ *      std::format (i.e., __cpp_lib_format is defined).
+ */
+
+#pragma once
+
+#include <version>
+
+#ifdef __cpp_lib_format
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <format>
+#include "data_buffer.h"
+#include "hex_dump.h"
+#include "network_address.h"
+
+// Formatter for NetworkAddress objects
+template<>
+struct std::formatter<Terra::NetUtil::NetworkAddress, char>
+{
+    Terra::NetUtil::NetworkAddressStyle style =
+        Terra::NetUtil::NetworkAddressStyle::Default;
+
+    constexpr auto parse(std::format_parse_context &context)
+    {
+        auto it = context.begin();
+
+        if ((it == context.end()) || (*it == '}')) return it;
+
+        switch (*it++)
+        {
+            case 'a':
+                style = Terra::NetUtil::NetworkAddressStyle::Address;
+                break;
+
+            case 'b':
+                style = Terra::NetUtil::NetworkAddressStyle::Bracketed;
+                break;
+
+            case 'p':
+                style = Terra::NetUtil::NetworkAddressStyle::AddressPort;
+                break;
+
+            default:
+                throw std::format_error("Invalid NetworkAddress format");
+        }
+
+        if ((it != context.end()) && (*it != '}'))
+        {
+            throw std::format_error("Invalid NetworkAddress format");
+        }
+
+        return it;
+    }
+
+    template<typename FormatContext>
+    auto format(const Terra::NetUtil::NetworkAddress &address,
+                FormatContext &context) const
+    {
+        std::array<char, Terra::NetUtil::Network_Address_Max_Length> text;
+
+        return std::copy_n(text.data(),
+                           address.GetAddress(text, style),
+                           context.out());
+    }
+};
+
+// Formatter for DataBuffer objects
+template<>
+struct std::formatter<Terra::NetUtil::DataBuffer, char>
+{
+    char presentation = 'd';
+
+    constexpr auto parse(std::format_parse_context &context)
+    {
+        auto it = context.begin();
+
+        if ((it == context.end()) || (*it == '}')) return it;
+
+        presentation = *it++;
+        if ((presentation != 'd') && (presentation != 'x') &&
+            (presentation != 'X'))
+        {
+            throw std::format_error("Invalid DataBuffer format");
+        }
+
+        if ((it != context.end()) && (*it != '}'))
+        {
+            throw std::format_error("Invalid DataBuffer format");
+        }
+
+        return it;
+    }
+
+    template<typename FormatContext>
+    auto format(const Terra::NetUtil::DataBuffer &data_buffer,
+                FormatContext &context) const
+    {
+        std::span<const std::uint8_t> data = data_buffer.GetBufferSpan();
+        auto out = context.out();
+
+        if (presentation == 'd') return Terra::NetUtil::HexDumpTo(out, data);
+
+        // Render compact hex in chunks using a local buffer
+        std::array<char, 128> text;
+        for (std::size_t offset = 0; offset < data.size();)
+        {
+            std::size_t length = std::min(text.size() / 2,
+                                          data.size() - offset);
+
+            out = std::copy_n(text.data(),
+                              Terra::NetUtil::ToHex(data.subspan(offset,
+                                                                 length),
+                                                    text,
+                                                    presentation == 'X'),
+                              out);
+            offset += length;
+        }
+
+        return out;
+    }
+};
+
+#endif // __cpp_lib_format
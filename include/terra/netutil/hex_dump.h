@@ -0,0 +1,120 @@
+/*
+ *  hex_dump.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines functions to render data as hexadecimal text and to
+ *      parse such text back into a DataBuffer.
+ *
+ *      A hex dump has the same layout as the output of the DataBuffer stream
+ *      operator, with sixteen octets per line:
+ *
+ *          00000000: 48 65 6C 6C 6F 0A ...          :Hello.          :
+ *
+ *      Each line starts with the offset of its first octet as (at least)
+ *      eight uppercase hex digits, followed by the octets in hex and then
+ *      their ASCII form, with unprintable octets shown as '.'.  A partial
+ *      final line is padded with spaces.
+ *
+ *      The functions producing a hex dump do not allocate memory.
+ *      HexDump() writes into a caller-provided character buffer, which must
+ *      be at least HexDumpLength() characters in length, and HexDumpTo()
+ *      writes to an output iterator, such as std::back_inserter() or the
+ *      iterator given to std::format_to(), one line at a time.  ToHex()
+ *      renders data as a contiguous string of hex digits (two per octet) in
+ *      either case.
+ *
+ *      FromHex() and FromHexDump() perform the inverse operations, returning
+ *      a DataBuffer with the data length set to the number of octets parsed.
+ *      Hex digits may be in either case.  FromHex() decodes 32 hex digits at
+ *      a time using SSE2 or NEON instructions where available.  FromHexDump()
+ *      ignores the offset and ASCII parts of each line, as well as any empty
+ *      lines.  Both functions throw a DataBufferException if the text is
+ *      malformed.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include "data_buffer.h"
+
+namespace Terra::NetUtil
+{
+
+// Number of octets rendered on each line of a hex dump
+constexpr std::size_t Hex_Dump_Octets_Per_Line = 16;
+
+// Maximum length of a line of a hex dump, including the newline character
+constexpr std::size_t Hex_Dump_Max_Line_Length =
+    (sizeof(std::size_t) * 2) + 1 + (Hex_Dump_Octets_Per_Line * 4) + 4;
+
+std::size_t HexDumpLine(std::span<const std::uint8_t> data,
+                        std::size_t offset,
+                        std::span<char> line);
+std::size_t HexDumpLength(std::size_t length);
+std::size_t HexDump(std::span<const std::uint8_t> data,
+                    std::span<char> output);
+std::size_t ToHex(std::span<const std::uint8_t> data,
+                  std::span<char> output,
+                  bool uppercase = true);
+
+DataBuffer FromHex(std::string_view hex);
+DataBuffer FromHexDump(std::string_view hex_dump);
+
+/*
+ *  HexDumpTo()
+ *
+ *  Description:
+ *      Write a hex dump of the given data to an output iterator.
+ *
+ *  Parameters:
+ *      out [in]
+ *          The output iterator to which characters are written.
+ *
+ *      data [in]
+ *          The data to dump.
+ *
+ *  Returns:
+ *      The output iterator following the last character written.
+ *
+ *  Comments:
+ *      Each line is formed in a local buffer and then copied to the output
+ *      iterator, so no memory is allocated.
+ */
+template<typename OutputIt>
+OutputIt HexDumpTo(OutputIt out, std::span<const std::uint8_t> data)
+{
+    std::array<char, Hex_Dump_Max_Line_Length> line;
+
+    for (std::size_t offset = 0;
+         offset < data.size();
+         offset += Hex_Dump_Octets_Per_Line)
+    {
+        std::size_t length = HexDumpLine(
+            data.subspan(offset,
+                         std::min(Hex_Dump_Octets_Per_Line,
+                                  data.size() - offset)),
+            offset,
+            line);
+
+        out = std::copy_n(line.data(), length, out);
+    }
+
+    return out;
+}
+
+} // namespace Terra::NetUtil
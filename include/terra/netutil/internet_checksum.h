@@ -0,0 +1,76 @@
+/*
+ *  internet_checksum.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines functions to compute the Internet checksum (RFC 1071)
+ *      used by IPv4, ICMP, UDP, TCP, and other protocols.  The checksum is
+ *      the ones' complement of the ones' complement sum of the data taken as
+ *      a series of 16-bit values in network byte order.
+ *
+ *      InternetChecksum() computes the checksum over a span of octets or over
+ *      a range within a DataBuffer.  The returned value is in host byte order
+ *      and may be stored in a header using DataBuffer::SetValue().  Computing
+ *      the checksum over data that includes a valid checksum produces zero,
+ *      so the same function is used to verify a received checksum.  A variant
+ *      that accepts source and destination NetworkAddress objects and a
+ *      protocol number includes the IPv4 or IPv6 pseudo-header used by UDP
+ *      and TCP.  Note that a UDP checksum of zero must be transmitted as
+ *      0xffff, which is left to the caller.
+ *
+ *      OnesComplementSum() returns the sum without taking its complement,
+ *      allowing a checksum to be computed over data that is not contiguous.
+ *      Each piece of data other than the last should have an even length.
+ *
+ *      UpdateChecksum() updates an existing checksum when a 16- or 32-bit
+ *      value covered by the checksum changes (RFC 1624), as is done when
+ *      decrementing the IPv4 TTL or translating an address, so the checksum
+ *      need not be computed again over all of the data.
+ *
+ *      The sum is computed using AVX2 or SSE2 instructions on x86 processors
+ *      that support them (as determined at run time) or NEON instructions on
+ *      ARM processors, with the remaining octets summed individually.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "data_buffer.h"
+#include "network_address.h"
+
+namespace Terra::NetUtil
+{
+
+std::uint16_t OnesComplementSum(std::span<const std::uint8_t> data,
+                                std::uint16_t sum = 0);
+
+std::uint16_t InternetChecksum(std::span<const std::uint8_t> data);
+std::uint16_t InternetChecksum(const DataBuffer &data_buffer,
+                               std::size_t offset,
+                               std::size_t length);
+std::uint16_t InternetChecksum(const DataBuffer &data_buffer,
+                               std::size_t offset,
+                               std::size_t length,
+                               const NetworkAddress &source,
+                               const NetworkAddress &destination,
+                               std::uint8_t protocol);
+
+std::uint16_t UpdateChecksum(std::uint16_t checksum,
+                             std::uint16_t old_value,
+                             std::uint16_t new_value);
+std::uint16_t UpdateChecksum(std::uint16_t checksum,
+                             std::uint32_t old_value,
+                             std::uint32_t new_value);
+
+} // namespace Terra::NetUtil
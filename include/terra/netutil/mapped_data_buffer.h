@@ -0,0 +1,158 @@
+/*
+ *  mapped_data_buffer.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines the MappedDataBuffer object.  A MappedDataBuffer is a
+ *      DataBuffer whose buffer is a file mapped into memory with mmap(), which
+ *      allows files much larger than available memory to be parsed with the
+ *      same GetValue() and ReadValue() functions provided by DataBuffer and
+ *      with the DataReader cursor (via GetDataBuffer()).
+ *
+ *      When opened in Read mode, the data length is the size of the file and
+ *      the file is never modified.  Values may still be set in the buffer, but
+ *      the changes are private to the process.  When opened in ReadWrite mode,
+ *      the file is created if it does not exist and is mapped with a buffer
+ *      size that is the larger of the file size and the given capacity.  The
+ *      data length is initially the file size, so values appended are written
+ *      following the existing contents.  Changes are written to the file by
+ *      the operating system at some point; Sync() may be called to force them
+ *      to be written.  When the MappedDataBuffer is closed, the file is
+ *      truncated to the data length, so SetDataLength() and
+ *      AdvanceDataLength() serve to commit the length of the file.  The buffer
+ *      does not grow; attempting to write beyond the capacity results in an
+ *      exception.
+ *
+ *      The operating system is free to discard pages of the file that are not
+ *      being used, though pages that have been accessed count toward the
+ *      process's resident memory until that happens.  Advise() may be used
+ *      to tell the operating system how the buffer will be accessed (e.g.,
+ *      sequentially), and Release() may be called periodically while reading
+ *      a large file to release the pages preceding the read position so that
+ *      resident memory remains constant regardless of the file size.
+ *
+ *  Portability Issues:
+ *      This object relies on mmap() and madvise() and is not available on
+ *      Windows.  The HugePage advice is only effective on Linux.
+ */
+
+#pragma once
+
+#ifndef _WIN32
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include "data_buffer.h"
+
+namespace Terra::NetUtil
+{
+
+// Mode in which the file is opened
+enum class MappedFileMode
+{
+    Read,                                       // Changes are not saved
+    ReadWrite                                   // Changes are saved
+};
+
+// Advice given to the operating system about how the buffer will be used
+enum class MappedFileAdvice
+{
+    Normal,                                     // No particular advice
+    Sequential,                                 // Accessed in order
+    Random,                                     // Accessed in random order
+    WillNeed,                                   // Read ahead of access
+    HugePage                                    // Use huge pages
+};
+
+// Define the MappedDataBuffer object
+class MappedDataBuffer : protected DataBuffer
+{
+    public:
+        MappedDataBuffer(const std::filesystem::path &path,
+                         MappedFileMode mode = MappedFileMode::Read,
+                         std::size_t capacity = 0);
+        MappedDataBuffer(const MappedDataBuffer &) = delete;
+        MappedDataBuffer(MappedDataBuffer &&) = delete;
+        virtual ~MappedDataBuffer();
+
+        MappedDataBuffer &operator=(const MappedDataBuffer &) = delete;
+        MappedDataBuffer &operator=(MappedDataBuffer &&) = delete;
+
+        // Underlying DataBuffer for use with DataWriter and DataReader
+        DataBuffer &GetDataBuffer() { return *this; }
+        const DataBuffer &GetDataBuffer() const { return *this; }
+
+        MappedFileMode GetMode() const { return mode; }
+        bool IsOpen() const { return fd >= 0; }
+
+        bool Advise(MappedFileAdvice advice,
+                    std::size_t offset = 0,
+                    std::size_t length = 0);
+        void Release();
+        void Sync(bool asynchronous = false);
+        void Close();
+
+        using DataBuffer::GetBufferPointer;
+        using DataBuffer::GetBufferSpan;
+        using DataBuffer::GetBufferSize;
+
+        using DataBuffer::GetDataLength;
+        using DataBuffer::SetDataLength;
+        using DataBuffer::Empty;
+
+        using DataBuffer::GetReadPosition;
+        using DataBuffer::SetReadPosition;
+        using DataBuffer::AdvanceReadPosition;
+        using DataBuffer::GetUnreadLength;
+
+        using DataBuffer::GetFreeSpan;
+        using DataBuffer::AdvanceDataLength;
+
+        using DataBuffer::operator[];
+        using DataBuffer::begin;
+        using DataBuffer::end;
+
+        using DataBuffer::SetValue;
+        using DataBuffer::SetValues;
+        using DataBuffer::GetValue;
+        using DataBuffer::GetValues;
+        using DataBuffer::AppendValue;
+        using DataBuffer::AppendValues;
+        using DataBuffer::ReadValue;
+        using DataBuffer::ReadValues;
+        using DataBuffer::TryGetValue;
+        using DataBuffer::TryAppendValue;
+        using DataBuffer::TryReadValue;
+
+        // Streaming operators that call function AppendValue / ReadValue
+        template<typename T>
+        MappedDataBuffer &operator<<(const T &value)
+        {
+            AppendValue(value);
+            return *this;
+        }
+        template<typename T>
+        MappedDataBuffer &operator>>(T &value)
+        {
+            ReadValue(value);
+            return *this;
+        }
+
+    protected:
+        MappedFileMode mode;                    // Mode of the opened file
+        int fd;                                 // Descriptor of the file
+        std::uint8_t *mapping;                  // Start of the mapped memory
+        std::size_t mapping_size;               // Size of the mapped memory
+};
+
+} // namespace Terra::NetUtil
+
+#endif // _WIN32
@@ -15,6 +15,12 @@
  *      in which case zero is assigned and interpreted as not having a port
  *      value.
  *
+ *      GetAddress() returns the address in text form as a string.  A variant
+ *      writes the text into a caller-provided buffer of at least
+ *      Network_Address_Max_Length characters without allocating memory, with
+ *      the NetworkAddressStyle specifying whether IPv6 addresses are enclosed
+ *      in brackets and whether the port is included.
+ *
  *  Portability Issues:
  *      None.
  */
@@ -30,6 +36,8 @@
 #endif
 #include <ostream>
 #include <string>
+#include <span>
+#include <cstddef>
 #include <cstdint>
 #include <climits>
 
@@ -44,6 +52,18 @@ enum class NetworkAddressType
     IPv6 = 2
 };
 
+// Styles in which a NetworkAddress may be rendered as text
+enum class NetworkAddressStyle
+{
+    Address = 0,                                // Address only
+    Bracketed = 1,                              // IPv6 address in brackets
+    Default = 2,                                // Bracketed, non-zero port
+    AddressPort = 3                             // Bracketed, with port
+};
+
+// Maximum length of a NetworkAddress in text form (e.g., "[...]:65535")
+constexpr std::size_t Network_Address_Max_Length = INET6_ADDRSTRLEN + 8;
+
 // Define the NetworkAddress object
 class NetworkAddress
 {
@@ -68,6 +88,9 @@ class NetworkAddress
         bool AssignAddress(const struct sockaddr_storage *address,
                            socklen_t address_length);
         std::string GetAddress() const;
+        std::size_t GetAddress(
+            std::span<char> buffer,
+            NetworkAddressStyle style = NetworkAddressStyle::Address) const;
 
         sockaddr_storage* GetAddressStorage();
         const sockaddr_storage* GetAddressStorage() const;
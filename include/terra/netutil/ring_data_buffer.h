@@ -0,0 +1,131 @@
+/*
+ *  ring_data_buffer.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines the RingDataBuffer object.  A RingDataBuffer is a
+ *      fixed-size circular buffer intended for streaming reads from a socket
+ *      (e.g., TCP), where data is received into the free space following the
+ *      data and consumed from the read position.  Unlike a DataBuffer, the
+ *      space occupied by data that has been read is reused without having to
+ *      move the unread data to the front of the buffer.
+ *
+ *      The memory is mapped twice into adjacent virtual address ranges, so
+ *      the octet following the last octet of the buffer is the first octet of
+ *      the buffer.  As a result, the unread data and the free space are each
+ *      always contiguous in memory, even when they wrap around the end of the
+ *      buffer.  Values may therefore be read or appended across the end of
+ *      the buffer using the same AppendValue() and ReadValue() functions
+ *      provided by DataBuffer, and GetBufferSpan() and GetFreeSpan() return
+ *      spans suitable for passing directly to send() and recv().  After
+ *      receiving into the span returned by GetFreeSpan(), AdvanceDataLength()
+ *      should be called with the number of octets received.  After sending
+ *      from the span returned by GetBufferSpan(), AdvanceReadPosition()
+ *      should be called with the number of octets sent.
+ *
+ *      The buffer size is rounded up to a multiple of the system page size.
+ *      The RingDataBuffer never grows; attempting to append more octets than
+ *      there is free space results in an exception, as with a fixed-size
+ *      DataBuffer.  GetDataBuffer() returns a reference to the underlying
+ *      DataBuffer for use with the DataWriter and DataReader cursors, which
+ *      are then limited to the free space and unread data, respectively.
+ *
+ *  Portability Issues:
+ *      This object relies on POSIX shared memory and mmap() and is not
+ *      available on Windows.  On Linux, memfd_create() is used to create the
+ *      memory object.
+ */
+
+#pragma once
+
+#ifndef _WIN32
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "data_buffer.h"
+
+namespace Terra::NetUtil
+{
+
+// Define the RingDataBuffer object
+class RingDataBuffer : protected DataBuffer
+{
+    public:
+        explicit RingDataBuffer(std::size_t buffer_size);
+        RingDataBuffer(const RingDataBuffer &) = delete;
+        RingDataBuffer(RingDataBuffer &&) = delete;
+        virtual ~RingDataBuffer();
+
+        RingDataBuffer &operator=(const RingDataBuffer &) = delete;
+        RingDataBuffer &operator=(RingDataBuffer &&) = delete;
+
+        DataBuffer &GetDataBuffer();
+
+        std::size_t GetBufferSize() const;
+        std::size_t GetFreeLength() const;
+        using DataBuffer::GetUnreadLength;
+        bool Empty() const;
+        void Clear();
+
+        using DataBuffer::GetBufferSpan;
+        std::span<std::uint8_t> GetFreeSpan();
+
+        void AdvanceDataLength(std::size_t length);
+        using DataBuffer::AdvanceReadPosition;
+
+        using DataBuffer::ReadValue;
+        using DataBuffer::ReadValues;
+        using DataBuffer::TryReadValue;
+
+        // Functions that call the DataBuffer append functions after first
+        // reclaiming the space occupied by data that has been read
+        template<typename T>
+        void AppendValue(const T &value)
+        {
+            Reclaim();
+            DataBuffer::AppendValue(value);
+        }
+        template<typename T>
+        void AppendValues(const T &values)
+        {
+            Reclaim();
+            DataBuffer::AppendValues(values);
+        }
+        template<typename T>
+        DataBufferStatus TryAppendValue(const T &value)
+        {
+            Reclaim();
+            return DataBuffer::TryAppendValue(value);
+        }
+
+        // Streaming operators that call function AppendValue / ReadValue
+        template<typename T>
+        RingDataBuffer &operator<<(const T &value)
+        {
+            AppendValue(value);
+            return *this;
+        }
+        template<typename T>
+        RingDataBuffer &operator>>(T &value)
+        {
+            ReadValue(value);
+            return *this;
+        }
+
+    protected:
+        void Reclaim();
+
+        std::uint8_t *ring;                     // Start of the mapped memory
+        std::size_t ring_size;                  // Size of the ring buffer
+};
+
+} // namespace Terra::NetUtil
+
+#endif // _WIN32
@@ -0,0 +1,109 @@
+/*
+ *  shared_data_buffer.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines the SharedDataBuffer object.  A SharedDataBuffer is
+ *      an immutable view of data held in storage that is shared by reference
+ *      count among all SharedDataBuffer objects referring to it.  This allows
+ *      a single serialized message to be handed to any number of consumers
+ *      without copying the data and without the risk of a dangling pointer
+ *      that would come with constructing a DataBuffer over a span.
+ *
+ *      A SharedDataBuffer is constructed from a DataBuffer, either by moving
+ *      the DataBuffer (which does not copy the data) or by copying it.  The
+ *      view covers the data (i.e., the octets up to the data length) in the
+ *      DataBuffer.  Copying a SharedDataBuffer is inexpensive, as only the
+ *      reference count is incremented.  Slice() returns a SharedDataBuffer
+ *      viewing a portion of the data that also keeps the storage alive.  The
+ *      storage is released when the last SharedDataBuffer referring to it is
+ *      destroyed.
+ *
+ *      Data is accessed using the same GetValue() and ReadValue() functions
+ *      provided by DataBuffer.  Each SharedDataBuffer has its own read
+ *      position, so consumers may read independently.  Functions that would
+ *      modify the data are not available.  GetDataBuffer() returns a const
+ *      reference to the view as a DataBuffer for use with functions that
+ *      accept a DataBuffer.
+ *
+ *  Portability Issues:
+ *      The reference count is updated atomically, so SharedDataBuffer objects
+ *      referring to the same storage may be used and destroyed on different
+ *      threads.  However, a single SharedDataBuffer object must not be read
+ *      by multiple threads concurrently, since reading updates the read
+ *      position.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include "data_buffer.h"
+
+namespace Terra::NetUtil
+{
+
+// Define the SharedDataBuffer object
+class SharedDataBuffer : protected DataBuffer
+{
+    public:
+        SharedDataBuffer();
+        explicit SharedDataBuffer(DataBuffer &&data_buffer);
+        explicit SharedDataBuffer(const DataBuffer &data_buffer);
+        SharedDataBuffer(const SharedDataBuffer &other);
+        SharedDataBuffer(SharedDataBuffer &&other) noexcept;
+        virtual ~SharedDataBuffer() = default;
+
+        SharedDataBuffer &operator=(const SharedDataBuffer &other);
+        SharedDataBuffer &operator=(SharedDataBuffer &&other) noexcept;
+
+        SharedDataBuffer Slice(std::size_t offset, std::size_t length) const;
+        SharedDataBuffer Slice(std::size_t offset) const;
+        long GetUseCount() const;
+
+        const DataBuffer &GetDataBuffer() const;
+
+        const std::uint8_t *GetBufferPointer(std::size_t offset = 0) const;
+        std::span<const std::uint8_t> GetBufferSpan() const;
+
+        using DataBuffer::GetDataLength;
+        using DataBuffer::Empty;
+
+        using DataBuffer::GetReadPosition;
+        using DataBuffer::SetReadPosition;
+        using DataBuffer::AdvanceReadPosition;
+        using DataBuffer::GetUnreadLength;
+
+        const std::uint8_t &operator[](std::size_t index) const;
+
+        bool operator==(const SharedDataBuffer &other) const;
+        bool operator!=(const SharedDataBuffer &other) const;
+
+        using DataBuffer::GetValue;
+        using DataBuffer::GetValues;
+        using DataBuffer::ReadValue;
+        using DataBuffer::ReadValues;
+
+        // Streaming operator that calls function ReadValue
+        template<typename T>
+        SharedDataBuffer &operator>>(T &value)
+        {
+            ReadValue(value);
+            return *this;
+        }
+
+    protected:
+        void SetView(std::uint8_t *data, std::size_t length);
+
+        std::shared_ptr<const DataBuffer> storage;  // Shared data storage
+};
+
+} // namespace Terra::NetUtil
@@ -0,0 +1,112 @@
+/*
+ *  small_data_buffer.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines the SmallDataBuffer object.  This is a DataBuffer
+ *      that contains N octets of inline storage so that small buffers do not
+ *      require a heap allocation.  A buffer of N octets or fewer is placed
+ *      in the inline storage, while a larger buffer is allocated from the
+ *      heap.  If the SmallDataBuffer is growable, appending data beyond N
+ *      octets will move the contents from the inline storage to the heap.
+ *
+ *      A SmallDataBuffer provides the entire DataBuffer interface and may
+ *      be used anywhere a DataBuffer is expected.  Since the inline storage
+ *      cannot be transferred to another object, moving a SmallDataBuffer
+ *      whose contents are stored inline will copy those contents.  Moving a
+ *      SmallDataBuffer whose contents have spilled to the heap transfers the
+ *      heap buffer as with any other DataBuffer.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#pragma once
+
+#include <array>
+#include <utility>
+#include "data_buffer.h"
+
+namespace Terra::NetUtil
+{
+
+// Define the SmallDataBuffer object
+template<std::size_t N>
+class SmallDataBuffer : public DataBuffer
+{
+    static_assert(N > 0, "SmallDataBuffer requires inline storage");
+
+    public:
+        SmallDataBuffer(std::size_t buffer_size = N, bool growable = false) :
+            DataBuffer()
+        {
+            UseInlineStorage();
+            this->growable = growable;
+            AllocateBuffer(buffer_size);
+        }
+        SmallDataBuffer(const DataBuffer &other) : DataBuffer()
+        {
+            UseInlineStorage();
+            DataBuffer::operator=(other);
+        }
+        SmallDataBuffer(const SmallDataBuffer &other) : DataBuffer()
+        {
+            UseInlineStorage();
+            DataBuffer::operator=(other);
+        }
+        SmallDataBuffer(DataBuffer &&other) noexcept : DataBuffer()
+        {
+            UseInlineStorage();
+            DataBuffer::operator=(std::move(other));
+        }
+        SmallDataBuffer(SmallDataBuffer &&other) noexcept : DataBuffer()
+        {
+            UseInlineStorage();
+            DataBuffer::operator=(std::move(other));
+        }
+        virtual ~SmallDataBuffer() = default;
+
+        SmallDataBuffer &operator=(const DataBuffer &other)
+        {
+            DataBuffer::operator=(other);
+            return *this;
+        }
+        SmallDataBuffer &operator=(const SmallDataBuffer &other)
+        {
+            DataBuffer::operator=(other);
+            return *this;
+        }
+        SmallDataBuffer &operator=(DataBuffer &&other) noexcept
+        {
+            DataBuffer::operator=(std::move(other));
+            return *this;
+        }
+        SmallDataBuffer &operator=(SmallDataBuffer &&other) noexcept
+        {
+            DataBuffer::operator=(std::move(other));
+            return *this;
+        }
+
+        static constexpr std::size_t GetInlineSize() { return N; }
+        bool IsInline() const
+        {
+            return (buffer != nullptr) && (buffer == inline_buffer);
+        }
+
+    protected:
+        void UseInlineStorage()
+        {
+            inline_buffer = storage.data();
+            inline_buffer_size = N;
+        }
+
+        std::array<std::uint8_t, N> storage;    // Inline buffer storage
+};
+
+} // namespace Terra::NetUtil
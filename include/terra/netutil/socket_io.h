@@ -0,0 +1,144 @@
+/*
+ *  socket_io.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines functions that send and receive data directly
+ *      between a socket and a DataBuffer, avoiding the need to pass buffer
+ *      pointers and lengths to the socket functions and then adjust the data
+ *      length or read position accordingly.
+ *
+ *      For stream sockets (e.g., TCP), Receive() receives data into the free
+ *      space following the data in the DataBuffer (see GetFreeSpan()) and
+ *      advances the data length, while Send() sends the unread data (see
+ *      GetBufferSpan()) and advances the read position.  Either may transfer
+ *      fewer octets than are available.
+ *
+ *      For datagram sockets (e.g., UDP), ReceiveFrom() receives a datagram
+ *      into the start of the DataBuffer, setting the data length to the size
+ *      of the datagram and the read position to zero, and assigns the source
+ *      address to the given NetworkAddress.  SendTo() sends the unread data as
+ *      a single datagram to the given address and advances the read position.
+ *
+ *      The batched variants of ReceiveFrom() and SendTo() operate on a span of
+ *      Datagram objects, each holding a DataBuffer and a NetworkAddress (the
+ *      source address when receiving or the destination address when
+ *      sending).  On Linux, these use recvmmsg() and sendmmsg() to transfer up
+ *      to Socket_Batch_Size datagrams with a single system call, filling the
+ *      addresses directly into each NetworkAddress.  Elsewhere, they call
+ *      ReceiveFrom() or SendTo() for each datagram.  When receiving, the
+ *      call waits (if the socket is blocking) only for the first datagram,
+ *      then receives as many as are immediately available.
+ *
+ *      As with the underlying socket functions, each function returns -1 on
+ *      failure with the reason available via errno (or WSAGetLastError() on
+ *      Windows).  The DataBuffer and NetworkAddress are unchanged on failure.
+ *      A DataBuffer that is too small to hold a received datagram holds only
+ *      the part that fits.  On Linux, the batched variant also sets the
+ *      Datagram's truncated flag in that case.
+ *
+ *      On Linux, UDP segmentation offload (GSO) and receive offload (GRO)
+ *      further reduce the number of system calls.  SendSegments() sends the
+ *      unread data in a DataBuffer as a series of datagrams of a given
+ *      segment size (the last may be shorter) using the UDP_SEGMENT control
+ *      message, so that the kernel (or network interface) performs the
+ *      segmentation.  Once EnableReceiveOffload() has been called on a
+ *      socket, the kernel may coalesce consecutive datagrams from the same
+ *      source into a single buffer.  ReceiveSegments() receives such a buffer
+ *      into a DataBuffer and reports the segment size, after which
+ *      SplitSegments() assigns each datagram to a DataBuffer that refers to
+ *      the datagram within the received DataBuffer (i.e., without copying).
+ *      The DataBuffer given to ReceiveSegments() should be large enough to
+ *      hold Segment_Offload_Length octets.  Elsewhere, SendSegments() sends
+ *      each segment individually and ReceiveSegments() receives a single
+ *      datagram, reporting its length as the segment size, so code written
+ *      to use these functions operates correctly on any platform.
+ *
+ *  Portability Issues:
+ *      Batching and UDP segmentation and receive offload are only performed on
+ *      Linux.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include "data_buffer.h"
+#include "network_address.h"
+
+namespace Terra::NetUtil
+{
+
+// Type used to refer to a socket
+#ifdef _WIN32
+using SocketHandle = SOCKET;
+#else
+using SocketHandle = int;
+#endif
+
+// Maximum number of datagrams transferred with a single system call
+constexpr std::size_t Socket_Batch_Size = 64;
+
+// Maximum number of octets sent or received with a single UDP offload
+constexpr std::size_t Segment_Offload_Length = 65507;
+
+// Maximum number of segments sent with a single UDP segmentation offload
+constexpr std::size_t Segment_Offload_Count = 64;
+
+// A datagram to be sent or that was received
+struct Datagram
+{
+    DataBuffer data_buffer;                     // Datagram contents
+    NetworkAddress address;                     // Source or destination
+    bool truncated = false;                     // Received datagram truncated
+};
+
+// Functions for stream sockets
+std::ptrdiff_t Receive(SocketHandle socket,
+                       DataBuffer &data_buffer,
+                       int flags = 0);
+std::ptrdiff_t Send(SocketHandle socket,
+                    DataBuffer &data_buffer,
+                    int flags = 0);
+
+// Functions for datagram sockets
+std::ptrdiff_t ReceiveFrom(SocketHandle socket,
+                           DataBuffer &data_buffer,
+                           NetworkAddress &address,
+                           int flags = 0);
+std::ptrdiff_t SendTo(SocketHandle socket,
+                      DataBuffer &data_buffer,
+                      const NetworkAddress &address,
+                      int flags = 0);
+
+// Functions that transfer multiple datagrams
+std::ptrdiff_t ReceiveFrom(SocketHandle socket,
+                           std::span<Datagram> datagrams,
+                           int flags = 0);
+std::ptrdiff_t SendTo(SocketHandle socket,
+                      std::span<Datagram> datagrams,
+                      int flags = 0);
+
+// Functions for UDP segmentation and receive offload
+std::ptrdiff_t SendSegments(SocketHandle socket,
+                            DataBuffer &data_buffer,
+                            std::size_t segment_size,
+                            const NetworkAddress &address,
+                            int flags = 0);
+bool EnableReceiveOffload(SocketHandle socket);
+std::ptrdiff_t ReceiveSegments(SocketHandle socket,
+                               DataBuffer &data_buffer,
+                               NetworkAddress &address,
+                               std::size_t &segment_size,
+                               int flags = 0);
+std::size_t SplitSegments(DataBuffer &data_buffer,
+                          std::size_t segment_size,
+                          std::span<DataBuffer> segments);
+
+} // namespace Terra::NetUtil
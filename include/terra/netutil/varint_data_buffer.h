@@ -35,12 +35,41 @@
  *               call DataBuffer:SetValue(), for example, explicitly, rather
  *               than relying on the compiler to deduce the type.
  *
+ *      BeginLength<T>() and EndLength<T>() write a length-prefixed structure
+ *      in a single pass, as they do for DataBuffer, but the length field is a
+ *      variable-width unsigned integer.  Since the length is not known until
+ *      EndLength() is called, BeginLength() reserves the number of octets
+ *      required to encode the maximum value of T (e.g., three octets for
+ *      VarUint16_t).  EndLength() writes the length using the fewest octets
+ *      possible and, if fewer octets are required than were reserved, moves
+ *      the structure's contents to follow it.  Thus, the contents of each
+ *      nested structure are moved at most once per level of nesting.  Using
+ *      the smallest type T that can hold the length minimizes the reserved
+ *      space.  Fixed-width length fields may still be written by specifying
+ *      an integral type, e.g., BeginLength<std::uint16_t>().
+ *
+ *      ReadBytesView() and ReadStringView() read an octet string preceded by
+ *      its length as a variable-width unsigned integer, as written using
+ *      BeginLength() and EndLength() or by appending the length followed by
+ *      the octets.  They return a span or string view over the octets within
+ *      the buffer rather than copying them, which remains valid only until
+ *      the buffer is grown, compacted, or replaced.
+ *
+ *      As with DataBuffer, the TryGetValue(), TryAppendValue(), and
+ *      TryReadValue() functions return a DataBufferStatus rather than
+ *      throwing an exception.  In addition to insufficient space or data,
+ *      they report a malformed value or a value that exceeds the range of the
+ *      requested type.  On failure, the value and the read position are left
+ *      unchanged.
+ *
  *  Portability Issues:
  *      None.
  */
 
 #pragma once
 
+#include <span>
+#include <string_view>
 #include "data_buffer.h"
 #include "variable_integer.h"
 
@@ -59,6 +88,11 @@ class VarIntDataBuffer : virtual public DataBuffer
         using DataBuffer::GetValue;
         using DataBuffer::AppendValue;
         using DataBuffer::ReadValue;
+        using DataBuffer::TryGetValue;
+        using DataBuffer::TryAppendValue;
+        using DataBuffer::TryReadValue;
+        using DataBuffer::BeginLength;
+        using DataBuffer::EndLength;
 
         virtual ~VarIntDataBuffer() = default;
 
@@ -150,6 +184,124 @@ class VarIntDataBuffer : virtual public DataBuffer
             return length;
         }
 
+        DataBufferStatus TryGetValue(VarUint64_t &value,
+                                     std::size_t offset,
+                                     std::size_t &length) const noexcept;
+        DataBufferStatus TryGetValue(VarInt64_t &value,
+                                     std::size_t offset,
+                                     std::size_t &length) const noexcept;
+        template<VariableUnsignedInteger T>
+        DataBufferStatus TryGetValue(T &value,
+                                     std::size_t offset,
+                                     std::size_t &length) const noexcept
+        {
+            VarUint64_t read_value;
+            std::size_t read_length{};
+            DataBufferStatus status =
+                TryGetValue(read_value, offset, read_length);
+            if (status != DataBufferStatus::Success) return status;
+            if (read_value > std::numeric_limits<typename T::value_type>::max())
+            {
+                return DataBufferStatus::OutOfRange;
+            }
+            value = read_value;
+            length = read_length;
+            return DataBufferStatus::Success;
+        }
+        template<VariableSignedInteger T>
+        DataBufferStatus TryGetValue(T &value,
+                                     std::size_t offset,
+                                     std::size_t &length) const noexcept
+        {
+            VarInt64_t read_value;
+            std::size_t read_length{};
+            DataBufferStatus status =
+                TryGetValue(read_value, offset, read_length);
+            if (status != DataBufferStatus::Success) return status;
+            if ((read_value >
+                 std::numeric_limits<typename T::value_type>::max()) ||
+                (read_value <
+                 std::numeric_limits<typename T::value_type>::min()))
+            {
+                return DataBufferStatus::OutOfRange;
+            }
+            value = read_value;
+            length = read_length;
+            return DataBufferStatus::Success;
+        }
+
+        DataBufferStatus TryAppendValue(const VarUint64_t &value);
+        DataBufferStatus TryAppendValue(const VarInt64_t &value);
+        template<VariableUnsignedInteger T>
+        DataBufferStatus TryAppendValue(const T &value)
+        {
+            return TryAppendValue(VarUint64_t(value));
+        }
+        template<VariableSignedInteger T>
+        DataBufferStatus TryAppendValue(const T &value)
+        {
+            return TryAppendValue(VarInt64_t(value));
+        }
+
+        DataBufferStatus TryReadValue(VarUint64_t &value) noexcept;
+        DataBufferStatus TryReadValue(VarInt64_t &value) noexcept;
+        template<VariableUnsignedInteger T>
+        DataBufferStatus TryReadValue(T &value) noexcept
+        {
+            VarUint64_t read_value;
+            std::size_t position = read_position;
+            DataBufferStatus status = TryReadValue(read_value);
+            if (status != DataBufferStatus::Success) return status;
+            if (read_value > std::numeric_limits<typename T::value_type>::max())
+            {
+                read_position = position;
+                return DataBufferStatus::OutOfRange;
+            }
+            value = read_value;
+            return DataBufferStatus::Success;
+        }
+        template<VariableSignedInteger T>
+        DataBufferStatus TryReadValue(T &value) noexcept
+        {
+            VarInt64_t read_value;
+            std::size_t position = read_position;
+            DataBufferStatus status = TryReadValue(read_value);
+            if (status != DataBufferStatus::Success) return status;
+            if ((read_value >
+                 std::numeric_limits<typename T::value_type>::max()) ||
+                (read_value <
+                 std::numeric_limits<typename T::value_type>::min()))
+            {
+                read_position = position;
+                return DataBufferStatus::OutOfRange;
+            }
+            value = read_value;
+            return DataBufferStatus::Success;
+        }
+
+        // Variable-width length fields able to hold the maximum value of T
+        template<VariableUnsignedInteger T = VarUint64_t>
+        std::size_t BeginLength()
+        {
+            constexpr auto maximum =
+                std::numeric_limits<typename T::value_type>::max();
+            return ReserveLength(VarUintSize(maximum));
+        }
+        template<VariableUnsignedInteger T = VarUint64_t>
+        std::size_t EndLength(std::size_t offset)
+        {
+            constexpr auto maximum =
+                std::numeric_limits<typename T::value_type>::max();
+            return CompleteLength(offset, VarUintSize(maximum), maximum);
+        }
+
+        // Octet strings preceded by a variable-width length, without copying
+        std::span<std::uint8_t> ReadBytesView();
+        std::string_view ReadStringView();
+        DataBufferStatus TryReadBytesView(
+            std::span<std::uint8_t> &value) noexcept;
+        DataBufferStatus TryReadStringView(std::string_view &value) noexcept;
+
         static std::size_t VarUintSize(const VarUint64_t &value);
         static std::size_t VarIntSize(const VarInt64_t &value);
 
@@ -168,6 +320,22 @@ class VarIntDataBuffer : virtual public DataBuffer
             ReadValue(value);
             return *this;
         }
+
+    protected:
+        DataBufferStatus DecodeValue(VarUint64_t &value,
+                                     std::size_t offset,
+                                     std::size_t limit,
+                                     std::size_t &length) const noexcept;
+        DataBufferStatus DecodeValue(VarInt64_t &value,
+                                     std::size_t offset,
+                                     std::size_t limit,
+                                     std::size_t &length) const noexcept;
+        DataBufferStatus DecodeView(std::size_t &offset,
+                                    std::size_t &length) const noexcept;
+        std::size_t ReserveLength(std::size_t width);
+        std::size_t CompleteLength(std::size_t offset,
+                                   std::size_t width,
+                                   std::uint64_t maximum);
 };
 
 } // namespace Terra::NetUtil
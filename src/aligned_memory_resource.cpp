@@ -0,0 +1,330 @@
+/*
+ *  aligned_memory_resource.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements the AlignedMemoryResource object.
+ *
+ *      Allocations that do not use huge pages are made with the aligned form
+ *      of operator new.  Allocations that use huge pages are mapped directly
+ *      with mmap() and their size is rounded up to a multiple of the huge page
+ *      size.  Since the same options and requested alignment are given when
+ *      memory is deallocated, whether huge pages were used is determined
+ *      again from the allocation size, rather than being recorded.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <new>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+#include <terra/netutil/aligned_memory_resource.h>
+
+namespace Terra::NetUtil
+{
+
+namespace
+{
+
+// Size of a huge page (the size used for transparent huge pages)
+constexpr std::size_t Huge_Page_Size = 2097152;
+
+// Stride at which memory is touched to prefault it (smallest page size)
+constexpr std::size_t Prefault_Stride = 4096;
+
+/*
+ *  RoundUp()
+ *
+ *  Description:
+ *      Round the given value up to a multiple of the given power of two.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to round up.
+ *
+ *      multiple [in]
+ *          The power of two to which the value should be rounded.
+ *
+ *  Returns:
+ *      The rounded value.
+ *
+ *  Comments:
+ *      None.
+ */
+constexpr std::size_t RoundUp(std::size_t value, std::size_t multiple)
+{
+    return (value + multiple - 1) & ~(multiple - 1);
+}
+
+/*
+ *  Prefault()
+ *
+ *  Description:
+ *      Touch each page of the given memory so that the operating system
+ *      allocates physical memory for it.
+ *
+ *  Parameters:
+ *      memory [in]
+ *          The memory to prefault.
+ *
+ *      size [in]
+ *          The size of the memory.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      The contents of the memory are unspecified after allocation, so they
+ *      are simply overwritten with zero.
+ */
+void Prefault(void *memory, std::size_t size)
+{
+    auto *octets = static_cast<volatile std::uint8_t *>(memory);
+
+    for (std::size_t i = 0; i < size; i += Prefault_Stride) octets[i] = 0;
+}
+
+#ifdef __linux__
+
+/*
+ *  MapHugePages()
+ *
+ *  Description:
+ *      Map memory backed by huge pages.  Explicitly reserved huge pages are
+ *      used if available.  Otherwise, the memory is aligned to the huge page
+ *      size and transparent huge pages are requested.
+ *
+ *  Parameters:
+ *      size [in]
+ *          The size of the memory to map.  This must be a multiple of the
+ *          huge page size.
+ *
+ *      alignment [in]
+ *          The required alignment of the memory.
+ *
+ *      prefault [in]
+ *          True if the memory should be prefaulted.
+ *
+ *  Returns:
+ *      A pointer to the mapped memory or nullptr on failure.
+ *
+ *  Comments:
+ *      None.
+ */
+void *MapHugePages(std::size_t size, std::size_t alignment, bool prefault)
+{
+    // Explicitly reserved huge pages are aligned to the huge page size
+    if (alignment <= Huge_Page_Size)
+    {
+        void *memory = mmap(nullptr,
+                            size,
+                            PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                                (prefault ? MAP_POPULATE : 0),
+                            -1,
+                            0);
+        if (memory != MAP_FAILED) return memory;
+    }
+
+    // Map enough memory to align the start to at least the huge page size
+    alignment = std::max(alignment, Huge_Page_Size);
+    const std::size_t reserved = size + alignment;
+    void *address = mmap(nullptr,
+                         reserved,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS,
+                         -1,
+                         0);
+    if (address == MAP_FAILED) return nullptr;
+
+    // Unmap the unused memory preceding and following the aligned memory
+    auto *start = static_cast<std::uint8_t *>(address);
+    auto *memory = reinterpret_cast<std::uint8_t *>(
+        RoundUp(reinterpret_cast<std::uintptr_t>(start), alignment));
+    const auto head = static_cast<std::size_t>(memory - start);
+    if (head > 0) munmap(start, head);
+    if (reserved > head + size) munmap(memory + size, reserved - head - size);
+
+    // Request transparent huge pages, which is only a hint
+    madvise(memory, size, MADV_HUGEPAGE);
+
+    if (prefault) Prefault(memory, size);
+
+    return memory;
+}
+
+#endif
+
+} // namespace
+
+/*
+ *  AlignedMemoryResource::AlignedMemoryResource()
+ *
+ *  Description:
+ *      Constructor for the AlignedMemoryResource object.
+ *
+ *  Parameters:
+ *      options [in]
+ *          Options controlling how memory is allocated.  The alignment is
+ *          rounded up to a power of two no smaller than
+ *          alignof(std::max_align_t).
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+AlignedMemoryResource::AlignedMemoryResource(AlignedMemoryOptions options) :
+    options{options}
+{
+    this->options.alignment = std::max(std::bit_ceil(options.alignment),
+                                       alignof(std::max_align_t));
+}
+
+/*
+ *  AlignedMemoryResource::do_allocate()
+ *
+ *  Description:
+ *      Allocate memory of the given size.
+ *
+ *  Parameters:
+ *      bytes [in]
+ *          The size of the memory to allocate.
+ *
+ *      alignment [in]
+ *          The alignment requested by the caller.  The memory is aligned to
+ *          the larger of this and the alignment given in the options.
+ *
+ *  Returns:
+ *      A pointer to the allocated memory.  An exception of std::bad_alloc is
+ *      thrown if memory allocation fails.
+ *
+ *  Comments:
+ *      None.
+ */
+void *AlignedMemoryResource::do_allocate(std::size_t bytes,
+                                         std::size_t alignment)
+{
+    alignment = std::max(alignment, options.alignment);
+
+#ifdef __linux__
+    if (UseHugePages(bytes))
+    {
+        void *memory = MapHugePages(RoundUp(bytes, Huge_Page_Size),
+                                    alignment,
+                                    options.prefault);
+        if (memory == nullptr) throw std::bad_alloc();
+
+        return memory;
+    }
+#endif
+
+    void *memory = ::operator new(bytes, std::align_val_t(alignment));
+
+    if (options.prefault) Prefault(memory, bytes);
+
+    return memory;
+}
+
+/*
+ *  AlignedMemoryResource::do_deallocate()
+ *
+ *  Description:
+ *      Deallocate memory previously allocated by this object.
+ *
+ *  Parameters:
+ *      memory [in]
+ *          The memory to deallocate.
+ *
+ *      bytes [in]
+ *          The size of the memory as given when allocated.
+ *
+ *      alignment [in]
+ *          The alignment as given when allocated.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void AlignedMemoryResource::do_deallocate(void *memory,
+                                          std::size_t bytes,
+                                          std::size_t alignment)
+{
+    alignment = std::max(alignment, options.alignment);
+
+#ifdef __linux__
+    if (UseHugePages(bytes))
+    {
+        munmap(memory, RoundUp(bytes, Huge_Page_Size));
+        return;
+    }
+#endif
+
+    ::operator delete(memory, bytes, std::align_val_t(alignment));
+}
+
+/*
+ *  AlignedMemoryResource::do_is_equal()
+ *
+ *  Description:
+ *      Determine whether memory allocated by this object may be deallocated
+ *      by the other memory resource and vice versa.
+ *
+ *  Parameters:
+ *      other [in]
+ *          The other memory resource.
+ *
+ *  Returns:
+ *      True only if the other memory resource is this object.
+ *
+ *  Comments:
+ *      None.
+ */
+bool AlignedMemoryResource::do_is_equal(
+    const std::pmr::memory_resource &other) const noexcept
+{
+    return this == &other;
+}
+
+/*
+ *  AlignedMemoryResource::UseHugePages()
+ *
+ *  Description:
+ *      Determine whether an allocation of the given size uses huge pages.
+ *
+ *  Parameters:
+ *      bytes [in]
+ *          The size of the allocation.
+ *
+ *  Returns:
+ *      True if the allocation uses huge pages.
+ *
+ *  Comments:
+ *      Huge pages are only used on Linux.
+ */
+bool AlignedMemoryResource::UseHugePages(std::size_t bytes) const
+{
+#ifdef __linux__
+    return options.huge_pages && (bytes > 0) &&
+           (bytes >= options.huge_page_threshold);
+#else
+    static_cast<void>(bytes);
+    return false;
+#endif
+}
+
+} // namespace Terra::NetUtil
@@ -0,0 +1,815 @@
+/*
+ *  base64.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements functions to encode data as base64 text and to
+ *      decode such text into a DataBuffer.
+ *
+ *      The scalar functions use lookup tables giving the character for each
+ *      6-bit value and the value of each character.  The vectorized encoding
+ *      functions rearrange each group of three octets into four 6-bit values
+ *      and translate those values into characters, while the vectorized
+ *      decoding functions convert characters to values by range comparisons
+ *      and then pack each group of four values into three octets.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <array>
+#include <terra/netutil/base64.h>
+#include "cpu_features.h"
+
+namespace Terra::NetUtil
+{
+
+namespace
+{
+
+// Characters of the standard and URL and filename safe alphabets
+constexpr std::string_view Standard_Alphabet =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr std::string_view URL_Alphabet =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// Produce a table giving the value of each character, or -1 for characters
+// outside of the alphabet
+constexpr auto MakeDecodeTable(std::string_view alphabet)
+{
+    std::array<std::int8_t, 256> values{};
+
+    values.fill(-1);
+    for (std::size_t i = 0; i < alphabet.size(); i++)
+    {
+        values[static_cast<unsigned char>(alphabet[i])] =
+            static_cast<std::int8_t>(i);
+    }
+
+    return values;
+}
+
+// Tables giving the value of each character
+constexpr auto Standard_Values = MakeDecodeTable(Standard_Alphabet);
+constexpr auto URL_Values = MakeDecodeTable(URL_Alphabet);
+
+/*
+ *  DecodedLength()
+ *
+ *  Description:
+ *      Determine the number of characters of base64 text that carry data
+ *      and the number of octets they represent.
+ *
+ *  Parameters:
+ *      text [in]
+ *          The base64 text, with or without padding.
+ *
+ *      characters [out]
+ *          The number of characters excluding any padding.
+ *
+ *  Returns:
+ *      The number of octets represented by the text.  An exception is thrown
+ *      if the padding or the length of the text is invalid.
+ *
+ *  Comments:
+ *      Padding characters anywhere other than at the end of the text are
+ *      rejected as invalid characters when decoding.
+ */
+std::size_t DecodedLength(std::string_view text, std::size_t &characters)
+{
+    std::size_t padding = 0;
+
+    while ((padding < 2) && (padding < text.size()) &&
+           (text[text.size() - padding - 1] == '='))
+    {
+        padding++;
+    }
+
+    // Padded text must be a complete group of four characters
+    if ((padding > 0) && ((text.size() % 4) != 0))
+    {
+        throw DataBufferException("Invalid base64 padding");
+    }
+
+    characters = text.size() - padding;
+
+    // A single character cannot represent a complete octet
+    if ((characters % 4) == 1)
+    {
+        throw DataBufferException("Invalid base64 text length");
+    }
+
+    return ((characters / 4) * 3) + (((characters % 4) * 3) / 4);
+}
+
+/*
+ *  EncodeScalar()
+ *
+ *  Description:
+ *      Encode groups of three octets as base64 text using a lookup table.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The octets to encode.
+ *
+ *      groups [in]
+ *          The number of groups of three octets to encode.
+ *
+ *      output [out]
+ *          The buffer into which four characters per group are written.
+ *
+ *      alphabet [in]
+ *          The characters of the alphabet to use.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void EncodeScalar(const std::uint8_t *data,
+                  std::size_t groups,
+                  char *output,
+                  std::string_view alphabet)
+{
+    for (std::size_t i = 0; i < groups; i++, data += 3, output += 4)
+    {
+        std::uint32_t value = (std::uint32_t(data[0]) << 16) |
+                              (std::uint32_t(data[1]) << 8) | data[2];
+
+        output[0] = alphabet[(value >> 18) & 0x3f];
+        output[1] = alphabet[(value >> 12) & 0x3f];
+        output[2] = alphabet[(value >> 6) & 0x3f];
+        output[3] = alphabet[value & 0x3f];
+    }
+}
+
+/*
+ *  DecodeScalar()
+ *
+ *  Description:
+ *      Decode groups of four base64 characters using a lookup table.
+ *
+ *  Parameters:
+ *      text [in]
+ *          The characters to decode.
+ *
+ *      groups [in]
+ *          The number of groups of four characters to decode.
+ *
+ *      octets [out]
+ *          The buffer into which three octets per group are written.
+ *
+ *      values [in]
+ *          The table giving the value of each character.
+ *
+ *  Returns:
+ *      True if all characters were in the alphabet, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+bool DecodeScalar(const char *text,
+                  std::size_t groups,
+                  std::uint8_t *octets,
+                  const std::array<std::int8_t, 256> &values)
+{
+    std::int32_t invalid = 0;
+
+    for (std::size_t i = 0; i < groups; i++, text += 4, octets += 3)
+    {
+        std::int32_t v0 = values[static_cast<unsigned char>(text[0])];
+        std::int32_t v1 = values[static_cast<unsigned char>(text[1])];
+        std::int32_t v2 = values[static_cast<unsigned char>(text[2])];
+        std::int32_t v3 = values[static_cast<unsigned char>(text[3])];
+        std::int32_t value = (v0 << 18) | (v1 << 12) | (v2 << 6) | v3;
+
+        // Any invalid character sets the sign bit of the combined value
+        invalid |= value;
+
+        octets[0] = static_cast<std::uint8_t>(value >> 16);
+        octets[1] = static_cast<std::uint8_t>(value >> 8);
+        octets[2] = static_cast<std::uint8_t>(value);
+    }
+
+    return invalid >= 0;
+}
+
+#ifdef NETUTIL_X86_SIMD
+
+/*
+ *  EncodeAVX2()
+ *
+ *  Description:
+ *      Encode groups of 24 octets as base64 text using AVX2 instructions.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The octets to encode.
+ *
+ *      length [in]
+ *          The number of octets available to read.
+ *
+ *      output [out]
+ *          The buffer into which 32 characters per group are written.
+ *
+ *      url [in]
+ *          True if the URL and filename safe alphabet is to be used.
+ *
+ *  Returns:
+ *      The number of octets encoded, which is a multiple of 24.
+ *
+ *  Comments:
+ *      Each group is loaded as two overlapping 16-octet reads, so a group is
+ *      encoded only if at least 28 octets remain to be read.
+ */
+__attribute__((target("avx2")))
+std::size_t EncodeAVX2(const std::uint8_t *data,
+                       std::size_t length,
+                       char *output,
+                       bool url)
+{
+    // Place the three octets of each group in the order 1, 0, 2, 1
+    const __m256i shuffle = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+    // Offsets added to each value, selected by the range of the value
+    const std::int8_t plus = url ? '-' - 62 : '+' - 62;
+    const std::int8_t slash = url ? '_' - 63 : '/' - 63;
+    const __m256i offsets = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, plus, slash,
+        'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, plus, slash,
+        'A', 0, 0);
+
+    std::size_t encoded = 0;
+
+    for (; (length - encoded) >= 28; encoded += 24, output += 32)
+    {
+        __m256i in = _mm256_set_m128i(
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(data + encoded + 12)),
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(data + encoded)));
+
+        in = _mm256_shuffle_epi8(in, shuffle);
+
+        // Move each 6-bit value into its own octet
+        __m256i high = _mm256_mulhi_epu16(
+            _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)),
+            _mm256_set1_epi32(0x04000040));
+        __m256i low = _mm256_mullo_epi16(
+            _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)),
+            _mm256_set1_epi32(0x01000010));
+        __m256i values = _mm256_or_si256(high, low);
+
+        // Map values 0-25 to 13, 26-51 to 0, 52-61 to 1-10, 62 to 11, and
+        // 63 to 12 to select the offset
+        __m256i range = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+        range = _mm256_or_si256(
+            range,
+            _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), values),
+                             _mm256_set1_epi8(13)));
+
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i *>(output),
+            _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, range)));
+    }
+
+    return encoded;
+}
+
+/*
+ *  DecodeAVX2()
+ *
+ *  Description:
+ *      Decode groups of 32 base64 characters using AVX2 instructions.
+ *
+ *  Parameters:
+ *      text [in]
+ *          The characters to decode.
+ *
+ *      groups [in]
+ *          The number of groups of 32 characters to decode.
+ *
+ *      octets [out]
+ *          The buffer into which 24 octets per group are written.
+ *
+ *      url [in]
+ *          True if the URL and filename safe alphabet is to be used.
+ *
+ *  Returns:
+ *      True if all characters were in the alphabet, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+__attribute__((target("avx2")))
+bool DecodeAVX2(const char *text,
+                std::size_t groups,
+                std::uint8_t *octets,
+                bool url)
+{
+    const __m256i upper_a = _mm256_set1_epi8('A');
+    const __m256i lower_a = _mm256_set1_epi8('a');
+    const __m256i zero_digit = _mm256_set1_epi8('0');
+    const __m256i plus = _mm256_set1_epi8(url ? '-' : '+');
+    const __m256i slash = _mm256_set1_epi8(url ? '_' : '/');
+    const __m256i twenty_five = _mm256_set1_epi8(25);
+    const __m256i nine = _mm256_set1_epi8(9);
+
+    // Place the three octets of each 32-bit lane in big endian order
+    const __m256i shuffle = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i permute = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+    __m256i valid = _mm256_set1_epi8(-1);
+
+    for (std::size_t i = 0; i < groups; i++, text += 32, octets += 24)
+    {
+        __m256i in =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(text));
+
+        // Determine the value of each character by its range
+        __m256i upper = _mm256_sub_epi8(in, upper_a);
+        __m256i is_upper =
+            _mm256_cmpeq_epi8(_mm256_min_epu8(upper, twenty_five), upper);
+        __m256i lower = _mm256_sub_epi8(in, lower_a);
+        __m256i is_lower =
+            _mm256_cmpeq_epi8(_mm256_min_epu8(lower, twenty_five), lower);
+        __m256i digit = _mm256_sub_epi8(in, zero_digit);
+        __m256i is_digit =
+            _mm256_cmpeq_epi8(_mm256_min_epu8(digit, nine), digit);
+        __m256i is_plus = _mm256_cmpeq_epi8(in, plus);
+        __m256i is_slash = _mm256_cmpeq_epi8(in, slash);
+
+        valid = _mm256_and_si256(
+            valid,
+            _mm256_or_si256(_mm256_or_si256(is_upper, is_lower),
+                            _mm256_or_si256(_mm256_or_si256(is_digit,
+                                                            is_plus),
+                                            is_slash)));
+
+        __m256i values = _mm256_or_si256(
+            _mm256_or_si256(
+                _mm256_and_si256(upper, is_upper),
+                _mm256_and_si256(
+                    _mm256_add_epi8(lower, _mm256_set1_epi8(26)),
+                    is_lower)),
+            _mm256_or_si256(
+                _mm256_and_si256(
+                    _mm256_add_epi8(digit, _mm256_set1_epi8(52)),
+                    is_digit),
+                _mm256_or_si256(
+                    _mm256_and_si256(_mm256_set1_epi8(62), is_plus),
+                    _mm256_and_si256(_mm256_set1_epi8(63), is_slash))));
+
+        // Pack each group of four 6-bit values into a 24-bit value
+        values = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        values = _mm256_madd_epi16(values, _mm256_set1_epi32(0x00011000));
+
+        // Gather the 24 octets into the low part of the register
+        values = _mm256_permutevar8x32_epi32(
+            _mm256_shuffle_epi8(values, shuffle),
+            permute);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(octets),
+                         _mm256_castsi256_si128(values));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(octets + 16),
+                         _mm256_extracti128_si256(values, 1));
+    }
+
+    return _mm256_movemask_epi8(valid) == -1;
+}
+
+#endif // NETUTIL_X86_SIMD
+
+#if defined(NETUTIL_ARM_SIMD) && defined(__aarch64__)
+
+/*
+ *  EncodeNEON()
+ *
+ *  Description:
+ *      Encode groups of 48 octets as base64 text using NEON instructions.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The octets to encode.
+ *
+ *      groups [in]
+ *          The number of groups of 48 octets to encode.
+ *
+ *      output [out]
+ *          The buffer into which 64 characters per group are written.
+ *
+ *      alphabet [in]
+ *          The characters of the alphabet to use.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void EncodeNEON(const std::uint8_t *data,
+                std::size_t groups,
+                char *output,
+                std::string_view alphabet)
+{
+    const auto *characters =
+        reinterpret_cast<const std::uint8_t *>(alphabet.data());
+    const uint8x16x4_t table = {vld1q_u8(characters),
+                                vld1q_u8(characters + 16),
+                                vld1q_u8(characters + 32),
+                                vld1q_u8(characters + 48)};
+    const uint8x16_t six_bits = vdupq_n_u8(0x3f);
+
+    for (std::size_t i = 0; i < groups; i++, data += 48, output += 64)
+    {
+        // Load 48 octets, separating the octets of each group of three
+        uint8x16x3_t in = vld3q_u8(data);
+        uint8x16x4_t out;
+
+        out.val[0] = vshrq_n_u8(in.val[0], 2);
+        out.val[1] = vandq_u8(vsliq_n_u8(vshrq_n_u8(in.val[1], 4),
+                                         in.val[0],
+                                         4),
+                              six_bits);
+        out.val[2] = vandq_u8(vsliq_n_u8(vshrq_n_u8(in.val[2], 6),
+                                         in.val[1],
+                                         2),
+                              six_bits);
+        out.val[3] = vandq_u8(in.val[2], six_bits);
+
+        for (auto &values : out.val) values = vqtbl4q_u8(table, values);
+
+        vst4q_u8(reinterpret_cast<std::uint8_t *>(output), out);
+    }
+}
+
+/*
+ *  DecodeNEON()
+ *
+ *  Description:
+ *      Decode groups of 64 base64 characters using NEON instructions.
+ *
+ *  Parameters:
+ *      text [in]
+ *          The characters to decode.
+ *
+ *      groups [in]
+ *          The number of groups of 64 characters to decode.
+ *
+ *      octets [out]
+ *          The buffer into which 48 octets per group are written.
+ *
+ *      url [in]
+ *          True if the URL and filename safe alphabet is to be used.
+ *
+ *  Returns:
+ *      True if all characters were in the alphabet, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+bool DecodeNEON(const char *text,
+                std::size_t groups,
+                std::uint8_t *octets,
+                bool url)
+{
+    const uint8x16_t upper_a = vdupq_n_u8('A');
+    const uint8x16_t lower_a = vdupq_n_u8('a');
+    const uint8x16_t zero_digit = vdupq_n_u8('0');
+    const uint8x16_t plus = vdupq_n_u8(url ? '-' : '+');
+    const uint8x16_t slash = vdupq_n_u8(url ? '_' : '/');
+    const uint8x16_t twenty_five = vdupq_n_u8(25);
+    const uint8x16_t nine = vdupq_n_u8(9);
+
+    // Convert 16 characters to their values, noting any invalid characters
+    auto convert = [&](uint8x16_t v, uint8x16_t &valid)
+    {
+        uint8x16_t upper = vsubq_u8(v, upper_a);
+        uint8x16_t is_upper = vcleq_u8(upper, twenty_five);
+        uint8x16_t lower = vsubq_u8(v, lower_a);
+        uint8x16_t is_lower = vcleq_u8(lower, twenty_five);
+        uint8x16_t digit = vsubq_u8(v, zero_digit);
+        uint8x16_t is_digit = vcleq_u8(digit, nine);
+        uint8x16_t is_plus = vceqq_u8(v, plus);
+        uint8x16_t is_slash = vceqq_u8(v, slash);
+
+        valid = vandq_u8(valid,
+                         vorrq_u8(vorrq_u8(is_upper, is_lower),
+                                  vorrq_u8(vorrq_u8(is_digit, is_plus),
+                                           is_slash)));
+
+        uint8x16_t values = vandq_u8(upper, is_upper);
+        values = vbslq_u8(is_lower, vaddq_u8(lower, vdupq_n_u8(26)), values);
+        values = vbslq_u8(is_digit, vaddq_u8(digit, vdupq_n_u8(52)), values);
+        values = vbslq_u8(is_plus, vdupq_n_u8(62), values);
+
+        return vbslq_u8(is_slash, vdupq_n_u8(63), values);
+    };
+
+    uint8x16_t valid = vdupq_n_u8(0xff);
+
+    for (std::size_t i = 0; i < groups; i++, text += 64, octets += 48)
+    {
+        // Load 64 characters, separating the characters of each group of
+        // four
+        uint8x16x4_t in =
+            vld4q_u8(reinterpret_cast<const std::uint8_t *>(text));
+        uint8x16_t v0 = convert(in.val[0], valid);
+        uint8x16_t v1 = convert(in.val[1], valid);
+        uint8x16_t v2 = convert(in.val[2], valid);
+        uint8x16_t v3 = convert(in.val[3], valid);
+        uint8x16x3_t out;
+
+        out.val[0] = vorrq_u8(vshlq_n_u8(v0, 2), vshrq_n_u8(v1, 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(v1, 4), vshrq_n_u8(v2, 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(v2, 6), v3);
+
+        vst3q_u8(octets, out);
+    }
+
+    return vminvq_u8(valid) == 0xff;
+}
+
+#endif // NETUTIL_ARM_SIMD && __aarch64__
+
+} // namespace
+
+/*
+ *  Base64EncodedLength()
+ *
+ *  Description:
+ *      Determine the number of characters required to encode data of the
+ *      given length as base64 text.
+ *
+ *  Parameters:
+ *      length [in]
+ *          The length of the data.
+ *
+ *      padding [in]
+ *          True if the text is padded to a multiple of four characters.
+ *
+ *  Returns:
+ *      The number of characters in the encoded text.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t Base64EncodedLength(std::size_t length, bool padding)
+{
+    if (padding) return ((length + 2) / 3) * 4;
+
+    return ((length / 3) * 4) + (((length % 3) * 4) + 2) / 3;
+}
+
+/*
+ *  Base64Encode()
+ *
+ *  Description:
+ *      Encode the given data as base64 text.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data to encode.
+ *
+ *      output [out]
+ *          The buffer into which the text is written.  This must be at least
+ *          Base64EncodedLength() characters in length.
+ *
+ *      alphabet [in]
+ *          The alphabet to use.  This defaults to the standard alphabet.
+ *
+ *      padding [in]
+ *          True if the text is to be padded to a multiple of four characters.
+ *          This defaults to true.
+ *
+ *  Returns:
+ *      The number of characters written.  An exception is thrown if the
+ *      output buffer is too small.
+ *
+ *  Comments:
+ *      The output is not terminated with a null character.
+ */
+std::size_t Base64Encode(std::span<const std::uint8_t> data,
+                         std::span<char> output,
+                         Base64Alphabet alphabet,
+                         bool padding)
+{
+    const bool url = (alphabet == Base64Alphabet::URL);
+    const std::string_view characters = url ? URL_Alphabet : Standard_Alphabet;
+    const std::size_t length = Base64EncodedLength(data.size(), padding);
+    const std::uint8_t *p = data.data();
+    char *q = output.data();
+    std::size_t encoded = 0;
+
+    if (output.size() < length)
+    {
+        throw DataBufferException("Base64 output buffer is too small");
+    }
+
+    // Encode groups of octets using vector instructions, if possible
+#if defined(NETUTIL_X86_SIMD)
+    if (HasAVX2()) encoded = EncodeAVX2(p, data.size(), q, url);
+#elif defined(NETUTIL_ARM_SIMD) && defined(__aarch64__)
+    encoded = data.size() - (data.size() % 48);
+    EncodeNEON(p, encoded / 48, q, characters);
+#endif
+
+    // Encode the remaining complete groups of three octets
+    EncodeScalar(p + encoded,
+                 (data.size() - encoded) / 3,
+                 q + ((encoded / 3) * 4),
+                 characters);
+    encoded = data.size() - (data.size() % 3);
+    q += (encoded / 3) * 4;
+
+    // Encode any final one or two octets
+    if (encoded < data.size())
+    {
+        std::uint32_t value = std::uint32_t(p[encoded]) << 16;
+        const bool two = ((data.size() - encoded) == 2);
+
+        if (two) value |= std::uint32_t(p[encoded + 1]) << 8;
+
+        *q++ = characters[(value >> 18) & 0x3f];
+        *q++ = characters[(value >> 12) & 0x3f];
+        if (two) *q++ = characters[(value >> 6) & 0x3f];
+        if (padding)
+        {
+            if (!two) *q++ = '=';
+            *q++ = '=';
+        }
+    }
+
+    return length;
+}
+
+/*
+ *  Base64Encode()
+ *
+ *  Description:
+ *      Encode the unread portion of the given DataBuffer as base64 text.
+ *
+ *  Parameters:
+ *      data_buffer [in]
+ *          The DataBuffer containing the data to encode.
+ *
+ *      alphabet [in]
+ *          The alphabet to use.  This defaults to the standard alphabet.
+ *
+ *      padding [in]
+ *          True if the text is to be padded to a multiple of four characters.
+ *          This defaults to true.
+ *
+ *  Returns:
+ *      The base64 text.
+ *
+ *  Comments:
+ *      The read position of the DataBuffer is not changed.
+ */
+std::string Base64Encode(const DataBuffer &data_buffer,
+                         Base64Alphabet alphabet,
+                         bool padding)
+{
+    std::span<const std::uint8_t> data = data_buffer.GetBufferSpan();
+    std::string text(Base64EncodedLength(data.size(), padding), '\0');
+
+    Base64Encode(data, text, alphabet, padding);
+
+    return text;
+}
+
+/*
+ *  Base64Decode()
+ *
+ *  Description:
+ *      Decode the given base64 text.
+ *
+ *  Parameters:
+ *      text [in]
+ *          The base64 text to decode, with or without padding.
+ *
+ *      alphabet [in]
+ *          The alphabet to use.  This defaults to the standard alphabet.
+ *
+ *  Returns:
+ *      A DataBuffer containing the decoded octets.  An exception is thrown if
+ *      the text is not valid base64 text.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBuffer Base64Decode(std::string_view text, Base64Alphabet alphabet)
+{
+    std::size_t characters{};
+    DataBuffer data_buffer(DecodedLength(text, characters));
+
+    Base64Decode(text, data_buffer, alphabet);
+
+    return data_buffer;
+}
+
+/*
+ *  Base64Decode()
+ *
+ *  Description:
+ *      Decode the given base64 text, appending the decoded octets to the
+ *      data in the given DataBuffer.
+ *
+ *  Parameters:
+ *      text [in]
+ *          The base64 text to decode, with or without padding.
+ *
+ *      data_buffer [in/out]
+ *          The DataBuffer to which the decoded octets are appended.  If the
+ *          DataBuffer is growable, it will be grown as necessary.
+ *
+ *      alphabet [in]
+ *          The alphabet to use.  This defaults to the standard alphabet.
+ *
+ *  Returns:
+ *      The number of octets appended.  An exception is thrown if the text is
+ *      not valid base64 text or the DataBuffer has insufficient free space,
+ *      in which case the data length of the DataBuffer is not changed.
+ *
+ *  Comments:
+ *      The octets are decoded directly into the free space of the DataBuffer.
+ */
+std::size_t Base64Decode(std::string_view text,
+                         DataBuffer &data_buffer,
+                         Base64Alphabet alphabet)
+{
+    const bool url = (alphabet == Base64Alphabet::URL);
+    const auto &values = url ? URL_Values : Standard_Values;
+    std::size_t characters{};
+    const std::size_t length = DecodedLength(text, characters);
+    std::size_t decoded = 0;
+    bool valid = true;
+
+    if (length == 0) return 0;
+
+    std::uint8_t *octets = data_buffer.GetFreeSpan(length).data();
+
+    // Decode groups of characters using vector instructions, if possible
+#if defined(NETUTIL_X86_SIMD)
+    if (HasAVX2())
+    {
+        decoded = characters - (characters % 32);
+        valid = DecodeAVX2(text.data(), decoded / 32, octets, url);
+    }
+#elif defined(NETUTIL_ARM_SIMD) && defined(__aarch64__)
+    decoded = characters - (characters % 64);
+    valid = DecodeNEON(text.data(), decoded / 64, octets, url);
+#endif
+
+    // Decode the remaining complete groups of four characters
+    if (valid)
+    {
+        valid = DecodeScalar(text.data() + decoded,
+                             (characters - decoded) / 4,
+                             octets + ((decoded / 4) * 3),
+                             values);
+        decoded = characters - (characters % 4);
+    }
+
+    // Decode any final two or three characters
+    if (valid && (decoded < characters))
+    {
+        std::int32_t value = 0;
+
+        for (std::size_t i = decoded; i < characters; i++)
+        {
+            value |= values[static_cast<unsigned char>(text[i])] <<
+                     (18 - ((i - decoded) * 6));
+        }
+        valid = (value >= 0);
+
+        octets += (decoded / 4) * 3;
+        octets[0] = static_cast<std::uint8_t>(value >> 16);
+        if ((characters - decoded) == 3)
+        {
+            octets[1] = static_cast<std::uint8_t>(value >> 8);
+        }
+    }
+
+    if (!valid) throw DataBufferException("Invalid base64 character");
+
+    data_buffer.AdvanceDataLength(length);
+
+    return length;
+}
+
+} // namespace Terra::NetUtil
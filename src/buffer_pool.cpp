@@ -0,0 +1,655 @@
+/*
+ *  buffer_pool.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements the BufferPool object.  A BufferPool maintains
+ *      free lists of memory blocks grouped into size classes so that
+ *      memory used for buffers may be reused rather than repeatedly allocated
+ *      from and returned to the heap.
+ *
+ *      The state of the pool is held in a shared PoolState object.  Each
+ *      thread maintains a list of caches, one per BufferPool it has used,
+ *      that refer to the PoolState only weakly.  This allows a BufferPool to
+ *      be destroyed while threads that used it continue to run: a thread
+ *      will discover that a pool no longer exists when the cache is next
+ *      inspected or when the thread exits and will free the cached blocks.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <terra/netutil/buffer_pool.h>
+
+namespace Terra::NetUtil
+{
+
+// Shared state of a BufferPool
+struct BufferPool::PoolState
+{
+    // Free list and statistics for a single size class
+    struct SizeClass
+    {
+        std::vector<std::uint8_t *> free_blocks;    // Guarded by mutex
+        std::atomic<std::uint64_t> hits{0};
+        std::atomic<std::uint64_t> misses{0};
+        std::atomic<std::size_t> blocks_outstanding{0};
+    };
+
+    // Blocks cached by a single thread for a single pool
+    struct ThreadCache
+    {
+        std::weak_ptr<PoolState> pool;
+        const PoolState *owner;
+        std::vector<std::vector<std::uint8_t *>> free_blocks;
+    };
+
+    // All of the caches held by a single thread
+    struct ThreadCacheList
+    {
+        ~ThreadCacheList();
+
+        std::vector<ThreadCache> caches;
+    };
+
+    PoolState(std::size_t minimum_block_size,
+              std::size_t maximum_block_size,
+              std::size_t thread_cache_blocks);
+    ~PoolState();
+
+    std::size_t GetSizeClass(std::size_t size) const;
+    std::size_t GetClassBlockSize(std::size_t size_class) const;
+    void ReturnBlocks(std::size_t size_class,
+                      std::vector<std::uint8_t *> &blocks,
+                      std::size_t count);
+    static ThreadCache *GetThreadCache(
+                                const std::shared_ptr<PoolState> &pool_state);
+    static void FreeBlocks(ThreadCache &thread_cache);
+
+    std::size_t minimum_shift;                  // log2(minimum block size)
+    std::size_t maximum_block_size;             // Largest pooled block size
+    std::size_t thread_cache_blocks;            // Blocks per thread and class
+    std::size_t class_count;                    // Number of size classes
+    std::unique_ptr<SizeClass[]> size_classes;  // Size class information
+    std::mutex mutex;                           // Guards shared free lists
+    std::atomic<std::uint64_t> oversize_misses; // Allocations beyond classes
+    std::atomic<std::size_t> bytes_outstanding; // Bytes not yet released
+};
+
+namespace
+{
+
+// Indicates that this thread's cache list has been destroyed
+thread_local bool thread_cache_destroyed = false;
+
+} // namespace
+
+/*
+ *  BufferPool::PoolState::PoolState()
+ *
+ *  Description:
+ *      Constructor for the PoolState object.
+ *
+ *  Parameters:
+ *      minimum_block_size [in]
+ *          The smallest block size, which will be rounded up to a power of
+ *          two if necessary.
+ *
+ *      maximum_block_size [in]
+ *          The largest block size, which will be rounded up to a power of
+ *          two if necessary.
+ *
+ *      thread_cache_blocks [in]
+ *          The maximum number of free blocks each thread will cache per
+ *          size class.
+ *
+ *  Returns:
+ *      Nothing.  An exception of std::invalid_argument will be thrown if the
+ *      arguments are invalid.
+ *
+ *  Comments:
+ *      None.
+ */
+BufferPool::PoolState::PoolState(std::size_t minimum_block_size,
+                                 std::size_t maximum_block_size,
+                                 std::size_t thread_cache_blocks) :
+    minimum_shift{0},
+    maximum_block_size{0},
+    thread_cache_blocks{thread_cache_blocks},
+    class_count{0},
+    oversize_misses{0},
+    bytes_outstanding{0}
+{
+    // Ensure the parameters are sane
+    if ((minimum_block_size == 0) ||
+        (minimum_block_size > maximum_block_size) ||
+        (maximum_block_size > (std::numeric_limits<std::size_t>::max() / 2)))
+    {
+        throw std::invalid_argument("Invalid BufferPool block size");
+    }
+
+    // Determine the range of size classes
+    this->maximum_block_size = std::bit_ceil(maximum_block_size);
+    minimum_shift = std::countr_zero(std::bit_ceil(minimum_block_size));
+    class_count =
+        std::countr_zero(this->maximum_block_size) - minimum_shift + 1;
+
+    size_classes = std::make_unique<SizeClass[]>(class_count);
+}
+
+/*
+ *  BufferPool::PoolState::~PoolState()
+ *
+ *  Description:
+ *      Destructor for the PoolState object, which frees all blocks in the
+ *      shared free lists.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+BufferPool::PoolState::~PoolState()
+{
+    for (std::size_t i = 0; i < class_count; i++)
+    {
+        for (std::uint8_t *block : size_classes[i].free_blocks) delete[] block;
+    }
+}
+
+/*
+ *  BufferPool::PoolState::GetSizeClass()
+ *
+ *  Description:
+ *      Determine the size class used for requests of the given size.
+ *
+ *  Parameters:
+ *      size [in]
+ *          The requested size, which must be non-zero and not exceed the
+ *          maximum block size.
+ *
+ *  Returns:
+ *      The index of the size class.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t BufferPool::PoolState::GetSizeClass(std::size_t size) const
+{
+    std::size_t shift = std::bit_width(size - 1);
+
+    return (shift <= minimum_shift) ? 0 : shift - minimum_shift;
+}
+
+/*
+ *  BufferPool::PoolState::GetClassBlockSize()
+ *
+ *  Description:
+ *      Return the size of blocks in the given size class.
+ *
+ *  Parameters:
+ *      size_class [in]
+ *          The index of the size class.
+ *
+ *  Returns:
+ *      The size of blocks in the size class.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t BufferPool::PoolState::GetClassBlockSize(
+                                                std::size_t size_class) const
+{
+    return std::size_t(1) << (minimum_shift + size_class);
+}
+
+/*
+ *  BufferPool::PoolState::ReturnBlocks()
+ *
+ *  Description:
+ *      Move blocks from the end of the given vector to the shared free list.
+ *
+ *  Parameters:
+ *      size_class [in]
+ *          The size class of the blocks.
+ *
+ *      blocks [in/out]
+ *          The blocks from which to take those returned to the free list.
+ *
+ *      count [in]
+ *          The number of blocks to return.  This must not exceed the number
+ *          of blocks in the given vector.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void BufferPool::PoolState::ReturnBlocks(std::size_t size_class,
+                                         std::vector<std::uint8_t *> &blocks,
+                                         std::size_t count)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto &free_blocks = size_classes[size_class].free_blocks;
+
+    free_blocks.insert(free_blocks.end(), blocks.end() - count, blocks.end());
+    blocks.resize(blocks.size() - count);
+}
+
+/*
+ *  BufferPool::PoolState::GetThreadCache()
+ *
+ *  Description:
+ *      Get the calling thread's cache for the given pool, creating it if
+ *      necessary.  Any caches belonging to pools that no longer exist are
+ *      freed along the way.
+ *
+ *  Parameters:
+ *      pool_state [in]
+ *          The pool for which the thread's cache is requested.
+ *
+ *  Returns:
+ *      A pointer to the thread's cache or nullptr if the thread's caches
+ *      have already been destroyed (i.e., the thread is exiting).
+ *
+ *  Comments:
+ *      None.
+ */
+BufferPool::PoolState::ThreadCache *BufferPool::PoolState::GetThreadCache(
+                                const std::shared_ptr<PoolState> &pool_state)
+{
+    // Once destroyed at thread exit, the cache list must not be used
+    if (thread_cache_destroyed) return nullptr;
+
+    static thread_local ThreadCacheList cache_list;
+
+    auto &caches = cache_list.caches;
+
+    for (auto it = caches.begin(); it != caches.end();)
+    {
+        // A cache for a pool that no longer exists is freed and removed
+        if (it->pool.expired())
+        {
+            FreeBlocks(*it);
+            it = caches.erase(it);
+            continue;
+        }
+
+        if (it->owner == pool_state.get()) return &(*it);
+
+        it++;
+    }
+
+    // Create a new cache for this pool
+    caches.push_back({pool_state,
+                      pool_state.get(),
+                      std::vector<std::vector<std::uint8_t *>>(
+                          pool_state->class_count)});
+
+    return &caches.back();
+}
+
+/*
+ *  BufferPool::PoolState::FreeBlocks()
+ *
+ *  Description:
+ *      Free all blocks held in the given thread cache.
+ *
+ *  Parameters:
+ *      thread_cache [in/out]
+ *          The thread cache whose blocks should be freed.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void BufferPool::PoolState::FreeBlocks(ThreadCache &thread_cache)
+{
+    for (auto &blocks : thread_cache.free_blocks)
+    {
+        for (std::uint8_t *block : blocks) delete[] block;
+        blocks.clear();
+    }
+}
+
+/*
+ *  BufferPool::PoolState::ThreadCacheList::~ThreadCacheList()
+ *
+ *  Description:
+ *      Destructor for the ThreadCacheList, called when a thread exits.  Any
+ *      cached blocks are returned to their respective pools or freed if the
+ *      pool no longer exists.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+BufferPool::PoolState::ThreadCacheList::~ThreadCacheList()
+{
+    thread_cache_destroyed = true;
+
+    for (auto &cache : caches)
+    {
+        auto pool_state = cache.pool.lock();
+
+        // If the pool no longer exists, just free the blocks
+        if (!pool_state)
+        {
+            FreeBlocks(cache);
+            continue;
+        }
+
+        // Return the blocks to the pool
+        for (std::size_t i = 0; i < cache.free_blocks.size(); i++)
+        {
+            pool_state->ReturnBlocks(i,
+                                     cache.free_blocks[i],
+                                     cache.free_blocks[i].size());
+        }
+    }
+}
+
+/*
+ *  BufferPool::BufferPool()
+ *
+ *  Description:
+ *      Constructor for the BufferPool object.
+ *
+ *  Parameters:
+ *      minimum_block_size [in]
+ *          The size of blocks in the smallest size class.  This will be
+ *          rounded up to a power of two if necessary.  Smaller requests will
+ *          be satisfied using blocks of this size.
+ *
+ *      maximum_block_size [in]
+ *          The size of blocks in the largest size class.  This will be
+ *          rounded up to a power of two if necessary.  Larger requests will
+ *          be allocated directly from the heap.
+ *
+ *      thread_cache_blocks [in]
+ *          The maximum number of free blocks each thread will cache per
+ *          size class before returning blocks to the shared free list.
+ *
+ *  Returns:
+ *      Nothing.  An exception of std::invalid_argument will be thrown if the
+ *      block sizes are invalid.
+ *
+ *  Comments:
+ *      None.
+ */
+BufferPool::BufferPool(std::size_t minimum_block_size,
+                       std::size_t maximum_block_size,
+                       std::size_t thread_cache_blocks) :
+    state{std::make_shared<PoolState>(minimum_block_size,
+                                      maximum_block_size,
+                                      thread_cache_blocks)}
+{
+}
+
+/*
+ *  BufferPool::~BufferPool()
+ *
+ *  Description:
+ *      Destructor for the BufferPool object.  Blocks in the shared free lists
+ *      are freed immediately, while blocks cached by other threads are freed
+ *      by those threads.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+BufferPool::~BufferPool()
+{
+    // Free blocks cached by this thread now, since they would otherwise
+    // remain until this thread next uses any pool or exits
+    PoolState::ThreadCache *thread_cache = PoolState::GetThreadCache(state);
+    if (thread_cache != nullptr) PoolState::FreeBlocks(*thread_cache);
+}
+
+/*
+ *  BufferPool::Allocate()
+ *
+ *  Description:
+ *      Allocate a block of memory of at least the requested size.
+ *
+ *  Parameters:
+ *      size [in]
+ *          The requested size of the block.
+ *
+ *  Returns:
+ *      A pointer to the allocated block, or nullptr if the requested size
+ *      is zero.  An exception of std::bad_alloc may be thrown if memory
+ *      allocation fails.
+ *
+ *  Comments:
+ *      The returned block will actually be GetBlockSize(size) octets in
+ *      length.
+ */
+std::uint8_t *BufferPool::Allocate(std::size_t size)
+{
+    // Do not allocate anything for zero-length requests
+    if (size == 0) return nullptr;
+
+    // Requests larger than the largest size class are not pooled
+    if (size > state->maximum_block_size)
+    {
+        std::uint8_t *block = new std::uint8_t[size];
+        state->oversize_misses++;
+        state->bytes_outstanding += size;
+        return block;
+    }
+
+    std::size_t size_class = state->GetSizeClass(size);
+    std::size_t block_size = state->GetClassBlockSize(size_class);
+    PoolState::SizeClass &class_info = state->size_classes[size_class];
+    PoolState::ThreadCache *thread_cache = PoolState::GetThreadCache(state);
+    std::uint8_t *block = nullptr;
+
+    if (thread_cache != nullptr)
+    {
+        auto &blocks = thread_cache->free_blocks[size_class];
+
+        // If the thread cache is empty, refill it from the shared free list
+        if (blocks.empty())
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+
+            auto &free_blocks = class_info.free_blocks;
+            std::size_t count = std::min(
+                free_blocks.size(),
+                std::max(state->thread_cache_blocks / 2, std::size_t(1)));
+
+            blocks.insert(blocks.end(), free_blocks.end() - count,
+                          free_blocks.end());
+            free_blocks.resize(free_blocks.size() - count);
+        }
+
+        if (!blocks.empty())
+        {
+            block = blocks.back();
+            blocks.pop_back();
+        }
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+
+        if (!class_info.free_blocks.empty())
+        {
+            block = class_info.free_blocks.back();
+            class_info.free_blocks.pop_back();
+        }
+    }
+
+    // Allocate a new block if a free one was not found
+    if (block == nullptr)
+    {
+        block = new std::uint8_t[block_size];
+        class_info.misses++;
+    }
+    else
+    {
+        class_info.hits++;
+    }
+
+    class_info.blocks_outstanding++;
+    state->bytes_outstanding += block_size;
+
+    return block;
+}
+
+/*
+ *  BufferPool::Release()
+ *
+ *  Description:
+ *      Release a block previously allocated via Allocate().
+ *
+ *  Parameters:
+ *      block [in]
+ *          The block to release.  If nullptr, this function does nothing.
+ *
+ *      size [in]
+ *          The size that was requested when the block was allocated.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void BufferPool::Release(std::uint8_t *block, std::size_t size)
+{
+    if (block == nullptr) return;
+
+    // Blocks larger than the largest size class are not pooled
+    if (size > state->maximum_block_size)
+    {
+        delete[] block;
+        state->bytes_outstanding -= size;
+        return;
+    }
+
+    std::size_t size_class = state->GetSizeClass(size);
+    PoolState::SizeClass &class_info = state->size_classes[size_class];
+    PoolState::ThreadCache *thread_cache = PoolState::GetThreadCache(state);
+
+    class_info.blocks_outstanding--;
+    state->bytes_outstanding -= state->GetClassBlockSize(size_class);
+
+    // If the thread cache is unavailable, use the shared free list
+    if (thread_cache == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        class_info.free_blocks.push_back(block);
+        return;
+    }
+
+    auto &blocks = thread_cache->free_blocks[size_class];
+
+    blocks.push_back(block);
+
+    // If the thread cache is full, return half to the shared free list
+    if (blocks.size() > state->thread_cache_blocks)
+    {
+        state->ReturnBlocks(size_class, blocks, (blocks.size() + 1) / 2);
+    }
+}
+
+/*
+ *  BufferPool::GetBlockSize()
+ *
+ *  Description:
+ *      Return the actual size of the block that would be allocated for a
+ *      request of the given size.
+ *
+ *  Parameters:
+ *      size [in]
+ *          The size of the request.
+ *
+ *  Returns:
+ *      The size of the block that would be allocated.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t BufferPool::GetBlockSize(std::size_t size) const
+{
+    if ((size == 0) || (size > state->maximum_block_size)) return size;
+
+    return state->GetClassBlockSize(state->GetSizeClass(size));
+}
+
+/*
+ *  BufferPool::GetStatistics()
+ *
+ *  Description:
+ *      Return the current BufferPool statistics.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The current statistics, both in total and per size class.  Requests
+ *      larger than the largest size class are counted as misses in the
+ *      total, but are not reflected in the per-class statistics.
+ *
+ *  Comments:
+ *      Since other threads may be using the pool concurrently, the values
+ *      are not necessarily consistent with one another.
+ */
+BufferPoolStatistics BufferPool::GetStatistics() const
+{
+    BufferPoolStatistics statistics{};
+
+    statistics.misses = state->oversize_misses;
+    statistics.bytes_outstanding = state->bytes_outstanding;
+
+    for (std::size_t i = 0; i < state->class_count; i++)
+    {
+        const PoolState::SizeClass &class_info = state->size_classes[i];
+        BufferPoolClassStatistics class_statistics{};
+
+        class_statistics.block_size = state->GetClassBlockSize(i);
+        class_statistics.hits = class_info.hits;
+        class_statistics.misses = class_info.misses;
+        class_statistics.blocks_outstanding = class_info.blocks_outstanding;
+
+        statistics.hits += class_statistics.hits;
+        statistics.misses += class_statistics.misses;
+        statistics.size_classes.push_back(class_statistics);
+    }
+
+    return statistics;
+}
+
+} // namespace Terra::NetUtil
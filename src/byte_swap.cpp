@@ -0,0 +1,435 @@
+/*
+ *  byte_swap.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements functions to copy arrays of 16-, 32-, or 64-bit
+ *      values between host and network byte order.
+ *
+ *      On x86 processors, the AVX2 and SSSE3 functions are compiled for those
+ *      instruction sets via function attributes, allowing the library itself
+ *      to be built for the baseline instruction set.  The most capable
+ *      function supported by the processor is selected at run time.  Each
+ *      vector function converts as many whole vectors as possible and the
+ *      remaining values are converted individually.
+ *
+ *  Portability Issues:
+ *      Vector instructions are used only when compiling with GCC or Clang
+ *      for x86 or when compiling for ARM with NEON support.
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <terra/bitutil/byte_order.h>
+#include "byte_swap.h"
+#include "cpu_features.h"
+
+namespace Terra::NetUtil
+{
+
+namespace
+{
+
+/*
+ *  ConvertScalar()
+ *
+ *  Description:
+ *      Copy an array of values between host and network byte order, one
+ *      value at a time.
+ *
+ *  Parameters:
+ *      source [in]
+ *          The values to convert.
+ *
+ *      destination [out]
+ *          The location into which converted values are written.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+template<typename T>
+void ConvertScalar(const std::uint8_t *source,
+                   std::uint8_t *destination,
+                   std::size_t count)
+{
+    T value{};
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        std::copy_n(source,
+                    sizeof(value),
+                    reinterpret_cast<std::uint8_t *>(&value));
+        value = BitUtil::NetworkByteOrder(value);
+        std::copy_n(reinterpret_cast<std::uint8_t *>(&value),
+                    sizeof(value),
+                    destination);
+
+        source += sizeof(value);
+        destination += sizeof(value);
+    }
+}
+
+#ifdef NETUTIL_X86_SIMD
+
+/*
+ *  MakeShuffleMask()
+ *
+ *  Description:
+ *      Produce the shuffle mask used to reverse the order of octets in each
+ *      value of the given width within a 256-bit vector.  Since octets are
+ *      shuffled within each 128-bit lane, the mask for each lane is the same.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The shuffle mask.
+ *
+ *  Comments:
+ *      The first 16 octets of the mask may be used with 128-bit vectors.
+ */
+template<std::size_t Width>
+constexpr std::array<std::uint8_t, 32> MakeShuffleMask()
+{
+    std::array<std::uint8_t, 32> mask{};
+
+    for (std::size_t i = 0; i < mask.size(); i++)
+    {
+        std::size_t lane_offset = i % 16;
+
+        std::size_t value_offset = (lane_offset / Width) * Width;
+
+        mask[i] = static_cast<std::uint8_t>(
+            value_offset + (Width - 1 - (lane_offset % Width)));
+    }
+
+    return mask;
+}
+
+/*
+ *  ShuffleAVX2()
+ *
+ *  Description:
+ *      Shuffle octets using the given mask, 32 octets at a time, using AVX2
+ *      instructions.
+ *
+ *  Parameters:
+ *      source [in]
+ *          The octets to shuffle.
+ *
+ *      destination [out]
+ *          The location into which shuffled octets are written.
+ *
+ *      length [in]
+ *          The number of octets available to shuffle.
+ *
+ *      mask [in]
+ *          The 32-octet shuffle mask.
+ *
+ *  Returns:
+ *      The number of octets shuffled, which is the length rounded down to a
+ *      multiple of 32.
+ *
+ *  Comments:
+ *      None.
+ */
+__attribute__((target("avx2")))
+std::size_t ShuffleAVX2(const std::uint8_t *source,
+                        std::uint8_t *destination,
+                        std::size_t length,
+                        const std::uint8_t *mask)
+{
+    const __m256i shuffle =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mask));
+    const __m256i *in = reinterpret_cast<const __m256i *>(source);
+    __m256i *out = reinterpret_cast<__m256i *>(destination);
+    std::size_t vectors = length / 32;
+    std::size_t i = 0;
+
+    // Shuffle four vectors per iteration to keep the load ports busy
+    for (; (i + 4) <= vectors; i += 4)
+    {
+        __m256i v0 = _mm256_loadu_si256(in + i);
+        __m256i v1 = _mm256_loadu_si256(in + i + 1);
+        __m256i v2 = _mm256_loadu_si256(in + i + 2);
+        __m256i v3 = _mm256_loadu_si256(in + i + 3);
+
+        _mm256_storeu_si256(out + i, _mm256_shuffle_epi8(v0, shuffle));
+        _mm256_storeu_si256(out + i + 1, _mm256_shuffle_epi8(v1, shuffle));
+        _mm256_storeu_si256(out + i + 2, _mm256_shuffle_epi8(v2, shuffle));
+        _mm256_storeu_si256(out + i + 3, _mm256_shuffle_epi8(v3, shuffle));
+    }
+
+    for (; i < vectors; i++)
+    {
+        __m256i v = _mm256_loadu_si256(in + i);
+
+        _mm256_storeu_si256(out + i, _mm256_shuffle_epi8(v, shuffle));
+    }
+
+    return vectors * 32;
+}
+
+/*
+ *  ShuffleSSSE3()
+ *
+ *  Description:
+ *      Shuffle octets using the given mask, 16 octets at a time, using SSSE3
+ *      instructions.
+ *
+ *  Parameters:
+ *      source [in]
+ *          The octets to shuffle.
+ *
+ *      destination [out]
+ *          The location into which shuffled octets are written.
+ *
+ *      length [in]
+ *          The number of octets available to shuffle.
+ *
+ *      mask [in]
+ *          The 16-octet shuffle mask.
+ *
+ *  Returns:
+ *      The number of octets shuffled, which is the length rounded down to a
+ *      multiple of 16.
+ *
+ *  Comments:
+ *      None.
+ */
+__attribute__((target("ssse3")))
+std::size_t ShuffleSSSE3(const std::uint8_t *source,
+                         std::uint8_t *destination,
+                         std::size_t length,
+                         const std::uint8_t *mask)
+{
+    const __m128i shuffle =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask));
+    const __m128i *in = reinterpret_cast<const __m128i *>(source);
+    __m128i *out = reinterpret_cast<__m128i *>(destination);
+    std::size_t vectors = length / 16;
+
+    for (std::size_t i = 0; i < vectors; i++)
+    {
+        __m128i v = _mm_loadu_si128(in + i);
+
+        _mm_storeu_si128(out + i, _mm_shuffle_epi8(v, shuffle));
+    }
+
+    return vectors * 16;
+}
+
+#endif // NETUTIL_X86_SIMD
+
+#ifdef NETUTIL_ARM_SIMD
+
+/*
+ *  ReverseNEON()
+ *
+ *  Description:
+ *      Reverse the order of octets in each value of the given width, 16
+ *      octets at a time, using NEON instructions.
+ *
+ *  Parameters:
+ *      source [in]
+ *          The values to convert.
+ *
+ *      destination [out]
+ *          The location into which converted values are written.
+ *
+ *      length [in]
+ *          The number of octets available to convert.
+ *
+ *  Returns:
+ *      The number of octets converted, which is the length rounded down to a
+ *      multiple of 16.
+ *
+ *  Comments:
+ *      None.
+ */
+template<std::size_t Width>
+std::size_t ReverseNEON(const std::uint8_t *source,
+                        std::uint8_t *destination,
+                        std::size_t length)
+{
+    std::size_t vectors = length / 16;
+
+    for (std::size_t i = 0; i < vectors; i++)
+    {
+        uint8x16_t v = vld1q_u8(source + (i * 16));
+
+        if constexpr (Width == 2) v = vrev16q_u8(v);
+        if constexpr (Width == 4) v = vrev32q_u8(v);
+        if constexpr (Width == 8) v = vrev64q_u8(v);
+
+        vst1q_u8(destination + (i * 16), v);
+    }
+
+    return vectors * 16;
+}
+
+#endif // NETUTIL_ARM_SIMD
+
+/*
+ *  ConvertArray()
+ *
+ *  Description:
+ *      Copy an array of values between host and network byte order using
+ *      the fastest means available.
+ *
+ *  Parameters:
+ *      source [in]
+ *          The values to convert.
+ *
+ *      destination [out]
+ *          The location into which converted values are written.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+template<typename T>
+void ConvertArray(const std::uint8_t *source,
+                  std::uint8_t *destination,
+                  std::size_t count)
+{
+    std::size_t length = count * sizeof(T);
+    std::size_t converted = 0;
+
+    // Values are already in network byte order on big endian processors
+    if constexpr (std::endian::native == std::endian::big)
+    {
+        std::copy_n(source, length, destination);
+        return;
+    }
+
+#if defined(NETUTIL_X86_SIMD)
+    static constexpr std::array<std::uint8_t, 32> mask =
+        MakeShuffleMask<sizeof(T)>();
+
+    if (HasAVX2())
+    {
+        converted = ShuffleAVX2(source, destination, length, mask.data());
+    }
+    else if (HasSSSE3())
+    {
+        converted = ShuffleSSSE3(source, destination, length, mask.data());
+    }
+#elif defined(NETUTIL_ARM_SIMD)
+    converted = ReverseNEON<sizeof(T)>(source, destination, length);
+#endif
+
+    // Convert the remaining values individually
+    ConvertScalar<T>(source + converted,
+                     destination + converted,
+                     (length - converted) / sizeof(T));
+}
+
+} // namespace
+
+/*
+ *  CopyNetworkOrder16()
+ *
+ *  Description:
+ *      Copy an array of 16-bit values between host and network byte order.
+ *
+ *  Parameters:
+ *      source [in]
+ *          The values to convert.
+ *
+ *      destination [out]
+ *          The location into which converted values are written.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void CopyNetworkOrder16(const std::uint8_t *source,
+                        std::uint8_t *destination,
+                        std::size_t count)
+{
+    ConvertArray<std::uint16_t>(source, destination, count);
+}
+
+/*
+ *  CopyNetworkOrder32()
+ *
+ *  Description:
+ *      Copy an array of 32-bit values between host and network byte order.
+ *
+ *  Parameters:
+ *      source [in]
+ *          The values to convert.
+ *
+ *      destination [out]
+ *          The location into which converted values are written.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void CopyNetworkOrder32(const std::uint8_t *source,
+                        std::uint8_t *destination,
+                        std::size_t count)
+{
+    ConvertArray<std::uint32_t>(source, destination, count);
+}
+
+/*
+ *  CopyNetworkOrder64()
+ *
+ *  Description:
+ *      Copy an array of 64-bit values between host and network byte order.
+ *
+ *  Parameters:
+ *      source [in]
+ *          The values to convert.
+ *
+ *      destination [out]
+ *          The location into which converted values are written.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void CopyNetworkOrder64(const std::uint8_t *source,
+                        std::uint8_t *destination,
+                        std::size_t count)
+{
+    ConvertArray<std::uint64_t>(source, destination, count);
+}
+
+} // namespace Terra::NetUtil
@@ -0,0 +1,81 @@
+/*
+ *  byte_swap.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines functions used internally to copy arrays of 16-,
+ *      32-, or 64-bit values between host and network byte order.  Since
+ *      converting to and from network byte order is the same operation, the
+ *      same functions are used in both directions.
+ *
+ *      On little endian x86 processors, the conversion uses AVX2 or SSSE3
+ *      instructions when the processor supports them (as determined at run
+ *      time) and on ARM processors the conversion uses NEON instructions.
+ *      Otherwise, values are converted one at a time.  On big endian
+ *      processors, values are simply copied.
+ *
+ *  Portability Issues:
+ *      The source and destination may be unaligned, but must not overlap.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Terra::NetUtil
+{
+
+void CopyNetworkOrder16(const std::uint8_t *source,
+                        std::uint8_t *destination,
+                        std::size_t count);
+void CopyNetworkOrder32(const std::uint8_t *source,
+                        std::uint8_t *destination,
+                        std::size_t count);
+void CopyNetworkOrder64(const std::uint8_t *source,
+                        std::uint8_t *destination,
+                        std::size_t count);
+
+/*
+ *  CopyNetworkOrder()
+ *
+ *  Description:
+ *      Copy an array of values of the given width between host and network
+ *      byte order.
+ *
+ *  Parameters:
+ *      source [in]
+ *          The values to convert.
+ *
+ *      destination [out]
+ *          The location into which converted values are written.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+template<std::size_t Width>
+inline void CopyNetworkOrder(const std::uint8_t *source,
+                             std::uint8_t *destination,
+                             std::size_t count)
+{
+    static_assert((Width == 2) || (Width == 4) || (Width == 8),
+                  "Unsupported value width");
+
+    if constexpr (Width == 2) CopyNetworkOrder16(source, destination, count);
+    if constexpr (Width == 4) CopyNetworkOrder32(source, destination, count);
+    if constexpr (Width == 8) CopyNetworkOrder64(source, destination, count);
+}
+
+} // namespace Terra::NetUtil
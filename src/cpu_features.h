@@ -0,0 +1,149 @@
+/*
+ *  cpu_features.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file defines macros and functions used internally to determine
+ *      which vector instructions may be used.
+ *
+ *      NETUTIL_X86_SIMD is defined when compiling with GCC or Clang for x86,
+ *      in which case functions may be compiled for specific instruction sets
+ *      via function attributes and the HasAVX2(), HasSSE42(), HasSSSE3(), and
+ *      HasSSE2() functions determine at run time whether the processor
+ *      supports them.
+ *      NETUTIL_ARM_SIMD is defined when compiling for ARM with NEON support,
+ *      which is then assumed to be present.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#pragma once
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define NETUTIL_X86_SIMD
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#define NETUTIL_ARM_SIMD
+#include <arm_neon.h>
+#endif
+
+namespace Terra::NetUtil
+{
+
+#ifdef NETUTIL_X86_SIMD
+
+/*
+ *  HasAVX2()
+ *
+ *  Description:
+ *      Determine whether the processor supports AVX2 instructions.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      True if AVX2 instructions are supported, false otherwise.
+ *
+ *  Comments:
+ *      The processor is queried only once.
+ */
+inline bool HasAVX2()
+{
+    static const bool avx2 = []()
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+
+    return avx2;
+}
+
+/*
+ *  HasSSE42()
+ *
+ *  Description:
+ *      Determine whether the processor supports SSE4.2 instructions.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      True if SSE4.2 instructions are supported, false otherwise.
+ *
+ *  Comments:
+ *      The processor is queried only once.
+ */
+inline bool HasSSE42()
+{
+    static const bool sse42 = []()
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.2") != 0;
+    }();
+
+    return sse42;
+}
+
+/*
+ *  HasSSSE3()
+ *
+ *  Description:
+ *      Determine whether the processor supports SSSE3 instructions.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      True if SSSE3 instructions are supported, false otherwise.
+ *
+ *  Comments:
+ *      The processor is queried only once.
+ */
+inline bool HasSSSE3()
+{
+    static const bool ssse3 = []()
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("ssse3") != 0;
+    }();
+
+    return ssse3;
+}
+
+/*
+ *  HasSSE2()
+ *
+ *  Description:
+ *      Determine whether the processor supports SSE2 instructions.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      True if SSE2 instructions are supported, false otherwise.
+ *
+ *  Comments:
+ *      The processor is queried only once.  SSE2 is always supported on
+ *      x86-64 processors.
+ */
+inline bool HasSSE2()
+{
+    static const bool sse2 = []()
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2") != 0;
+    }();
+
+    return sse2;
+}
+
+#endif // NETUTIL_X86_SIMD
+
+} // namespace Terra::NetUtil
@@ -24,17 +24,32 @@
  */
 
 #include <climits>
-#include <iomanip>
-#include <cctype>
+#include <cstring>
 #include <algorithm>
-#include <sstream>
+#include <iterator>
 #include <terra/netutil/data_buffer.h>
+#include <terra/netutil/buffer_pool.h>
+#include <terra/netutil/hex_dump.h>
 #include <terra/bitutil/byte_order.h>
 #include <terra/bitutil/significant_bit.h>
+#include "byte_swap.h"
+
+// Functions defined inline are otherwise compiled here
+#ifndef NETUTIL_INLINE_DEFINITIONS
+#include <terra/netutil/data_buffer_inline.h>
+#endif
 
 namespace Terra::NetUtil
 {
 
+namespace
+{
+
+// Smallest buffer size allocated when a growable DataBuffer must grow
+constexpr std::size_t Minimum_Growth_Size = 64;
+
+} // namespace
+
 /*
  *  DataBuffer::DataBuffer()
  *
@@ -54,6 +69,11 @@ namespace Terra::NetUtil
  */
 DataBuffer::DataBuffer() :
     owns_buffer(false),
+    growable(false),
+    buffer_pool(nullptr),
+    memory_resource(nullptr),
+    inline_buffer(nullptr),
+    inline_buffer_size(0),
     buffer(nullptr),
     buffer_size(0),
     data_length(0),
@@ -72,6 +92,87 @@ DataBuffer::DataBuffer() :
  *      buffer_size [in]
  *          The size of the buffer the DataBuffer object should allocate.
  *
+ *      growable [in]
+ *          If true, the buffer will be reallocated as needed when appending
+ *          data beyond the buffer size.  This defaults to false.
+ *
+ *  Returns:
+ *      Nothing.  However, an exception of std::bad_alloc may be thrown if
+ *      memory allocation fails.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBuffer::DataBuffer(std::size_t buffer_size, bool growable) : DataBuffer()
+{
+    this->growable = growable;
+
+    AllocateBuffer(buffer_size);
+}
+
+/*
+ *  DataBuffer::DataBuffer()
+ *
+ *  Description:
+ *      Constructor for the DataBuffer object that results in a block of
+ *      memory of the specified size being borrowed from the given BufferPool.
+ *      The memory is returned to the pool when no longer used.  Any memory
+ *      subsequently allocated by this object, such as when growing the
+ *      buffer, will also be borrowed from the pool.
+ *
+ *  Parameters:
+ *      buffer_size [in]
+ *          The size of the buffer the DataBuffer object should allocate.
+ *
+ *      buffer_pool [in]
+ *          The BufferPool from which memory should be borrowed.  The pool
+ *          must outlive this DataBuffer.
+ *
+ *      growable [in]
+ *          If true, the buffer will be reallocated as needed when appending
+ *          data beyond the buffer size.  This defaults to false.
+ *
+ *  Returns:
+ *      Nothing.  However, an exception of std::bad_alloc may be thrown if
+ *      memory allocation fails.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBuffer::DataBuffer(std::size_t buffer_size,
+                       BufferPool &buffer_pool,
+                       bool growable) :
+    DataBuffer()
+{
+    this->growable = growable;
+    this->buffer_pool = &buffer_pool;
+
+    AllocateBuffer(buffer_size);
+}
+
+/*
+ *  DataBuffer::DataBuffer()
+ *
+ *  Description:
+ *      Constructor for the DataBuffer object that results in a block of
+ *      memory of the specified size being allocated from the given memory
+ *      resource.  Any memory subsequently allocated by this object, such as
+ *      when growing the buffer, will also be allocated from the memory
+ *      resource.
+ *
+ *  Parameters:
+ *      buffer_size [in]
+ *          The size of the buffer the DataBuffer object should allocate.
+ *
+ *      memory_resource [in]
+ *          The memory resource from which memory should be allocated.  The
+ *          memory resource must outlive this DataBuffer.  If nullptr, memory
+ *          will be allocated from the heap.
+ *
+ *      growable [in]
+ *          If true, the buffer will be reallocated as needed when appending
+ *          data beyond the buffer size.  This defaults to false.
+ *
  *  Returns:
  *      Nothing.  However, an exception of std::bad_alloc may be thrown if
  *      memory allocation fails.
@@ -79,8 +180,14 @@ DataBuffer::DataBuffer() :
  *  Comments:
  *      None.
  */
-DataBuffer::DataBuffer(std::size_t buffer_size) : DataBuffer()
+DataBuffer::DataBuffer(std::size_t buffer_size,
+                       std::pmr::memory_resource *memory_resource,
+                       bool growable) :
+    DataBuffer()
 {
+    this->growable = growable;
+    this->memory_resource = memory_resource;
+
     AllocateBuffer(buffer_size);
 }
 
@@ -153,10 +260,85 @@ DataBuffer::DataBuffer(std::uint8_t *buffer,
  *      other [in]
  *          A reference to the other data buffer to copy.  Regardless of
  *          whether the other DataBuffer owns its buffer or not, this
- *          constructor will allocate its own memory and copy the buffer
+ *          constructor will allocate its own memory of the same size and copy
+ *          the data from the other DataBuffer object.  If the other object
+ *          does not have a buffer, then this copy will not, either.  If the
+ *          other DataBuffer borrows memory from a BufferPool, so will this
+ *          object.
+ *
+ *  Returns:
+ *      Nothing.  However, an exception of std::bad_alloc may be thrown if
+ *      memory allocation fails.
+ *
+ *  Comments:
+ *      Octets beyond the data length are not copied.
+ */
+DataBuffer::DataBuffer(const DataBuffer &other) :
+    DataBuffer(other, DataBufferCopyMode::Data)
+{
+}
+
+/*
+ *  DataBuffer::DataBuffer()
+ *
+ *  Description:
+ *      Copy constructor for the DataBuffer object that copies only the
+ *      specified portion of the other DataBuffer.
+ *
+ *  Parameters:
+ *      other [in]
+ *          A reference to the other data buffer to copy.  Regardless of
+ *          whether the other DataBuffer owns its buffer or not, this
+ *          constructor will allocate its own memory and copy the requested
+ *          octets from the other DataBuffer object.  If the other DataBuffer
+ *          borrows memory from a BufferPool, so will this object.
+ *
+ *      copy_mode [in]
+ *          The portion of the other DataBuffer to copy.  See Assign().
+ *
+ *      shrink_to_fit [in]
+ *          If true, the buffer is sized to hold only the copied octets.
+ *          Otherwise, the buffer is the same size as that of the other object.
+ *
+ *  Returns:
+ *      Nothing.  However, an exception of std::bad_alloc may be thrown if
+ *      memory allocation fails.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBuffer::DataBuffer(const DataBuffer &other,
+                       DataBufferCopyMode copy_mode,
+                       bool shrink_to_fit) :
+    DataBuffer()
+{
+    // A copy allocates memory just as the original
+    buffer_pool = other.buffer_pool;
+    memory_resource = other.memory_resource;
+
+    Assign(other, copy_mode, shrink_to_fit);
+}
+
+/*
+ *  DataBuffer::DataBuffer()
+ *
+ *  Description:
+ *      Copy constructor for the DataBuffer object that allocates memory from
+ *      the given memory resource.
+ *
+ *  Parameters:
+ *      other [in]
+ *          A reference to the other data buffer to copy.  Regardless of
+ *          how the other DataBuffer obtained its buffer, this constructor will
+ *          allocate memory from the given memory resource and copy the buffer
  *          contents from the other DataBuffer object.  If the other object
  *          does not have a buffer, then this copy will not, either.
  *
+ *      memory_resource [in]
+ *          The memory resource from which memory should be allocated.  The
+ *          memory resource must outlive this DataBuffer.  If nullptr, memory
+ *          will be allocated from the heap.
+ *
  *  Returns:
  *      Nothing.  However, an exception of std::bad_alloc may be thrown if
  *      memory allocation fails.
@@ -164,21 +346,15 @@ DataBuffer::DataBuffer(std::uint8_t *buffer,
  *  Comments:
  *      None.
  */
-DataBuffer::DataBuffer(const DataBuffer &other) : DataBuffer()
+DataBuffer::DataBuffer(const DataBuffer &other,
+                       std::pmr::memory_resource *memory_resource) :
+    DataBuffer()
 {
-    // Allocate memory and perform a copy only if the other object has a buffer
-    if (other.buffer != nullptr)
-    {
-        // Allocate memory for this DataBuffer object
-        AllocateBuffer(other.buffer_size);
-
-        // Copy the octets from the data buffer into the span
-        std::copy_n(other.buffer, buffer_size, buffer);
+    // Use the given memory resource in place of that of the other object
+    this->memory_resource = memory_resource;
 
-        // Set other internal variables from the other object
-        data_length = other.data_length;
-        read_position = other.read_position;
-    }
+    // Perform a copy assignment using this object's memory resource
+    *this = other;
 }
 
 /*
@@ -194,31 +370,15 @@ DataBuffer::DataBuffer(const DataBuffer &other) : DataBuffer()
  *          this object.
  *
  *  Returns:
- *      Nothing.  However, an exception of std::bad_alloc may be thrown if
- *      memory allocation fails.
+ *      Nothing.
  *
  *  Comments:
- *      None.
+ *      See the move assignment operator regarding buffers stored inline
+ *      within the other object.
  */
 DataBuffer::DataBuffer(DataBuffer &&other) noexcept : DataBuffer()
 {
-    // Move data only if the other object has a buffer
-    if (other.buffer != nullptr)
-    {
-        // Assign values from the other object to this object
-        owns_buffer = other.owns_buffer;
-        buffer = other.buffer;
-        buffer_size = other.buffer_size;
-        data_length = other.data_length;
-        read_position = other.read_position;
-
-        // Clear all values in the other object
-        other.owns_buffer = false;
-        other.buffer = nullptr;
-        other.buffer_size = 0;
-        other.data_length = 0;
-        other.read_position = 0;
-    }
+    *this = std::move(other);
 }
 
 /*
@@ -248,10 +408,11 @@ DataBuffer::~DataBuffer()
  *      This operator will copy a DataBuffer object to another.  If the size
  *      of this object does not own its underlying buffer or if the underlying
  *      buffer is not the same as the other, a new buffer will be allocated.
- *      The entire data buffer of the other object, regardless of its data
- *      length, is copied into the this object.  If the other object's data
- *      buffer is zero-length underlying buffer, this object will also have a
- *      zero-length buffer.
+ *      The data of the other object (i.e., the octets up to its data length)
+ *      is copied into the this object.  If the other object's data buffer is
+ *      zero-length underlying buffer, this object will also have a
+ *      zero-length buffer.  Any new buffer is allocated from this object's
+ *      BufferPool or memory resource, if either was given at construction.
  *
  *  Parameters:
  *      other [in]
@@ -262,26 +423,12 @@ DataBuffer::~DataBuffer()
  *      thrown if there is an error allocating memory.
  *
  *  Comments:
- *      None.
+ *      Octets beyond the data length are not copied.  Call Assign() with
+ *      DataBufferCopyMode::Buffer to copy the entire buffer.
  */
 DataBuffer &DataBuffer::operator=(const DataBuffer &other)
 {
-    // If assigning to self, just return this
-    if (this == &other) return *this;
-
-    // If this object does not own its buffer or the buffer is not the same
-    // size as the other buffer, allocate memory for this DataBuffer
-    if (!owns_buffer || (buffer_size != other.buffer_size))
-    {
-        AllocateBuffer(other.buffer_size);
-    }
-
-    // Copy the buffer contents if buffer size is non-zero
-    if (other.buffer_size > 0) std::copy_n(other.buffer, buffer_size, buffer);
-
-    // Set other internal variables from the other object
-    data_length = other.data_length;
-    read_position = other.read_position;
+    Assign(other, DataBufferCopyMode::Data);
 
     return *this;
 }
@@ -300,13 +447,36 @@ DataBuffer &DataBuffer::operator=(const DataBuffer &other)
  *      A reference to the receiving DataBuffer object.
  *
  *  Comments:
- *      None.
+ *      If the other object's buffer is stored inline within that object
+ *      (e.g., a SmallDataBuffer), the buffer cannot be transferred and its
+ *      contents are instead copied into this object's inline storage or, if
+ *      there is insufficient inline storage, into newly allocated memory.
+ *      Should that memory allocation fail, std::terminate() is called.
  */
 DataBuffer &DataBuffer::operator=(DataBuffer &&other) noexcept
 {
+    // If assigning to self, just return this
+    if (this == &other) return *this;
+
     // Free any previously allocated buffer or clear any set buffer
     FreeBuffer();
 
+    // Take on the growable property and memory source of the other object
+    growable = other.growable;
+    buffer_pool = other.buffer_pool;
+    memory_resource = other.memory_resource;
+
+    // An inline buffer cannot be transferred, so copy its contents
+    if ((other.buffer != nullptr) && (other.buffer == other.inline_buffer))
+    {
+        AllocateBuffer(other.buffer_size);
+        std::copy_n(other.buffer, buffer_size, buffer);
+        data_length = other.data_length;
+        read_position = other.read_position;
+
+        other.FreeBuffer();
+    }
+
     // Move data only if the other object has a buffer
     if (other.buffer != nullptr)
     {
@@ -328,6 +498,84 @@ DataBuffer &DataBuffer::operator=(DataBuffer &&other) noexcept
     return *this;
 }
 
+/*
+ *  DataBuffer::AcquireMemory()
+ *
+ *  Description:
+ *      Obtain a block of memory of the specified size.  If this object has
+ *      inline storage that is not in use and is sufficiently large, that
+ *      storage is used.  Otherwise, memory is obtained from the BufferPool
+ *      or memory resource, if either is assigned, or from the heap.
+ *
+ *  Parameters:
+ *      size [in]
+ *          The size of the memory block to acquire.  This must be non-zero.
+ *
+ *  Returns:
+ *      A pointer to the memory block.  An exception of std::bad_alloc may be
+ *      thrown if memory allocation fails.
+ *
+ *  Comments:
+ *      None.
+ */
+std::uint8_t *DataBuffer::AcquireMemory(std::size_t size)
+{
+    if ((inline_buffer != nullptr) && (buffer != inline_buffer) &&
+        (size <= inline_buffer_size))
+    {
+        return inline_buffer;
+    }
+
+    if (buffer_pool != nullptr) return buffer_pool->Allocate(size);
+
+    if (memory_resource != nullptr)
+    {
+        return static_cast<std::uint8_t *>(
+            memory_resource->allocate(size, alignof(std::max_align_t)));
+    }
+
+    return new std::uint8_t[size];
+}
+
+/*
+ *  DataBuffer::ReleaseMemory()
+ *
+ *  Description:
+ *      Release a block of memory previously obtained via AcquireMemory().
+ *
+ *  Parameters:
+ *      memory [in]
+ *          The memory block to release.
+ *
+ *      size [in]
+ *          The size of the memory block as requested from AcquireMemory().
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBuffer::ReleaseMemory(std::uint8_t *memory, std::size_t size)
+{
+    // Inline storage is never released
+    if (memory == inline_buffer) return;
+
+    if (buffer_pool != nullptr)
+    {
+        buffer_pool->Release(memory, size);
+        return;
+    }
+
+    if (memory_resource != nullptr)
+    {
+        memory_resource->deallocate(memory, size, alignof(std::max_align_t));
+        return;
+    }
+
+    delete[] memory;
+}
+
 /*
  *  DataBuffer::AllocateBuffer()
  *
@@ -354,7 +602,7 @@ void DataBuffer::AllocateBuffer(std::size_t size)
     if (size == 0) return;
 
     // Attempt to allocate the requested memory
-    buffer = new std::uint8_t[size];
+    buffer = AcquireMemory(size);
     buffer_size = size;
     owns_buffer = true;
 }
@@ -379,7 +627,7 @@ void DataBuffer::AllocateBuffer(std::size_t size)
 void DataBuffer::FreeBuffer()
 {
     // If DataBuffer owns the memory, free it
-    if (owns_buffer) delete[] buffer;
+    if (owns_buffer) ReleaseMemory(buffer, buffer_size);
 
     // Reset various buffer-related member variables
     buffer = nullptr;
@@ -390,80 +638,197 @@ void DataBuffer::FreeBuffer()
 }
 
 /*
- *  DataBuffer::GetBufferPointer()
+ *  DataBuffer::ReallocateBuffer()
  *
  *  Description:
- *      Get a pointer to the underlying buffer and specified offset.
+ *      Replace the current buffer with a newly allocated buffer of the
+ *      specified size, preserving as much of the existing buffer contents as
+ *      will fit.  The data length and read position are retained, though
+ *      they are reduced if they would otherwise exceed the new buffer size.
  *
  *  Parameters:
- *      offset [in]
- *          Offset into the buffer between zero and the size of the buffer.
+ *      size [in]
+ *          The size of the new buffer.  This must be non-zero.
  *
  *  Returns:
- *      A pointer to the underlying buffer + the offset value.  An exception is
- *      thrown if the requested offset is beyond the size of the underlying
- *      buffer.  If, however, no buffer is assigned, nullptr is returned,
- *      regardless of the offset value.
+ *      Nothing.  However, an exception of std::bad_alloc may be thrown if
+ *      memory allocation fails, in which case the existing buffer is left
+ *      unchanged.
  *
  *  Comments:
- *      None.
+ *      The caller must ensure that the current buffer, if any, is owned by
+ *      this object.
  */
-std::uint8_t *DataBuffer::GetBufferPointer(std::size_t offset) const
+void DataBuffer::ReallocateBuffer(std::size_t size)
 {
-    // If there is no underlying buffer assigned, return nullptr
-    if (buffer == nullptr) return nullptr;
+    // Allocate the new buffer before releasing the current one
+    std::uint8_t *new_buffer = AcquireMemory(size);
 
-    // Ensure the request is not beyond the buffer length
-    if (offset >= buffer_size)
+    // Copy the existing buffer contents into the new buffer
+    if (buffer != nullptr)
     {
-        throw DataBufferException("Invalid buffer pointer requested");
+        std::copy_n(buffer, std::min(buffer_size, size), new_buffer);
     }
 
-    return buffer + offset;
+    // Release the old buffer, retaining the data length and read position
+    std::size_t old_data_length = std::min(data_length, size);
+    std::size_t old_read_position = std::min(read_position, old_data_length);
+    FreeBuffer();
+
+    // Assign the new buffer
+    buffer = new_buffer;
+    buffer_size = size;
+    owns_buffer = true;
+    data_length = old_data_length;
+    read_position = old_read_position;
 }
 
 /*
- *  DataBuffer::GetBufferPointer()
+ *  DataBuffer::GrowBuffer()
  *
  *  Description:
- *      Get a span over the data buffer with respect to both the data length
- *      and the read position.
+ *      Grow the buffer so that there is space to append the given number of
+ *      octets following the existing data.  The buffer is grown geometrically
+ *      so that a series of appends has an amortized constant cost.  This is
+ *      called by EnsureAppendSpace() only when growth is required.
  *
  *  Parameters:
- *      offset [in]
- *          Offset into the buffer between zero and the size of the buffer.
+ *      length [in]
+ *          The number of octets that are about to be appended.
  *
  *  Returns:
- *      A span over the octets in the DataBuffer that take into account the
- *      data_length and read_position variables.
+ *      Nothing.  However, an exception of std::bad_alloc may be thrown if
+ *      memory allocation fails.
  *
  *  Comments:
- *      None.
+ *      If the DataBuffer operates over a buffer it does not own, this function
+ *      does nothing and the subsequent write will fail as it would for any
+ *      fixed-size buffer.
  */
-std::span<std::uint8_t> DataBuffer::GetBufferSpan() const
+void DataBuffer::GrowBuffer(std::size_t length)
 {
-    return {buffer + read_position, data_length - read_position};
+    // Memory that is not owned by this object cannot be reallocated
+    if (!owns_buffer && (buffer != nullptr)) return;
+
+    // Grow to at least double the current size
+    ReallocateBuffer(std::max({data_length + length,
+                               buffer_size * 2,
+                               Minimum_Growth_Size}));
 }
 
 /*
- *  DataBuffer::GetBufferSize()
+ *  DataBuffer::Assign()
  *
  *  Description:
- *      Returns the size of the underlying buffer.
+ *      Copy the specified portion of the other DataBuffer into this object.
+ *      If this object does not own its underlying buffer or if the buffer
+ *      is not of the required size, a new buffer will be allocated from this
+ *      object's BufferPool or memory resource, if either was given at
+ *      construction.
  *
  *  Parameters:
- *      None.
+ *      other [in]
+ *          A reference to the other data buffer from which to copy.
+ *
+ *      copy_mode [in]
+ *          The portion of the other DataBuffer to copy.  With Buffer, the
+ *          entire underlying buffer is copied.  With Data, only the octets up
+ *          to the data length are copied.  In both cases, the data length and
+ *          read position are the same as those of the other object.  With
+ *          Unread, only the octets from the read position to the data length
+ *          are copied to the start of this object's buffer, the data length
+ *          is the number of octets copied, and the read position is zero.
+ *
+ *      shrink_to_fit [in]
+ *          If true, the buffer is sized to hold only the copied octets.
+ *          Otherwise, the buffer is the same size as that of the other object.
+ *
+ *  Returns:
+ *      Nothing.  An exception will be thrown if there is an error allocating
+ *      memory.
+ *
+ *  Comments:
+ *      If the other object does not have a buffer or, when shrinking, there
+ *      are no octets to copy, this object will not have a buffer.
+ */
+void DataBuffer::Assign(const DataBuffer &other,
+                        DataBufferCopyMode copy_mode,
+                        bool shrink_to_fit)
+{
+    std::size_t offset = 0;
+    std::size_t length = 0;
+
+    // If assigning to self, there is nothing to do
+    if (this == &other) return;
+
+    // Determine which octets to copy
+    switch (copy_mode)
+    {
+        case DataBufferCopyMode::Buffer:
+            length = other.buffer_size;
+            break;
+
+        case DataBufferCopyMode::Data:
+            length = other.data_length;
+            break;
+
+        case DataBufferCopyMode::Unread:
+            offset = other.read_position;
+            length = other.data_length - other.read_position;
+            break;
+    }
+
+    // Determine the required buffer size
+    std::size_t size = shrink_to_fit ? length : other.buffer_size;
+
+    // If this object does not own its buffer or the buffer is not the
+    // required size, allocate memory for this DataBuffer
+    if (!owns_buffer || (buffer_size != size)) AllocateBuffer(size);
+
+    // Copy the requested octets
+    if (length > 0) std::copy_n(other.buffer + offset, length, buffer);
+
+    // Set other internal variables from the other object
+    growable = other.growable;
+    if (copy_mode == DataBufferCopyMode::Unread)
+    {
+        data_length = length;
+        read_position = 0;
+    }
+    else
+    {
+        data_length = other.data_length;
+        read_position = other.read_position;
+    }
+}
+
+/*
+ *  DataBuffer::Clone()
+ *
+ *  Description:
+ *      Return a copy of this DataBuffer containing the specified portion of
+ *      this object's buffer.  The copy allocates memory in the same manner
+ *      as this object.
+ *
+ *  Parameters:
+ *      shrink_to_fit [in]
+ *          If true, the buffer of the copy is sized to hold only the copied
+ *          octets.  Otherwise, the buffer is the same size as this object's.
+ *
+ *      copy_mode [in]
+ *          The portion of this DataBuffer to copy.  See Assign().
  *
  *  Returns:
- *      The size of the underlying buffer.  If there is no buffer, the value
- *      returned will be zero.
+ *      The copy of this DataBuffer.  An exception will be thrown if there is
+ *      an error allocating memory.
  *
  *  Comments:
  *      None.
  */
-std::size_t DataBuffer::GetBufferSize() const
+DataBuffer DataBuffer::Clone(bool shrink_to_fit,
+                             DataBufferCopyMode copy_mode) const
 {
-    return buffer_size;
+    return DataBuffer(*this, copy_mode, shrink_to_fit);
 }
 
 /*
@@ -533,495 +898,70 @@ void DataBuffer::SetBuffer(std::uint8_t *new_buffer,
     if (new_buffer == nullptr) return;
 
     // Ensure the parameters are sane
-    if ((new_buffer_size == 0) || (new_data_length > new_buffer_size))
-    {
-        throw DataBufferException("Setting buffer with invalid argument(s)");
-    }
-
-    // Set various member variables
-    buffer = new_buffer;
-    buffer_size = new_buffer_size;
-    data_length = new_data_length;
-}
-
-/*
- *  DataBuffer::GetDataLength()
- *
- *  Description:
- *      Get the length of the data stored in the DataBuffer.
- *
- *  Parameters:
- *      None.
- *
- *  Returns:
- *      The length of the data stored in the DataBuffer.
- *
- *  Comments:
- *      None.
- */
-std::size_t DataBuffer::GetDataLength() const
-{
-    return data_length;
-}
-
-/*
- *  DataBuffer::SetDataLength()
- *
- *  Description:
- *      Set the length of data stored in the DataBuffer.  Setting the data
- *      length will also cause the read position to be reset to the start
- *      of the data buffer.
- *
- *  Parameters:
- *      length [in]
- *          The value to set as the new data length.
- *
- *  Returns:
- *      Nothing is returned, but an exception will be thrown if the given length
- *      is beyond the size of the underlying buffer.
- *
- *  Comments:
- *      None.
- */
-void DataBuffer::SetDataLength(std::size_t length)
-{
-    if (length > buffer_size)
-    {
-        throw DataBufferException("Cannot set the data length beyond the "
-                                  "buffer size");
-    }
-
-    // Set the data_length
-    data_length = length;
-
-    // Reset the read position to the start of the buffer
-    read_position = 0;
-}
-
-/*
- *  DataBuffer::Empty()
- *
- *  Description:
- *      Check to see if the DataBuffer is emtpy or not.  Specifically, the
- *      check is for a non-zero data length.  The data length is updated
- *      either by using the AppendValue() functions, calling SetDataLength(),
- *      or by using the constructor that accepts a data length as an argument.
- *
- *  Parameters:
- *      None.
- *
- *  Returns:
- *      True if the DataBuffer is empty, false if not.  Having a zero
- *      size data length indicates an empty DataBuffer.
- *
- *  Comments:
- *      None.
- */
-bool DataBuffer::Empty() const
-{
-    return (data_length == 0);
-}
-
-/*
- *  DataBuffer::GetReadPosition()
- *
- *  Description:
- *      Get the current read position in the buffer.  The read position
- *      is the position from which values will be read when ReadValue()
- *      functions are called.
- *
- *  Parameters:
- *      None.
- *
- *  Returns:
- *      The the current read position in the internal data buffer.
- *
- *  Comments:
- *      The current read position will always have a value between 0 and
- *      the data length.  If the data length is set and the read position
- *      is beyond that value, it will be changed toe be one less than the
- *      data length or zero if the data length is zero.
- */
-std::size_t DataBuffer::GetReadPosition() const
-{
-    return read_position;
-}
-
-/*
- *  DataBuffer::SetReadPosition()
- *
- *  Description:
- *      Set the current read position to the specified value.  The value
- *      cannot be equal to or greater than the data length, except for the
- *      case where the value is zero.
- *
- *  Parameters:
- *      position [in]
- *          The new read position value to set.  This must be in the range
- *          of zero to the data length value.
- *
- *  Returns:
- *      Nothing.  However, an exception will be thrown is an attempt is made
- *      to set the read position to an invalid position.
- *
- *  Comments:
- *      None.
- */
-void DataBuffer::SetReadPosition(std::size_t position)
-{
-    // Ensure the given value is acceptable
-    if (position > data_length)
-    {
-        throw DataBufferException("Attempt to set data buffer read position "
-                                  "beyond the data length");
-    }
-
-    read_position = position;
-}
-
-/*
- *  DataBuffer::AdvanceReadPosition()
- *
- *  Description:
- *      Advance the current read position by the specified distance in octets.
- *
- *  Parameters:
- *      distance [in]
- *          The distance in octets to advance the read position.
- *
- *  Returns:
- *      Nothing.  However, an exception will be thrown is an attempt is made
- *      to advance the read position beyond the actual data in the buffer.
- *
- *  Comments:
- *      None.
- */
-void DataBuffer::AdvanceReadPosition(std::size_t distance)
-{
-    SetReadPosition(read_position + distance);
-}
-
-/*
- *  DataBuffer::GetUnreadLength()
- *
- *  Description:
- *      This function will return the number of octets in the DataBuffer that
- *      have not been read using the ReadValue() functions.
- *
- *  Parameters:
- *      None.
- *
- *  Returns:
- *      The number of unread octets in the DataBuffer.
- *
- *  Comments:
- *      None.
- */
-std::size_t DataBuffer::GetUnreadLength() const
-{
-    return data_length - read_position;
-}
-
-/*
- *  DataBuffer::operator==()
- *
- *  Description:
- *      This operator will compare this data buffer with another.  Two
- *      DataBuffer objects are considered equal if both have the same
- *      data length and the data length portion of the buffer contents are
- *      identical.  The read position value is not a factor in equality.
- *
- *  Parameters:
- *      other [in]
- *          A reference to the other data buffer with which to compare.
- *
- *  Returns:
- *      True if equal, false of not equal.
- *
- *  Comments:
- *      None.
- */
-bool DataBuffer::operator==(const DataBuffer &other)
-{
-    // Is the data length the same?
-    if (data_length != other.data_length) return false;
-
-    // If the data length is zero, they are equal
-    if (data_length == 0) return true;
-
-    // Compare the buffer contents with respect to the data length
-    return std::equal(buffer, buffer + data_length, other.buffer);
-}
-
-/*
- *  DataBuffer::operator!=()
- *
- *  Description:
- *      This operator will compare this data buffer with another.  Two
- *      DataBuffer objects are considered equal if both have the same
- *      data length and the data length portion of the buffer contents are
- *      identical.  The read position value is not a factor in equality.
- *
- *  Parameters:
- *      other [in]
- *          A reference to the other data buffer with which to compare.
- *
- *  Returns:
- *      True if not equal, false of equal.
- *
- *  Comments:
- *      None.
- */
-bool DataBuffer::operator!=(const DataBuffer &other)
-{
-    return !(operator==(other));
-}
-
-/*
- *  DataBuffer::operator[]()
- *
- *  Description:
- *      This operator will return a reference to the octet in the buffer
- *      at the specified offset.  This operates on the buffer irrespective of
- *      the data length in the buffer.
- *
- *  Parameters:
- *      index [in]
- *          The buffer index for which an octet reference is requested.
- *
- *  Returns:
- *      A reference to the octet at the given index.  If the index is beyond
- *      the data buffer size, an exception will be thrown.
- *
- *  Comments:
- *      None.
- */
-std::uint8_t &DataBuffer::operator[](std::size_t index)
-{
-    if (index >= buffer_size)
-    {
-        throw DataBufferException("Index is beyond the data buffer");
-    }
-
-    return buffer[index];
-}
-
-/*
- *  DataBuffer::operator[]()
- *
- *  Description:
- *      This operator will return a reference to the octet in the buffer
- *      at the specified offset.  This operates on the buffer irrespective of
- *      the data length in the buffer.
- *
- *  Parameters:
- *      index [in]
- *          The buffer index for which an octet reference is requested.
- *
- *  Returns:
- *      A reference to the octet at the given index.  If the index is beyond
- *      the data buffer size, an exception will be thrown.
- *
- *  Comments:
- *      None.
- */
-const std::uint8_t &DataBuffer::operator[](std::size_t index) const
-{
-    if (index >= buffer_size)
-    {
-        throw DataBufferException("Index is beyond the data buffer");
-    }
-
-    return buffer[index];
-}
-
-/*
- *  DataBuffer::begin()
- *
- *  Description:
- *      This function is used to facilitate passing the DataBuffer object
- *      to functions that utilize iterators.  This allows the DataBuffer to
- *      be passed to functions accepting spans or used in range-based for loops.
- *
- *  Parameters:
- *      None.
- *
- *  Returns:
- *      An span iterator for the underlying data buffer.
- *
- *  Comments:
- *      None.
- */
-std::span<std::uint8_t>::iterator DataBuffer::begin() const noexcept
-{
-    return GetBufferSpan().begin();
-}
-
-/*
- *  DataBuffer::end()
- *
- *  Description:
- *      This function is used to facilitate passing the DataBuffer object
- *      to functions that utilize iterators.  This allows the DataBuffer to
- *      be passed to functions accepting spans or used in range-based for loops.
- *
- *  Parameters:
- *      None.
- *
- *  Returns:
- *      An span iterator for the underlying data buffer.
- *
- *  Comments:
- *      None.
- */
-std::span<std::uint8_t>::iterator DataBuffer::end() const noexcept
-{
-    return GetBufferSpan().end();
-}
-
-/*
- *  DataBuffer::SetValue()
- *
- *  Description:
- *      This function will place the given value into the buffer at the
- *      given offset.
- *
- *  Parameters:
- *      value [in]
- *          The span of octets to insert into the data buffer.
- *
- *      offset [in]
- *          The offset into the buffer at which the octets will be inserted.
- *
- *  Returns:
- *      Nothing.
- *
- *  Comments:
- *      None.
- */
-void DataBuffer::SetValue(const std::span<const std::uint8_t> value,
-                          std::size_t offset)
-{
-    // If there is nothing to write, just return
-    if (value.empty()) return;
-
-    // Ensure this operation will not write beyond the buffer
-    if ((offset + value.size()) > buffer_size)
-    {
-        throw DataBufferException("Attempt to write beyond the buffer");
-    }
-
-    // Copy the octets from the data buffer into the span
-    std::copy_n(value.data(), value.size(), buffer + offset);
-}
-
-/*
- *  DataBuffer::SetValue()
- *
- *  Description:
- *      This function will place the given value into the buffer at the
- *      given offset.
- *
- *  Parameters:
- *      value [in]
- *          The span of octets to insert into the data buffer.
- *
- *      offset [in]
- *          The offset into the buffer at which the octets will be inserted.
- *
- *  Returns:
- *      Nothing.
- *
- *  Comments:
- *      None.
- */
-void DataBuffer::SetValue(const std::span<const char> value, std::size_t offset)
-{
-    // This library assumes a character is 8 bits
-    static_assert(CHAR_BIT == 8);
+    if ((new_buffer_size == 0) || (new_data_length > new_buffer_size))
+    {
+        throw DataBufferException("Setting buffer with invalid argument(s)");
+    }
 
-    SetValue(
-        { reinterpret_cast<const std::uint8_t *>(value.data()), value.size() },
-        offset);
+    // Set various member variables
+    buffer = new_buffer;
+    buffer_size = new_buffer_size;
+    data_length = new_data_length;
 }
 
 /*
- *  DataBuffer::SetValue()
+ *  DataBuffer::GetBufferPool()
  *
  *  Description:
- *      This function will place the given value into the buffer at the
- *      given offset.
+ *      Returns the BufferPool from which this DataBuffer borrows memory.
  *
  *  Parameters:
- *      value [in]
- *          The value to insert into the data buffer.
- *
- *      offset [in]
- *          The offset into the buffer at which the values will be inserted.
+ *      None.
  *
  *  Returns:
- *      Nothing.
+ *      A pointer to the BufferPool or nullptr if memory is allocated from
+ *      the heap.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::SetValue(std::uint8_t value, std::size_t offset)
+BufferPool *DataBuffer::GetBufferPool() const
 {
-    // Ensure this operation will not write beyond the buffer
-    if (offset >= buffer_size)
-    {
-        throw DataBufferException("Attempt to write beyond the buffer");
-    }
-
-    // Put the value into the buffer
-    buffer[offset] = value;
+    return buffer_pool;
 }
 
 /*
- *  DataBuffer::SetValue()
+ *  DataBuffer::GetMemoryResource()
  *
  *  Description:
- *      This function will place the given value into the buffer at the
- *      given offset.
+ *      Returns the memory resource from which this DataBuffer allocates
+ *      memory.
  *
  *  Parameters:
- *      value [in]
- *          The value to insert into the data buffer.
- *
- *      offset [in]
- *          The offset into the buffer at which the value will be inserted.
+ *      None.
  *
  *  Returns:
- *      Nothing.
+ *      A pointer to the memory resource or nullptr if memory is not
+ *      allocated from a memory resource.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::SetValue(std::int8_t value, std::size_t offset)
+std::pmr::memory_resource *DataBuffer::GetMemoryResource() const
 {
-    // Ensure this operation will not write beyond the buffer
-    if (offset >= buffer_size)
-    {
-        throw DataBufferException("Attempt to write beyond the buffer");
-    }
-
-    // Put the value into the buffer
-    buffer[offset] = static_cast<std::uint8_t>(value);
+    return memory_resource;
 }
 
 /*
- *  DataBuffer::SetValue()
+ *  DataBuffer::SetGrowable()
  *
  *  Description:
- *      This function will place the given value into the buffer at the
- *      given offset.
+ *      Specify whether this DataBuffer should grow when appending data beyond
+ *      the size of the buffer.
  *
  *  Parameters:
- *      value [in]
- *          The value to insert into the data buffer.
- *
- *      offset [in]
- *          The offset into the buffer at which the value will be inserted.
+ *      growable [in]
+ *          True if the DataBuffer should grow as needed, false if not.
  *
  *  Returns:
  *      Nothing.
@@ -1029,788 +969,838 @@ void DataBuffer::SetValue(std::int8_t value, std::size_t offset)
  *  Comments:
  *      None.
  */
-void DataBuffer::SetValue(std::uint16_t value, std::size_t offset)
+void DataBuffer::SetGrowable(bool growable)
 {
-    value = BitUtil::NetworkByteOrder(value);
-
-    SetValue({ reinterpret_cast<const std::uint8_t *>(&value), sizeof(value) },
-             offset);
+    this->growable = growable;
 }
 
 /*
- *  DataBuffer::SetValue()
+ *  DataBuffer::Reserve()
  *
  *  Description:
- *      This function will place the given value into the buffer at the
- *      given offset.
+ *      Ensure that the underlying buffer is at least the specified size,
+ *      reallocating the buffer and preserving its contents if necessary.
+ *      The buffer is never reduced in size by this function.
  *
  *  Parameters:
- *      value [in]
- *          The value to insert into the data buffer.
- *
- *      offset [in]
- *          The offset into the buffer at which the value will be inserted.
+ *      size [in]
+ *          The minimum required size of the underlying buffer.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing.  However, an exception will be thrown if the buffer must be
+ *      reallocated but is not owned by this DataBuffer or if memory
+ *      allocation fails.
  *
  *  Comments:
- *      None.
+ *      This function may be called on any DataBuffer that owns its memory
+ *      or has no buffer, whether growable or not.
  */
-void DataBuffer::SetValue(std::int16_t value, std::size_t offset)
+void DataBuffer::Reserve(std::size_t size)
 {
-    SetValue(static_cast<uint16_t>(value), offset);
+    // Nothing to do if the buffer is already large enough
+    if (size <= buffer_size) return;
+
+    // Memory that is not owned by this object cannot be reallocated
+    if (!owns_buffer && (buffer != nullptr))
+    {
+        throw DataBufferException("Cannot reallocate a buffer that is not "
+                                  "owned by the DataBuffer");
+    }
+
+    ReallocateBuffer(size);
 }
 
 /*
- *  DataBuffer::SetValue()
+ *  DataBuffer::Resize()
  *
  *  Description:
- *      This function will place the given value into the buffer at the
- *      given offset.
+ *      Change the size of the underlying buffer to exactly the specified size,
+ *      preserving as much of the existing contents as will fit.  If the
+ *      buffer is reduced in size, the data length and read position will be
+ *      reduced as necessary to remain within the buffer.
  *
  *  Parameters:
- *      value [in]
- *          The value to insert into the data buffer.
- *
- *      offset [in]
- *          The offset into the buffer at which the value will be inserted.
+ *      size [in]
+ *          The new size of the underlying buffer.  If zero, the buffer is
+ *          freed.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing.  However, an exception will be thrown if the buffer is not
+ *      owned by this DataBuffer or if memory allocation fails.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::SetValue(std::uint32_t value, std::size_t offset)
+void DataBuffer::Resize(std::size_t size)
 {
-    value = BitUtil::NetworkByteOrder(value);
+    // Nothing to do if the buffer is already the requested size
+    if (size == buffer_size) return;
+
+    // Memory that is not owned by this object cannot be reallocated
+    if (!owns_buffer && (buffer != nullptr))
+    {
+        throw DataBufferException("Cannot reallocate a buffer that is not "
+                                  "owned by the DataBuffer");
+    }
+
+    // A zero size means there should be no buffer
+    if (size == 0)
+    {
+        FreeBuffer();
+        return;
+    }
 
-    SetValue({ reinterpret_cast<const std::uint8_t *>(&value), sizeof(value) },
-             offset);
+    ReallocateBuffer(size);
 }
 
 /*
- *  DataBuffer::SetValue()
+ *  DataBuffer::SetDataLength()
  *
  *  Description:
- *      This function will place the given value into the buffer at the
- *      given offset.
+ *      Set the length of data stored in the DataBuffer.  Setting the data
+ *      length will also cause the read position to be reset to the start
+ *      of the data buffer.
  *
  *  Parameters:
- *      value [in]
- *          The value to insert into the data buffer.
- *
- *      offset [in]
- *          The offset into the buffer at which the value will be inserted.
+ *      length [in]
+ *          The value to set as the new data length.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing is returned, but an exception will be thrown if the given length
+ *      is beyond the size of the underlying buffer.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::SetValue(std::int32_t value, std::size_t offset)
+void DataBuffer::SetDataLength(std::size_t length)
 {
-    SetValue(static_cast<std::uint32_t>(value), offset);
+    if (length > buffer_size)
+    {
+        throw DataBufferException("Cannot set the data length beyond the "
+                                  "buffer size");
+    }
+
+    // Set the data_length
+    data_length = length;
+
+    // Reset the read position to the start of the buffer
+    read_position = 0;
 }
 
 /*
- *  DataBuffer::SetValue()
+ *  DataBuffer::Consume()
  *
  *  Description:
- *      This function will place the given value into the buffer at the
- *      given offset.
+ *      Advance the read position past the given number of octets that have
+ *      been processed and, if the octets that have been read occupy at least
+ *      the given fraction of the buffer, move the unread data to the front of
+ *      the buffer.
  *
  *  Parameters:
- *      value [in]
- *          The value to insert into the data buffer.
+ *      length [in]
+ *          The number of octets to consume.
  *
- *      offset [in]
- *          The offset into the buffer at which the value will be inserted.
+ *      compact_fraction [in]
+ *          The fraction of the buffer size (between 0.0 and 1.0) that octets
+ *          already read must occupy before the unread data is moved.  A
+ *          value of 0.0 will move unread data on every call, while a value
+ *          greater than 1.0 will never move data.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing.  An exception will be thrown if the length exceeds the unread
+ *      data length.
  *
  *  Comments:
- *      None.
+ *      If all of the data has been consumed, the read position and data length
+ *      are reset to zero without moving any data.
  */
-void DataBuffer::SetValue(std::uint64_t value, std::size_t offset)
+void DataBuffer::Consume(std::size_t length, double compact_fraction)
 {
-    value = BitUtil::NetworkByteOrder(value);
-    SetValue({ reinterpret_cast<const std::uint8_t *>(&value), sizeof(value) },
-             offset);
+    AdvanceReadPosition(length);
+
+    // Move the data only if enough of the buffer has been consumed
+    if ((read_position == data_length) ||
+        (static_cast<double>(read_position) >=
+         (compact_fraction * static_cast<double>(buffer_size))))
+    {
+        Compact();
+    }
 }
 
 /*
- *  DataBuffer::SetValue()
+ *  DataBuffer::Compact()
  *
  *  Description:
- *      This function will place the given value into the buffer at the
- *      given offset.
+ *      Move the unread data to the front of the buffer, making the space
+ *      occupied by octets already read available for appending.
  *
  *  Parameters:
- *      value [in]
- *          The value to insert into the data buffer.
- *
- *      offset [in]
- *          The offset into the buffer at which the value will be inserted.
+ *      None.
  *
  *  Returns:
  *      Nothing.
  *
  *  Comments:
- *      None.
+ *      Following this call, the read position is zero and the data length is
+ *      the length of the unread data.  Any octets beyond the data length are
+ *      not moved.
  */
-void DataBuffer::SetValue(std::int64_t value, std::size_t offset)
+void DataBuffer::Compact()
 {
-    SetValue(static_cast<std::uint64_t>(value), offset);
+    // Nothing to do if nothing has been read
+    if (read_position == 0) return;
+
+    const std::size_t unread_length = data_length - read_position;
+
+    if (unread_length > 0)
+    {
+        std::memmove(buffer, buffer + read_position, unread_length);
+    }
+
+    data_length = unread_length;
+    read_position = 0;
 }
 
 /*
- *  DataBuffer::SetValue()
+ *  DataBuffer::GetFreeSpan()
  *
  *  Description:
- *      This function will place the given value into the buffer at the
- *      given offset.
+ *      Get a span over the free space following the data into which data may
+ *      be written (e.g., received from a socket).
  *
  *  Parameters:
- *      value [in]
- *          The value to insert into the data buffer.
- *
- *      offset [in]
- *          The offset into the buffer at which the value will be inserted.
+ *      length [in]
+ *          The minimum number of octets of free space required.  If the
+ *          DataBuffer is growable, it will be grown as necessary to provide
+ *          this much space.  This defaults to zero.
  *
  *  Returns:
- *      Nothing.
+ *      A span over the free space following the data.  An exception will be
+ *      thrown if the required free space is not available.
  *
  *  Comments:
- *      None.
+ *      After writing into the span, AdvanceDataLength() should be called with
+ *      the number of octets written.  The span is invalidated if the buffer
+ *      is grown or replaced.
  */
-void DataBuffer::SetValue(float value, std::size_t offset)
+std::span<std::uint8_t> DataBuffer::GetFreeSpan(std::size_t length)
 {
-    // Ensure the assumption that a float is 32 bits in length
-    static_assert(sizeof(value) == 4, "Float values are not the expected size");
+    EnsureAppendSpace(length);
 
-    std::uint32_t binary32{};
+    if (!InBounds(data_length, length, buffer_size))
+    {
+        throw DataBufferException("Insufficient free space in the buffer");
+    }
 
-    std::copy_n(reinterpret_cast<std::uint8_t *>(&value),
-                sizeof(binary32),
-                reinterpret_cast<std::uint8_t *>(&binary32));
+    if (buffer == nullptr) return {};
 
-    SetValue(binary32, offset);
+    return {buffer + data_length, buffer_size - data_length};
 }
 
 /*
- *  DataBuffer::SetValue()
+ *  DataBuffer::AdvanceDataLength()
  *
  *  Description:
- *      This function will place the given value into the buffer at the
- *      given offset.
+ *      Advance the data length to include octets written into the span
+ *      returned by GetFreeSpan().
  *
  *  Parameters:
- *      value [in]
- *          The value to insert into the data buffer.
- *
- *      offset [in]
- *          The offset into the buffer at which the value will be inserted.
+ *      length [in]
+ *          The number of octets written.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing.  An exception will be thrown if the data length would exceed
+ *      the buffer size.
  *
  *  Comments:
- *      None.
+ *      Unlike SetDataLength(), the read position is not changed.
  */
-void DataBuffer::SetValue(double value, std::size_t offset)
+void DataBuffer::AdvanceDataLength(std::size_t length)
 {
-    // Ensure the assumption that a float is 64 bits in length
-    static_assert(sizeof(value) == 8,
-                  "Double values are not the expected size");
-
-    std::uint64_t binary64{};
-
-    std::copy_n(reinterpret_cast<std::uint8_t *>(&value),
-                sizeof(binary64),
-                reinterpret_cast<std::uint8_t *>(&binary64));
+    if (!InBounds(data_length, length, buffer_size))
+    {
+        throw DataBufferException("Cannot set the data length beyond the "
+                                  "buffer size");
+    }
 
-    SetValue(binary64, offset);
+    data_length += length;
 }
 
 /*
- *  DataBuffer::GetValue()
+ *  DataBuffer::operator==()
  *
  *  Description:
- *      This function will read octets from the buffer at the given offset
- *      and place them in the span "value".
+ *      This operator will compare this data buffer with another.  Two
+ *      DataBuffer objects are considered equal if both have the same
+ *      data length and the data length portion of the buffer contents are
+ *      identical.  The read position value is not a factor in equality.
  *
  *  Parameters:
- *      value [out]
- *          The span into which octets will be copied out of the data
- *          buffer.
- *
- *      offset [in]
- *          The offset into the buffer from which the octets will be read.
+ *      other [in]
+ *          A reference to the other data buffer with which to compare.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data outside of the buffer.
+ *      True if equal, false of not equal.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::GetValue(std::span<std::uint8_t> value,
-                          std::size_t offset) const
+bool DataBuffer::operator==(const DataBuffer &other) const
 {
-    // If there is nothing to read, just return
-    if (value.empty()) return;
+    // Is the data length the same?
+    if (data_length != other.data_length) return false;
 
-    // Ensure this operation will not read beyond the buffer
-    if ((offset + value.size()) > buffer_size)
-    {
-        throw DataBufferException("Attempt to read beyond the buffer");
-    }
+    // If the data length is zero, they are equal
+    if (data_length == 0) return true;
 
-    // Copy the octets from the data buffer into the span
-    std::copy_n(buffer + offset, value.size(), value.data());
+    // Compare the buffer contents with respect to the data length
+    return std::equal(buffer, buffer + data_length, other.buffer);
 }
 
 /*
- *  DataBuffer::GetValue()
+ *  DataBuffer::operator!=()
  *
  *  Description:
- *      This function will read octets from the buffer at the given offset
- *      and place them in the span referred to by "value".
+ *      This operator will compare this data buffer with another.  Two
+ *      DataBuffer objects are considered equal if both have the same
+ *      data length and the data length portion of the buffer contents are
+ *      identical.  The read position value is not a factor in equality.
  *
  *  Parameters:
- *      value [out]
- *          The span into which octets will be copied out of the data
- *          buffer.
- *
- *      offset [in]
- *          The offset into the buffer from which the octets will be read.
+ *      other [in]
+ *          A reference to the other data buffer with which to compare.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data outside of the buffer.
+ *      True if not equal, false of equal.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::GetValue(std::span<char> value, std::size_t offset) const
+bool DataBuffer::operator!=(const DataBuffer &other) const
 {
-    // If there is nothing to read, just return
-    if (value.empty()) return;
-
-    // Ensure this operation will not read beyond the buffer
-    if ((offset + value.size()) > buffer_size)
-    {
-        throw DataBufferException("Attempt to read beyond the buffer");
-    }
-
-    // Copy the octets from the data buffer into the span
-    std::copy_n(buffer + offset,
-                value.size(),
-                reinterpret_cast<std::uint8_t *>(value.data()));
+    return !(operator==(other));
 }
 
 /*
- *  DataBuffer::GetValue()
+ *  DataBuffer::SetArray()
  *
  *  Description:
- *      This function will read a value from the buffer at the given offset.
+ *      This function will place the given array of values into the buffer
+ *      at the given offset in network byte order.
  *
  *  Parameters:
- *      value [out]
- *          The value to retrieve from the buffer.
+ *      values [in]
+ *          The values to insert into the data buffer.
  *
  *      offset [in]
- *          The offset into the buffer from which the value will be read.
+ *          The offset into the buffer at which the values will be inserted.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data outside of the buffer.
+ *      Nothing.  An exception will be thrown if the values would be written
+ *      beyond the buffer, in which case nothing is written.
  *
  *  Comments:
- *      None.
+ *      The buffer bounds are checked once for the entire array.
  */
-void DataBuffer::GetValue(std::uint8_t &value, std::size_t offset) const
+template<typename T>
+void DataBuffer::SetArray(std::span<const T> values, std::size_t offset)
 {
-    // Ensure this operation will not read beyond the buffer
-    if (offset >= buffer_size)
+    // If there is nothing to write, just return
+    if (values.empty()) return;
+
+    // Ensure this operation will not write beyond the buffer
+    if ((offset > buffer_size) || (values.size_bytes() > buffer_size - offset))
     {
-        throw DataBufferException("Attempt to read beyond the buffer");
+        throw DataBufferException("Attempt to write beyond the buffer");
     }
 
-    // Assign the value
-    value = buffer[offset];
+    CopyNetworkOrder<sizeof(T)>(
+        reinterpret_cast<const std::uint8_t *>(values.data()),
+        buffer + offset,
+        values.size());
 }
 
 /*
- *  DataBuffer::GetValue()
+ *  DataBuffer::GetArray()
  *
  *  Description:
- *      This function will read a value from the buffer at the given offset.
+ *      This function will read an array of values in network byte order
+ *      from the buffer at the given offset.
  *
  *  Parameters:
- *      value [out]
- *          The value to retrieve from the buffer.
+ *      values [out]
+ *          The span into which values will be read.
  *
  *      offset [in]
- *          The offset into the buffer from which the value will be read.
+ *          The offset into the buffer from which the values will be read.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data outside of the buffer.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data outside of the buffer.
  *
  *  Comments:
- *      None.
+ *      The buffer bounds are checked once for the entire array.
  */
-void DataBuffer::GetValue(std::int8_t &value, std::size_t offset) const
+template<typename T>
+void DataBuffer::GetArray(std::span<T> values, std::size_t offset) const
 {
+    // If there is nothing to read, just return
+    if (values.empty()) return;
+
     // Ensure this operation will not read beyond the buffer
-    if (offset >= buffer_size)
+    if ((offset > buffer_size) || (values.size_bytes() > buffer_size - offset))
     {
         throw DataBufferException("Attempt to read beyond the buffer");
     }
 
-    value = static_cast<std::int8_t>(buffer[offset]);
+    CopyNetworkOrder<sizeof(T)>(buffer + offset,
+                                reinterpret_cast<std::uint8_t *>(values.data()),
+                                values.size());
 }
 
 /*
- *  DataBuffer::GetValue()
+ *  DataBuffer::SetValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the given offset.
+ *      This function will place the given array of values into the buffer
+ *      at the given offset.
  *
  *  Parameters:
- *      value [out]
- *          The value to retrieve from the buffer.
+ *      values [in]
+ *          The values to insert into the data buffer.
  *
  *      offset [in]
- *          The offset into the buffer from which the value will be read.
+ *          The offset into the buffer at which the values will be inserted.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data outside of the buffer.
+ *      Nothing.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::GetValue(std::uint16_t &value, std::size_t offset) const
+void DataBuffer::SetValues(std::span<const std::uint16_t> values,
+                           std::size_t offset)
 {
-    GetValue({ reinterpret_cast<std::uint8_t *>(&value), sizeof(value) },
-             offset);
-    value = BitUtil::NetworkByteOrder(value);
+    SetArray(values, offset);
 }
 
 /*
- *  DataBuffer::GetValue()
+ *  DataBuffer::SetValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the given offset.
+ *      This function will place the given array of values into the buffer
+ *      at the given offset.
  *
  *  Parameters:
- *      value [out]
- *          The value to retrieve from the buffer.
+ *      values [in]
+ *          The values to insert into the data buffer.
  *
  *      offset [in]
- *          The offset into the buffer from which the value will be read.
+ *          The offset into the buffer at which the values will be inserted.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data outside of the buffer.
+ *      Nothing.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::GetValue(std::int16_t &value, std::size_t offset) const
+void DataBuffer::SetValues(std::span<const std::int16_t> values,
+                           std::size_t offset)
 {
-    GetValue({ reinterpret_cast<std::uint8_t *>(&value), sizeof(value) },
-             offset);
-    value = static_cast<std::int16_t>(
-        BitUtil::NetworkByteOrder(static_cast<std::uint16_t>(value)));
+    SetArray(values, offset);
 }
 
 /*
- *  DataBuffer::GetValue()
+ *  DataBuffer::SetValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the given offset.
+ *      This function will place the given array of values into the buffer
+ *      at the given offset.
  *
  *  Parameters:
- *      value [out]
- *          The value to retrieve from the buffer.
+ *      values [in]
+ *          The values to insert into the data buffer.
  *
  *      offset [in]
- *          The offset into the buffer from which the value will be read.
+ *          The offset into the buffer at which the values will be inserted.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data outside of the buffer.
+ *      Nothing.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::GetValue(std::uint32_t &value, std::size_t offset) const
+void DataBuffer::SetValues(std::span<const std::uint32_t> values,
+                           std::size_t offset)
 {
-    GetValue({ reinterpret_cast<std::uint8_t *>(&value), sizeof(value) },
-             offset);
-    value = BitUtil::NetworkByteOrder(value);
+    SetArray(values, offset);
 }
 
 /*
- *  DataBuffer::GetValue()
+ *  DataBuffer::SetValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the given offset.
+ *      This function will place the given array of values into the buffer
+ *      at the given offset.
  *
  *  Parameters:
- *      value [out]
- *          The value to retrieve from the buffer.
+ *      values [in]
+ *          The values to insert into the data buffer.
  *
  *      offset [in]
- *          The offset into the buffer from which the value will be read.
+ *          The offset into the buffer at which the values will be inserted.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data outside of the buffer.
+ *      Nothing.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::GetValue(std::int32_t &value, std::size_t offset) const
+void DataBuffer::SetValues(std::span<const std::int32_t> values,
+                           std::size_t offset)
 {
-    GetValue({ reinterpret_cast<std::uint8_t *>(&value), sizeof(value) },
-             offset);
-    value = static_cast<std::int32_t>(
-        BitUtil::NetworkByteOrder(static_cast<std::uint32_t>(value)));
+    SetArray(values, offset);
 }
 
 /*
- *  DataBuffer::GetValue()
+ *  DataBuffer::SetValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the given offset.
+ *      This function will place the given array of values into the buffer
+ *      at the given offset.
  *
  *  Parameters:
- *      value [out]
- *          The value to retrieve from the buffer.
+ *      values [in]
+ *          The values to insert into the data buffer.
  *
  *      offset [in]
- *          The offset into the buffer from which the value will be read.
+ *          The offset into the buffer at which the values will be inserted.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data outside of the buffer.
+ *      Nothing.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::GetValue(std::uint64_t &value, std::size_t offset) const
+void DataBuffer::SetValues(std::span<const std::uint64_t> values,
+                           std::size_t offset)
 {
-    GetValue({ reinterpret_cast<std::uint8_t *>(&value), sizeof(value) },
-             offset);
-    value = BitUtil::NetworkByteOrder(value);
+    SetArray(values, offset);
 }
 
 /*
- *  DataBuffer::GetValue()
+ *  DataBuffer::SetValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the given offset.
+ *      This function will place the given array of values into the buffer
+ *      at the given offset.
  *
  *  Parameters:
- *      value [out]
- *          The value to retrieve from the buffer.
+ *      values [in]
+ *          The values to insert into the data buffer.
  *
  *      offset [in]
- *          The offset into the buffer from which the value will be read.
+ *          The offset into the buffer at which the values will be inserted.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data outside of the buffer.
+ *      Nothing.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::GetValue(std::int64_t &value, std::size_t offset) const
+void DataBuffer::SetValues(std::span<const std::int64_t> values,
+                           std::size_t offset)
 {
-    GetValue({ reinterpret_cast<std::uint8_t *>(&value), sizeof(value) },
-             offset);
-    value = static_cast<std::int64_t>(
-        BitUtil::NetworkByteOrder(static_cast<std::uint64_t>(value)));
+    SetArray(values, offset);
 }
 
 /*
- *  DataBuffer::GetValue()
+ *  DataBuffer::SetValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the given offset.
+ *      This function will place the given array of values into the buffer
+ *      at the given offset.
  *
  *  Parameters:
- *      value [out]
- *          The value to retrieve from the buffer.
+ *      values [in]
+ *          The values to insert into the data buffer.
  *
  *      offset [in]
- *          The offset into the buffer from which the value will be read.
+ *          The offset into the buffer at which the values will be inserted.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data outside of the buffer.
+ *      Nothing.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::GetValue(float &value, std::size_t offset) const
+void DataBuffer::SetValues(std::span<const float> values,
+                           std::size_t offset)
 {
-    std::uint32_t binary32{};
-
-    GetValue(binary32, offset);
-
-    // Copy the octets from the data buffer into the span
-    std::copy_n(reinterpret_cast<std::uint8_t *>(&binary32),
-                sizeof(binary32),
-                reinterpret_cast<std::uint8_t *>(&value));
+    SetArray(values, offset);
 }
 
 /*
- *  DataBuffer::GetValue()
+ *  DataBuffer::SetValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the given offset.
+ *      This function will place the given array of values into the buffer
+ *      at the given offset.
  *
  *  Parameters:
- *      value [out]
- *          The value to retrieve from the buffer.
+ *      values [in]
+ *          The values to insert into the data buffer.
  *
  *      offset [in]
- *          The offset into the buffer from which the value will be read.
+ *          The offset into the buffer at which the values will be inserted.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data outside of the buffer.
+ *      Nothing.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::GetValue(double &value, std::size_t offset) const
+void DataBuffer::SetValues(std::span<const double> values,
+                           std::size_t offset)
 {
-    std::uint64_t binary64{};
-
-    GetValue(binary64, offset);
-
-    // Copy the octets from the data buffer into the span
-    std::copy_n(reinterpret_cast<std::uint8_t *>(&binary64),
-                sizeof(binary64),
-                reinterpret_cast<std::uint8_t *>(&value));
+    SetArray(values, offset);
 }
 
 /*
- *  DataBuffer::AppendValue()
+ *  DataBuffer::GetValues()
  *
  *  Description:
- *      This function will append the given span of octets to the end of the
- *      existing data in the buffer as determined by the data length value.
+ *      This function will read an array of values from the buffer at the
+ *      given offset.
  *
  *  Parameters:
- *      value [in]
- *          The span of octets to append to the end of the existing data.
+ *      values [out]
+ *          The span into which values will be read.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the values will be read.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data outside of the buffer.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::AppendValue(const std::span<const std::uint8_t> value)
+void DataBuffer::GetValues(std::span<std::uint16_t> values,
+                           std::size_t offset) const
 {
-    SetValue(value, data_length);
-    data_length += value.size();
+    GetArray(values, offset);
 }
 
 /*
- *  DataBuffer::AppendValue()
+ *  DataBuffer::GetValues()
  *
  *  Description:
- *      This function will append the given span to the end of the
- *      existing data in the buffer as determined by the data length value.
+ *      This function will read an array of values from the buffer at the
+ *      given offset.
  *
  *  Parameters:
- *      value [in]
- *          The span of characters to append to the end of the existing data.
+ *      values [out]
+ *          The span into which values will be read.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the values will be read.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data outside of the buffer.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::AppendValue(const std::span<const char> value)
+void DataBuffer::GetValues(std::span<std::int16_t> values,
+                           std::size_t offset) const
 {
-    SetValue(value, data_length);
-    data_length += value.size();
+    GetArray(values, offset);
 }
 
 /*
- *  DataBuffer::AppendValue()
+ *  DataBuffer::GetValues()
  *
  *  Description:
- *      This function will append the given value to the end of the existing
- *      data in the buffer as determined by the data length value.
+ *      This function will read an array of values from the buffer at the
+ *      given offset.
  *
  *  Parameters:
- *      value [in]
- *          The value to append to the end of the existing data.
+ *      values [out]
+ *          The span into which values will be read.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the values will be read.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data outside of the buffer.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::AppendValue(std::uint8_t value)
+void DataBuffer::GetValues(std::span<std::uint32_t> values,
+                           std::size_t offset) const
 {
-    SetValue(value, data_length);
-    data_length += sizeof(value);
+    GetArray(values, offset);
 }
 
 /*
- *  DataBuffer::AppendValue()
+ *  DataBuffer::GetValues()
  *
  *  Description:
- *      This function will append the given value to the end of the existing
- *      data in the buffer as determined by the data length value.
+ *      This function will read an array of values from the buffer at the
+ *      given offset.
  *
  *  Parameters:
- *      value [in]
- *          The value to append to the end of the existing data.
+ *      values [out]
+ *          The span into which values will be read.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the values will be read.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data outside of the buffer.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::AppendValue(std::int8_t value)
+void DataBuffer::GetValues(std::span<std::int32_t> values,
+                           std::size_t offset) const
 {
-    SetValue(value, data_length);
-    data_length += sizeof(value);
+    GetArray(values, offset);
 }
 
 /*
- *  DataBuffer::AppendValue()
+ *  DataBuffer::GetValues()
  *
  *  Description:
- *      This function will append the given value to the end of the existing
- *      data in the buffer as determined by the data length value.
+ *      This function will read an array of values from the buffer at the
+ *      given offset.
  *
  *  Parameters:
- *      value [in]
- *          The value to append to the end of the existing data.
+ *      values [out]
+ *          The span into which values will be read.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the values will be read.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data outside of the buffer.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::AppendValue(std::uint16_t value)
+void DataBuffer::GetValues(std::span<std::uint64_t> values,
+                           std::size_t offset) const
 {
-    SetValue(value, data_length);
-    data_length += sizeof(value);
+    GetArray(values, offset);
 }
 
 /*
- *  DataBuffer::AppendValue()
+ *  DataBuffer::GetValues()
  *
  *  Description:
- *      This function will append the given value to the end of the existing
- *      data in the buffer as determined by the data length value.
+ *      This function will read an array of values from the buffer at the
+ *      given offset.
  *
  *  Parameters:
- *      value [in]
- *          The value to append to the end of the existing data.
+ *      values [out]
+ *          The span into which values will be read.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the values will be read.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data outside of the buffer.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::AppendValue(std::int16_t value)
+void DataBuffer::GetValues(std::span<std::int64_t> values,
+                           std::size_t offset) const
 {
-    SetValue(value, data_length);
-    data_length += sizeof(value);
+    GetArray(values, offset);
 }
 
 /*
- *  DataBuffer::AppendValue()
+ *  DataBuffer::GetValues()
  *
  *  Description:
- *      This function will append the given value to the end of the existing
- *      data in the buffer as determined by the data length value.
+ *      This function will read an array of values from the buffer at the
+ *      given offset.
  *
  *  Parameters:
- *      value [in]
- *          The value to append to the end of the existing data.
+ *      values [out]
+ *          The span into which values will be read.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the values will be read.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data outside of the buffer.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::AppendValue(std::uint32_t value)
+void DataBuffer::GetValues(std::span<float> values,
+                           std::size_t offset) const
 {
-    SetValue(value, data_length);
-    data_length += sizeof(value);
+    GetArray(values, offset);
 }
 
 /*
- *  DataBuffer::AppendValue()
+ *  DataBuffer::GetValues()
  *
  *  Description:
- *      This function will append the given value to the end of the existing
- *      data in the buffer as determined by the data length value.
+ *      This function will read an array of values from the buffer at the
+ *      given offset.
  *
  *  Parameters:
- *      value [in]
- *          The value to append to the end of the existing data.
+ *      values [out]
+ *          The span into which values will be read.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the values will be read.
  *
  *  Returns:
- *      Nothing.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data outside of the buffer.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::AppendValue(std::int32_t value)
+void DataBuffer::GetValues(std::span<double> values,
+                           std::size_t offset) const
 {
-    SetValue(value, data_length);
-    data_length += sizeof(value);
+    GetArray(values, offset);
 }
 
 /*
- *  DataBuffer::AppendValue()
+ *  DataBuffer::AppendValues()
  *
  *  Description:
- *      This function will append the given value to the end of the existing
- *      data in the buffer as determined by the data length value.
+ *      This function will append the given array of values to the end of the
+ *      existing data in the buffer as determined by the data length value.
  *
  *  Parameters:
- *      value [in]
- *          The value to append to the end of the existing data.
+ *      values [in]
+ *          The values to append to the end of the existing data.
  *
  *  Returns:
  *      Nothing.
@@ -1818,22 +1808,23 @@ void DataBuffer::AppendValue(std::int32_t value)
  *  Comments:
  *      None.
  */
-void DataBuffer::AppendValue(std::uint64_t value)
+void DataBuffer::AppendValues(std::span<const std::uint16_t> values)
 {
-    SetValue(value, data_length);
-    data_length += sizeof(value);
+    EnsureAppendSpace(values.size_bytes());
+    SetValues(values, data_length);
+    data_length += values.size_bytes();
 }
 
 /*
- *  DataBuffer::AppendValue()
+ *  DataBuffer::AppendValues()
  *
  *  Description:
- *      This function will append the given value to the end of the existing
- *      data in the buffer as determined by the data length value.
+ *      This function will append the given array of values to the end of the
+ *      existing data in the buffer as determined by the data length value.
  *
  *  Parameters:
- *      value [in]
- *          The value to append to the end of the existing data.
+ *      values [in]
+ *          The values to append to the end of the existing data.
  *
  *  Returns:
  *      Nothing.
@@ -1841,22 +1832,23 @@ void DataBuffer::AppendValue(std::uint64_t value)
  *  Comments:
  *      None.
  */
-void DataBuffer::AppendValue(std::int64_t value)
+void DataBuffer::AppendValues(std::span<const std::int16_t> values)
 {
-    SetValue(value, data_length);
-    data_length += sizeof(value);
+    EnsureAppendSpace(values.size_bytes());
+    SetValues(values, data_length);
+    data_length += values.size_bytes();
 }
 
 /*
- *  DataBuffer::AppendValue()
+ *  DataBuffer::AppendValues()
  *
  *  Description:
- *      This function will append the given value to the end of the existing
- *      data in the buffer as determined by the data length value.
+ *      This function will append the given array of values to the end of the
+ *      existing data in the buffer as determined by the data length value.
  *
  *  Parameters:
- *      value [in]
- *          The value to append to the end of the existing data.
+ *      values [in]
+ *          The values to append to the end of the existing data.
  *
  *  Returns:
  *      Nothing.
@@ -1864,22 +1856,23 @@ void DataBuffer::AppendValue(std::int64_t value)
  *  Comments:
  *      None.
  */
-void DataBuffer::AppendValue(float value)
+void DataBuffer::AppendValues(std::span<const std::uint32_t> values)
 {
-    SetValue(value, data_length);
-    data_length += sizeof(value);
+    EnsureAppendSpace(values.size_bytes());
+    SetValues(values, data_length);
+    data_length += values.size_bytes();
 }
 
 /*
- *  DataBuffer::AppendValue()
+ *  DataBuffer::AppendValues()
  *
  *  Description:
- *      This function will append the given value to the end of the existing
- *      data in the buffer as determined by the data length value.
+ *      This function will append the given array of values to the end of the
+ *      existing data in the buffer as determined by the data length value.
  *
  *  Parameters:
- *      value [in]
- *          The value to append to the end of the existing data.
+ *      values [in]
+ *          The values to append to the end of the existing data.
  *
  *  Returns:
  *      Nothing.
@@ -1887,370 +1880,347 @@ void DataBuffer::AppendValue(float value)
  *  Comments:
  *      None.
  */
-void DataBuffer::AppendValue(double value)
+void DataBuffer::AppendValues(std::span<const std::int32_t> values)
 {
-    SetValue(value, data_length);
-    data_length += sizeof(value);
+    EnsureAppendSpace(values.size_bytes());
+    SetValues(values, data_length);
+    data_length += values.size_bytes();
 }
 
 /*
- *  DataBuffer::ReadValue()
+ *  DataBuffer::AppendValues()
  *
  *  Description:
- *      This function will read octets from the buffer at the current read
- *      position and place them in the span "value".
+ *      This function will append the given array of values to the end of the
+ *      existing data in the buffer as determined by the data length value.
  *
  *  Parameters:
- *      value [out]
- *          The span into which octets will be copied out of the data buffer.
+ *      values [in]
+ *          The values to append to the end of the existing data.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data beyond the data length.
+ *      Nothing.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::ReadValue(std::span<std::uint8_t> value)
+void DataBuffer::AppendValues(std::span<const std::uint64_t> values)
 {
-    if ((read_position + value.size()) > data_length)
-    {
-        throw DataBufferException("Attempt to read beyond the data length");
-    }
-
-    GetValue(value, read_position);
-    read_position += value.size();
+    EnsureAppendSpace(values.size_bytes());
+    SetValues(values, data_length);
+    data_length += values.size_bytes();
 }
 
 /*
- *  DataBuffer::ReadValue()
+ *  DataBuffer::AppendValues()
  *
  *  Description:
- *      This function will read octets from the buffer at the current read
- *      position and place them in the span "value".
+ *      This function will append the given array of values to the end of the
+ *      existing data in the buffer as determined by the data length value.
  *
  *  Parameters:
- *      value [out]
- *          The span into which octets will be copied out of the data buffer.
+ *      values [in]
+ *          The values to append to the end of the existing data.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data beyond the data length.
+ *      Nothing.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::ReadValue(std::span<char> value)
+void DataBuffer::AppendValues(std::span<const std::int64_t> values)
 {
-    if ((read_position + value.size()) > data_length)
-    {
-        throw DataBufferException("Attempt to read beyond the data length");
-    }
-
-    GetValue(value, read_position);
-    read_position += value.size();
+    EnsureAppendSpace(values.size_bytes());
+    SetValues(values, data_length);
+    data_length += values.size_bytes();
 }
 
 /*
- *  DataBuffer::ReadValue()
+ *  DataBuffer::AppendValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the current read
- *      position.
+ *      This function will append the given array of values to the end of the
+ *      existing data in the buffer as determined by the data length value.
  *
  *  Parameters:
- *      value [out]
- *          The value read from the data buffer at the current read position.
+ *      values [in]
+ *          The values to append to the end of the existing data.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data beyond the data length.
+ *      Nothing.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::ReadValue(std::uint8_t &value)
+void DataBuffer::AppendValues(std::span<const float> values)
 {
-    if ((read_position + sizeof(value)) > data_length)
-    {
-        throw DataBufferException("Attempt to read beyond the data length");
-    }
-
-    GetValue(value, read_position);
-    read_position += sizeof(value);
+    EnsureAppendSpace(values.size_bytes());
+    SetValues(values, data_length);
+    data_length += values.size_bytes();
 }
 
 /*
- *  DataBuffer::ReadValue()
+ *  DataBuffer::AppendValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the current read
- *      position.
+ *      This function will append the given array of values to the end of the
+ *      existing data in the buffer as determined by the data length value.
  *
  *  Parameters:
- *      value [out]
- *          The value read from the data buffer at the current read position.
+ *      values [in]
+ *          The values to append to the end of the existing data.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data beyond the data length.
+ *      Nothing.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::ReadValue(std::int8_t &value)
+void DataBuffer::AppendValues(std::span<const double> values)
 {
-    if ((read_position + sizeof(value)) > data_length)
-    {
-        throw DataBufferException("Attempt to read beyond the data length");
-    }
-
-    GetValue(value, read_position);
-    read_position += sizeof(value);
+    EnsureAppendSpace(values.size_bytes());
+    SetValues(values, data_length);
+    data_length += values.size_bytes();
 }
 
 /*
- *  DataBuffer::ReadValue()
+ *  DataBuffer::ReadValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the current read
- *      position.
+ *      This function will read an array of values from the buffer at the
+ *      current read position.
  *
  *  Parameters:
- *      value [out]
- *          The value read from the data buffer at the current read position.
+ *      values [out]
+ *          The span into which values will be read.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data beyond the data length.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data beyond the data length.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::ReadValue(std::uint16_t &value)
+void DataBuffer::ReadValues(std::span<std::uint16_t> values)
 {
-    if ((read_position + sizeof(value)) > data_length)
+    if (values.size_bytes() > (data_length - read_position))
     {
         throw DataBufferException("Attempt to read beyond the data length");
     }
 
-    GetValue(value, read_position);
-    read_position += sizeof(value);
+    GetValues(values, read_position);
+    read_position += values.size_bytes();
 }
 
 /*
- *  DataBuffer::ReadValue()
+ *  DataBuffer::ReadValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the current read
- *      position.
+ *      This function will read an array of values from the buffer at the
+ *      current read position.
  *
  *  Parameters:
- *      value [out]
- *          The value read from the data buffer at the current read position.
+ *      values [out]
+ *          The span into which values will be read.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data beyond the data length.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data beyond the data length.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::ReadValue(std::int16_t &value)
+void DataBuffer::ReadValues(std::span<std::int16_t> values)
 {
-    if ((read_position + sizeof(value)) > data_length)
+    if (values.size_bytes() > (data_length - read_position))
     {
         throw DataBufferException("Attempt to read beyond the data length");
     }
 
-    GetValue(value, read_position);
-    read_position += sizeof(value);
+    GetValues(values, read_position);
+    read_position += values.size_bytes();
 }
 
 /*
- *  DataBuffer::ReadValue()
+ *  DataBuffer::ReadValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the current read
- *      position.
+ *      This function will read an array of values from the buffer at the
+ *      current read position.
  *
  *  Parameters:
- *      value [out]
- *          The value read from the data buffer at the current read position.
+ *      values [out]
+ *          The span into which values will be read.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data beyond the data length.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data beyond the data length.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::ReadValue(std::uint32_t &value)
+void DataBuffer::ReadValues(std::span<std::uint32_t> values)
 {
-    if ((read_position + sizeof(value)) > data_length)
+    if (values.size_bytes() > (data_length - read_position))
     {
         throw DataBufferException("Attempt to read beyond the data length");
     }
 
-    GetValue(value, read_position);
-    read_position += sizeof(value);
+    GetValues(values, read_position);
+    read_position += values.size_bytes();
 }
 
 /*
- *  DataBuffer::ReadValue()
+ *  DataBuffer::ReadValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the current read
- *      position.
+ *      This function will read an array of values from the buffer at the
+ *      current read position.
  *
  *  Parameters:
- *      value [out]
- *          The value read from the data buffer at the current read position.
+ *      values [out]
+ *          The span into which values will be read.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data beyond the data length.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data beyond the data length.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::ReadValue(std::int32_t &value)
+void DataBuffer::ReadValues(std::span<std::int32_t> values)
 {
-    if ((read_position + sizeof(value)) > data_length)
+    if (values.size_bytes() > (data_length - read_position))
     {
         throw DataBufferException("Attempt to read beyond the data length");
     }
 
-    GetValue(value, read_position);
-    read_position += sizeof(value);
+    GetValues(values, read_position);
+    read_position += values.size_bytes();
 }
 
 /*
- *  DataBuffer::ReadValue()
+ *  DataBuffer::ReadValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the current read
- *      position.
+ *      This function will read an array of values from the buffer at the
+ *      current read position.
  *
  *  Parameters:
- *      value [out]
- *          The value read from the data buffer at the current read position.
+ *      values [out]
+ *          The span into which values will be read.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data beyond the data length.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data beyond the data length.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::ReadValue(std::uint64_t &value)
+void DataBuffer::ReadValues(std::span<std::uint64_t> values)
 {
-    if ((read_position + sizeof(value)) > data_length)
+    if (values.size_bytes() > (data_length - read_position))
     {
         throw DataBufferException("Attempt to read beyond the data length");
     }
 
-    GetValue(value, read_position);
-    read_position += sizeof(value);
+    GetValues(values, read_position);
+    read_position += values.size_bytes();
 }
 
 /*
- *  DataBuffer::ReadValue()
+ *  DataBuffer::ReadValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the current read
- *      position.
+ *      This function will read an array of values from the buffer at the
+ *      current read position.
  *
  *  Parameters:
- *      value [out]
- *          The value read from the data buffer at the current read position.
+ *      values [out]
+ *          The span into which values will be read.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data beyond the data length.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data beyond the data length.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::ReadValue(std::int64_t &value)
+void DataBuffer::ReadValues(std::span<std::int64_t> values)
 {
-    if ((read_position + sizeof(value)) > data_length)
+    if (values.size_bytes() > (data_length - read_position))
     {
         throw DataBufferException("Attempt to read beyond the data length");
     }
 
-    GetValue(value, read_position);
-    read_position += sizeof(value);
+    GetValues(values, read_position);
+    read_position += values.size_bytes();
 }
 
 /*
- *  DataBuffer::ReadValue()
+ *  DataBuffer::ReadValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the current read
- *      position.
+ *      This function will read an array of values from the buffer at the
+ *      current read position.
  *
  *  Parameters:
- *      value [out]
- *          The value read from the data buffer at the current read position.
+ *      values [out]
+ *          The span into which values will be read.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data beyond the data length.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data beyond the data length.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::ReadValue(float &value)
+void DataBuffer::ReadValues(std::span<float> values)
 {
-    if ((read_position + sizeof(value)) > data_length)
+    if (values.size_bytes() > (data_length - read_position))
     {
         throw DataBufferException("Attempt to read beyond the data length");
     }
 
-    GetValue(value, read_position);
-    read_position += sizeof(value);
+    GetValues(values, read_position);
+    read_position += values.size_bytes();
 }
 
 /*
- *  DataBuffer::ReadValue()
+ *  DataBuffer::ReadValues()
  *
  *  Description:
- *      This function will read a value from the buffer at the current read
- *      position.
+ *      This function will read an array of values from the buffer at the
+ *      current read position.
  *
  *  Parameters:
- *      value [out]
- *          The value read from the data buffer at the current read position.
+ *      values [out]
+ *          The span into which values will be read.
  *
  *  Returns:
- *      Nothing, though the value parameter will be populated with the requested
- *      data.  An exception will be thrown if there is a request to retrieve
- *      data beyond the data length.
+ *      Nothing, though the values parameter will be populated with the
+ *      requested data.  An exception will be thrown if there is a request to
+ *      retrieve data beyond the data length.
  *
  *  Comments:
  *      None.
  */
-void DataBuffer::ReadValue(double &value)
+void DataBuffer::ReadValues(std::span<double> values)
 {
-    if ((read_position + sizeof(value)) > data_length)
+    if (values.size_bytes() > (data_length - read_position))
     {
         throw DataBufferException("Attempt to read beyond the data length");
     }
 
-    GetValue(value, read_position);
-    read_position += sizeof(value);
+    GetValues(values, read_position);
+    read_position += values.size_bytes();
 }
 
 /*
@@ -2271,52 +2241,11 @@ void DataBuffer::ReadValue(double &value)
  *      A reference to the output stream.
  *
  *  Comments:
- *      None.
+ *      The unread portion of the buffer is dumped.  See HexDump().
  */
 std::ostream &operator<<(std::ostream &o, const DataBuffer &data_buffer)
 {
-    std::size_t octet_counter = 0;              // Octet counter
-    std::string ascii_map;                      // ASCII map of octets
-    std::ostringstream oss;                     // For line formation
-
-    // There is nothing to output if there is no data
-    if (data_buffer.GetDataLength() == 0) return o;
-
-    // We want uppercase hex digits with zero-fill integers
-    oss << std::hex << std::setfill('0') << std::uppercase;
-
-    // Iterate over the data buffer contents
-    for (const auto octet : data_buffer)
-    {
-        // Render the octet counter at the start of new lines
-        if ((octet_counter % 16) == 0)
-        {
-            oss << std::setw(8) << octet_counter;
-            oss << ":";
-        }
-
-        // Produce the hex output for this octet
-        oss << " " << std::setw(2) << static_cast<unsigned>(octet);
-
-        // Add the ASCII form to the character map
-        ascii_map += ((std::isprint(octet) != 0) ? static_cast<char>(octet) : '.');
-
-        // Produce an output line when it is complete
-        if ((++octet_counter % 16) == 0)
-        {
-            o << oss.str() << " :" << ascii_map << ":" << std::endl;
-            oss.str("");
-            ascii_map.clear();
-        }
-    }
-
-    // If there is a partial last line, produce it
-    if ((octet_counter % 16) != 0)
-    {
-        ascii_map.resize(16, ' ');
-        o << oss.str() << std::string((16 - (octet_counter % 16)) * 3, ' ')
-          << " :" << ascii_map << ":" << std::endl;
-    }
+    HexDumpTo(std::ostreambuf_iterator<char>(o), data_buffer.GetBufferSpan());
 
     return o;
 }
@@ -0,0 +1,1177 @@
+/*
+ *  data_buffer_chain.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements the DataBufferChain object, which is an ordered
+ *      list of DataBuffer segments treated as a single logical sequence of
+ *      octets.
+ *
+ *      Numeric values are appended directly to the segment being written if
+ *      there is sufficient space.  Otherwise, the value is serialized into a
+ *      temporary buffer that is then appended across segments.  Reading is
+ *      handled similarly.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <utility>
+#include <terra/netutil/data_buffer_chain.h>
+
+namespace Terra::NetUtil
+{
+
+/*
+ *  DataBufferChain::DataBufferChain()
+ *
+ *  Description:
+ *      Constructor for the DataBufferChain object.
+ *
+ *  Parameters:
+ *      segment_size [in]
+ *          The minimum size of segments allocated when appending values to
+ *          the chain.  If zero, a size of one is used.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBufferChain::DataBufferChain(std::size_t segment_size) :
+    segment_size{std::max(segment_size, std::size_t(1))},
+    read_segment{0},
+    write_segment{0}
+{
+}
+
+/*
+ *  DataBufferChain::AppendBuffer()
+ *
+ *  Description:
+ *      Append the given DataBuffer to the end of the chain.  The contents of
+ *      the DataBuffer are not copied, but rather the DataBuffer is moved into
+ *      the chain.  Any unread data in the DataBuffer becomes part of the
+ *      chain's unread data and any space following its data may be used
+ *      when appending values.
+ *
+ *  Parameters:
+ *      data_buffer [in]
+ *          The DataBuffer to move into the chain.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Any free space remaining in the preceding segment is not used once a
+ *      segment containing data is appended.
+ */
+void DataBufferChain::AppendBuffer(DataBuffer &&data_buffer)
+{
+    bool has_data = !data_buffer.Empty();
+
+    segments.push_back(std::move(data_buffer));
+
+    // Further writes follow the data in this new segment
+    if (has_data) write_segment = segments.size() - 1;
+}
+
+/*
+ *  DataBufferChain::AppendBuffer()
+ *
+ *  Description:
+ *      Append a segment referring to the given span to the end of the chain.
+ *      The span is entirely treated as data.  The chain does not take
+ *      ownership of the memory, which must remain valid while the chain
+ *      refers to it.
+ *
+ *  Parameters:
+ *      buffer [in]
+ *          The span of octets to append to the chain.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendBuffer(std::span<std::uint8_t> buffer)
+{
+    // An empty span contributes nothing
+    if (buffer.empty()) return;
+
+    AppendBuffer(DataBuffer(buffer));
+}
+
+/*
+ *  DataBufferChain::GetSegmentCount()
+ *
+ *  Description:
+ *      Return the number of segments in the chain.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The number of segments in the chain.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t DataBufferChain::GetSegmentCount() const
+{
+    return segments.size();
+}
+
+/*
+ *  DataBufferChain::GetSegment()
+ *
+ *  Description:
+ *      Return a reference to the segment at the given index.
+ *
+ *  Parameters:
+ *      index [in]
+ *          The index of the requested segment.
+ *
+ *  Returns:
+ *      A reference to the requested segment.  An exception is thrown if the
+ *      index is beyond the end of the chain.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBuffer &DataBufferChain::GetSegment(std::size_t index)
+{
+    if (index >= segments.size())
+    {
+        throw DataBufferException("Index is beyond the data buffer chain");
+    }
+
+    return segments[index];
+}
+
+/*
+ *  DataBufferChain::GetSegment()
+ *
+ *  Description:
+ *      Return a reference to the segment at the given index.
+ *
+ *  Parameters:
+ *      index [in]
+ *          The index of the requested segment.
+ *
+ *  Returns:
+ *      A reference to the requested segment.  An exception is thrown if the
+ *      index is beyond the end of the chain.
+ *
+ *  Comments:
+ *      None.
+ */
+const DataBuffer &DataBufferChain::GetSegment(std::size_t index) const
+{
+    if (index >= segments.size())
+    {
+        throw DataBufferException("Index is beyond the data buffer chain");
+    }
+
+    return segments[index];
+}
+
+/*
+ *  DataBufferChain::Clear()
+ *
+ *  Description:
+ *      Remove all segments from the chain.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::Clear()
+{
+    segments.clear();
+    read_segment = 0;
+    write_segment = 0;
+#ifndef _WIN32
+    io_vector.clear();
+#endif
+}
+
+/*
+ *  DataBufferChain::GetDataLength()
+ *
+ *  Description:
+ *      Return the total length of data in all segments of the chain.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The total length of data in the chain.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t DataBufferChain::GetDataLength() const
+{
+    std::size_t length = 0;
+
+    for (const auto &segment : segments) length += segment.GetDataLength();
+
+    return length;
+}
+
+/*
+ *  DataBufferChain::AdvanceDataLength()
+ *
+ *  Description:
+ *      Increase the length of data in the chain, distributing the length
+ *      across the free space of segments as returned by GetFreeIOVec().  This
+ *      is used after data is received directly into the free space.
+ *
+ *  Parameters:
+ *      length [in]
+ *          The number of octets by which to increase the data length.
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if the length exceeds the free space
+ *      in the chain, in which case the chain is not modified.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AdvanceDataLength(std::size_t length)
+{
+    std::size_t free_space = 0;
+
+    // Ensure there is sufficient free space
+    for (std::size_t i = write_segment; i < segments.size(); i++)
+    {
+        free_space += segments[i].GetBufferSize() -
+                      segments[i].GetDataLength();
+    }
+    if (length > free_space)
+    {
+        throw DataBufferException("Attempt to advance data length beyond the "
+                                  "free space in the chain");
+    }
+
+    while (length > 0)
+    {
+        DataBuffer *segment = GetWriteSegment(length);
+        std::size_t octets = std::min(length, segment->GetBufferSize() -
+                                                  segment->GetDataLength());
+
+        // Extend the data length while preserving the read position
+        std::size_t read_position = segment->GetReadPosition();
+        segment->SetDataLength(segment->GetDataLength() + octets);
+        segment->SetReadPosition(read_position);
+
+        length -= octets;
+    }
+}
+
+/*
+ *  DataBufferChain::Empty()
+ *
+ *  Description:
+ *      Check to see if the chain contains any data.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      True if no segment contains data, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+bool DataBufferChain::Empty() const
+{
+    return std::all_of(segments.begin(),
+                       segments.end(),
+                       [](const DataBuffer &segment)
+                       {
+                           return segment.Empty();
+                       });
+}
+
+/*
+ *  DataBufferChain::GetUnreadLength()
+ *
+ *  Description:
+ *      Return the number of octets in the chain that have not been read.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The number of unread octets in the chain.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t DataBufferChain::GetUnreadLength() const
+{
+    std::size_t length = 0;
+
+    for (std::size_t i = read_segment; i < segments.size(); i++)
+    {
+        length += segments[i].GetUnreadLength();
+    }
+
+    return length;
+}
+
+/*
+ *  DataBufferChain::AdvanceReadPosition()
+ *
+ *  Description:
+ *      Advance the read position by the specified distance in octets, which
+ *      may span several segments.  This is used after data is sent from the
+ *      areas returned by GetIOVec().
+ *
+ *  Parameters:
+ *      distance [in]
+ *          The distance in octets to advance the read position.
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if an attempt is made to advance the
+ *      read position beyond the data in the chain, in which case the read
+ *      position is not changed.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AdvanceReadPosition(std::size_t distance)
+{
+    if (distance > GetUnreadLength())
+    {
+        throw DataBufferException("Attempt to advance read position beyond "
+                                  "the data length");
+    }
+
+    while (distance > 0)
+    {
+        DataBuffer *segment = GetReadSegment();
+        std::size_t octets = std::min(distance, segment->GetUnreadLength());
+
+        segment->AdvanceReadPosition(octets);
+        distance -= octets;
+    }
+}
+
+#ifndef _WIN32
+
+/*
+ *  DataBufferChain::GetIOVec()
+ *
+ *  Description:
+ *      Return an array of iovec structures covering the unread data in the
+ *      chain, suitable for use with writev() or sendmsg().
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A span over the iovec structures, which remains valid until the next
+ *      call to GetIOVec() or GetFreeIOVec() or until the chain is modified.
+ *
+ *  Comments:
+ *      Segments having no unread data are omitted.
+ */
+std::span<const iovec> DataBufferChain::GetIOVec()
+{
+    io_vector.clear();
+
+    for (std::size_t i = read_segment; i < segments.size(); i++)
+    {
+        std::span<std::uint8_t> data = segments[i].GetBufferSpan();
+
+        if (data.empty()) continue;
+
+        io_vector.push_back({data.data(), data.size()});
+    }
+
+    return io_vector;
+}
+
+/*
+ *  DataBufferChain::GetFreeIOVec()
+ *
+ *  Description:
+ *      Return an array of iovec structures covering the free space following
+ *      the data in the chain, suitable for use with readv() or recvmsg().
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A span over the iovec structures, which remains valid until the next
+ *      call to GetIOVec() or GetFreeIOVec() or until the chain is modified.
+ *
+ *  Comments:
+ *      No segments are allocated by this function, so it is necessary to
+ *      append segments having free space (e.g., empty DataBuffer objects)
+ *      prior to calling this function.
+ */
+std::span<const iovec> DataBufferChain::GetFreeIOVec()
+{
+    io_vector.clear();
+
+    for (std::size_t i = write_segment; i < segments.size(); i++)
+    {
+        std::size_t data_length = segments[i].GetDataLength();
+        std::size_t free_space = segments[i].GetBufferSize() - data_length;
+
+        if (free_space == 0) continue;
+
+        io_vector.push_back(
+            {segments[i].GetBufferPointer(data_length), free_space});
+    }
+
+    return io_vector;
+}
+
+#endif
+
+/*
+ *  DataBufferChain::GetWriteSegment()
+ *
+ *  Description:
+ *      Return the segment into which the next octet should be written,
+ *      allocating a new segment if there is no free space in the chain.
+ *
+ *  Parameters:
+ *      length [in]
+ *          The number of octets the caller intends to write, used to size
+ *          any newly allocated segment.
+ *
+ *  Returns:
+ *      A pointer to a segment having free space.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBuffer *DataBufferChain::GetWriteSegment(std::size_t length)
+{
+    // Skip over any segments that have no free space
+    while (write_segment < segments.size())
+    {
+        DataBuffer &segment = segments[write_segment];
+
+        if (segment.GetDataLength() < segment.GetBufferSize()) return &segment;
+
+        if (write_segment + 1 == segments.size()) break;
+
+        write_segment++;
+    }
+
+    // Allocate a new segment
+    segments.emplace_back(std::max(segment_size, length));
+    write_segment = segments.size() - 1;
+
+    return &segments.back();
+}
+
+/*
+ *  DataBufferChain::GetReadSegment()
+ *
+ *  Description:
+ *      Return the segment from which the next octet should be read.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A pointer to the segment having unread data or nullptr if there is
+ *      no unread data in the chain.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBuffer *DataBufferChain::GetReadSegment()
+{
+    while (read_segment < segments.size())
+    {
+        DataBuffer &segment = segments[read_segment];
+
+        if (segment.GetUnreadLength() > 0) return &segment;
+
+        // Do not move beyond the final segment, as data may be appended
+        if (read_segment + 1 == segments.size()) break;
+
+        read_segment++;
+    }
+
+    return nullptr;
+}
+
+/*
+ *  DataBufferChain::AppendNumeric()
+ *
+ *  Description:
+ *      Append the given numeric value to the chain.  If the segment being
+ *      written has sufficient space, the value is appended directly.
+ *      Otherwise, the value is serialized and appended across segments.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+template<typename T>
+void DataBufferChain::AppendNumeric(T value)
+{
+    DataBuffer *segment = GetWriteSegment(sizeof(value));
+
+    // Append directly if the value fits in the segment
+    if ((segment->GetBufferSize() - segment->GetDataLength()) >= sizeof(value))
+    {
+        segment->AppendValue(value);
+        return;
+    }
+
+    // Serialize the value and append the octets across segments
+    std::array<std::uint8_t, sizeof(value)> octets;
+    DataBuffer(octets.data(), octets.size()).SetValue(value, 0);
+    AppendValue(std::span<const std::uint8_t>(octets));
+}
+
+/*
+ *  DataBufferChain::ReadNumeric()
+ *
+ *  Description:
+ *      Read a numeric value from the chain.  If the segment being read
+ *      holds the entire value, it is read directly.  Otherwise, the octets
+ *      are read across segments and then deserialized.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the chain.
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if there is insufficient data.
+ *
+ *  Comments:
+ *      None.
+ */
+template<typename T>
+void DataBufferChain::ReadNumeric(T &value)
+{
+    DataBuffer *segment = GetReadSegment();
+
+    // Read directly if the entire value is in the segment
+    if ((segment != nullptr) && (segment->GetUnreadLength() >= sizeof(value)))
+    {
+        segment->ReadValue(value);
+        return;
+    }
+
+    // Read the octets across segments and deserialize the value
+    std::array<std::uint8_t, sizeof(value)> octets;
+    ReadValue(std::span<std::uint8_t>(octets));
+    DataBuffer(octets.data(), octets.size()).GetValue(value, 0);
+}
+
+/*
+ *  DataBufferChain::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given span of octets to the end of the
+ *      existing data in the chain, allocating segments as necessary.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The span of octets to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendValue(const std::span<const std::uint8_t> value)
+{
+    std::span<const std::uint8_t> remaining = value;
+
+    while (!remaining.empty())
+    {
+        DataBuffer *segment = GetWriteSegment(remaining.size());
+        std::size_t octets =
+            std::min(remaining.size(),
+                     segment->GetBufferSize() - segment->GetDataLength());
+
+        segment->AppendValue(remaining.first(octets));
+        remaining = remaining.subspan(octets);
+    }
+}
+
+/*
+ *  DataBufferChain::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given span of characters to the end of
+ *      the existing data in the chain, allocating segments as necessary.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The span of characters to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendValue(const std::span<const char> value)
+{
+    // This library assumes a character is 8 bits
+    static_assert(CHAR_BIT == 8);
+
+    AppendValue(std::span<const std::uint8_t>(
+        reinterpret_cast<const std::uint8_t *>(value.data()), value.size()));
+}
+
+/*
+ *  DataBufferChain::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the chain, allocating segments as necessary.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendValue(std::uint8_t value)
+{
+    AppendNumeric(value);
+}
+
+/*
+ *  DataBufferChain::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the chain, allocating segments as necessary.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendValue(std::int8_t value)
+{
+    AppendNumeric(value);
+}
+
+/*
+ *  DataBufferChain::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the chain, allocating segments as necessary.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendValue(std::uint16_t value)
+{
+    AppendNumeric(value);
+}
+
+/*
+ *  DataBufferChain::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the chain, allocating segments as necessary.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendValue(std::int16_t value)
+{
+    AppendNumeric(value);
+}
+
+/*
+ *  DataBufferChain::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the chain, allocating segments as necessary.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendValue(std::uint32_t value)
+{
+    AppendNumeric(value);
+}
+
+/*
+ *  DataBufferChain::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the chain, allocating segments as necessary.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendValue(std::int32_t value)
+{
+    AppendNumeric(value);
+}
+
+/*
+ *  DataBufferChain::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the chain, allocating segments as necessary.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendValue(std::uint64_t value)
+{
+    AppendNumeric(value);
+}
+
+/*
+ *  DataBufferChain::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the chain, allocating segments as necessary.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendValue(std::int64_t value)
+{
+    AppendNumeric(value);
+}
+
+/*
+ *  DataBufferChain::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the chain, allocating segments as necessary.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendValue(float value)
+{
+    AppendNumeric(value);
+}
+
+/*
+ *  DataBufferChain::AppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the chain, allocating segments as necessary.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::AppendValue(double value)
+{
+    AppendNumeric(value);
+}
+
+/*
+ *  DataBufferChain::ReadValue()
+ *
+ *  Description:
+ *      This function will read octets from the chain at the current read
+ *      position and place them in the span "value".
+ *
+ *  Parameters:
+ *      value [out]
+ *          The span into which octets will be copied out of the chain.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length, in which case nothing is read.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::ReadValue(std::span<std::uint8_t> value)
+{
+    if (value.size() > GetUnreadLength())
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    while (!value.empty())
+    {
+        DataBuffer *segment = GetReadSegment();
+        std::size_t octets = std::min(value.size(), segment->GetUnreadLength());
+
+        segment->ReadValue(value.first(octets));
+        value = value.subspan(octets);
+    }
+}
+
+/*
+ *  DataBufferChain::ReadValue()
+ *
+ *  Description:
+ *      This function will read octets from the chain at the current read
+ *      position and place them in the span "value".
+ *
+ *  Parameters:
+ *      value [out]
+ *          The span into which octets will be copied out of the chain.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length, in which case nothing is read.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::ReadValue(std::span<char> value)
+{
+    ReadValue(std::span<std::uint8_t>(
+        reinterpret_cast<std::uint8_t *>(value.data()), value.size()));
+}
+
+/*
+ *  DataBufferChain::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the chain at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the chain at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::ReadValue(std::uint8_t &value)
+{
+    ReadNumeric(value);
+}
+
+/*
+ *  DataBufferChain::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the chain at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the chain at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::ReadValue(std::int8_t &value)
+{
+    ReadNumeric(value);
+}
+
+/*
+ *  DataBufferChain::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the chain at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the chain at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::ReadValue(std::uint16_t &value)
+{
+    ReadNumeric(value);
+}
+
+/*
+ *  DataBufferChain::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the chain at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the chain at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::ReadValue(std::int16_t &value)
+{
+    ReadNumeric(value);
+}
+
+/*
+ *  DataBufferChain::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the chain at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the chain at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::ReadValue(std::uint32_t &value)
+{
+    ReadNumeric(value);
+}
+
+/*
+ *  DataBufferChain::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the chain at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the chain at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::ReadValue(std::int32_t &value)
+{
+    ReadNumeric(value);
+}
+
+/*
+ *  DataBufferChain::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the chain at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the chain at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::ReadValue(std::uint64_t &value)
+{
+    ReadNumeric(value);
+}
+
+/*
+ *  DataBufferChain::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the chain at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the chain at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::ReadValue(std::int64_t &value)
+{
+    ReadNumeric(value);
+}
+
+/*
+ *  DataBufferChain::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the chain at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the chain at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::ReadValue(float &value)
+{
+    ReadNumeric(value);
+}
+
+/*
+ *  DataBufferChain::ReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the chain at the current read
+ *      position.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the chain at the current read position.
+ *
+ *  Returns:
+ *      Nothing, though the value parameter will be populated with the requested
+ *      data.  An exception will be thrown if there is a request to retrieve
+ *      data beyond the data length.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataBufferChain::ReadValue(double &value)
+{
+    ReadNumeric(value);
+}
+
+} // namespace Terra::NetUtil
@@ -0,0 +1,192 @@
+/*
+ *  data_cursor.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements the bounds checking and commit functions of the
+ *      DataWriter and DataReader objects.  The functions that write or read
+ *      values are defined inline in the header file.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <terra/netutil/data_cursor.h>
+
+namespace Terra::NetUtil
+{
+
+/*
+ *  DataWriter::DataWriter()
+ *
+ *  Description:
+ *      Constructor for the DataWriter object, which writes values following
+ *      the data in the given DataBuffer.
+ *
+ *  Parameters:
+ *      data_buffer [in]
+ *          The DataBuffer into which values will be written.
+ *
+ *      length [in]
+ *          The number of octets that will be written.  See Require().
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if there is insufficient space in
+ *      the DataBuffer.
+ *
+ *  Comments:
+ *      None.
+ */
+DataWriter::DataWriter(DataBuffer &data_buffer, std::size_t length) :
+    DataCursor(data_buffer)
+{
+    Require(length);
+}
+
+/*
+ *  DataWriter::Require()
+ *
+ *  Description:
+ *      Ensure there is space in the DataBuffer to write the given number of
+ *      octets beyond the current cursor position.  If the DataBuffer is
+ *      growable, it will be grown as necessary.
+ *
+ *  Parameters:
+ *      length [in]
+ *          The number of octets that will be written.
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if there is insufficient space in
+ *      the DataBuffer, in which case the required region is unchanged.
+ *
+ *  Comments:
+ *      Values written but not yet committed are preserved if the DataBuffer
+ *      is grown.
+ */
+void DataWriter::Require(std::size_t length)
+{
+    std::size_t written = GetLength();
+
+    // Grow the buffer if possible, then ensure there is sufficient space
+    data_buffer.EnsureAppendSpace(written + length);
+    if ((data_buffer.buffer_size - data_buffer.data_length - written) < length)
+    {
+        throw DataBufferException("Attempt to write beyond the buffer");
+    }
+
+    // The buffer may have moved, so establish the cursor position again
+    start = data_buffer.buffer + data_buffer.data_length;
+    cursor = start + written;
+    limit = cursor + length;
+}
+
+/*
+ *  DataWriter::Commit()
+ *
+ *  Description:
+ *      Advance the DataBuffer's data length to include the values written
+ *      since the last commit.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataWriter::Commit()
+{
+    data_buffer.data_length += GetLength();
+    start = cursor;
+}
+
+/*
+ *  DataReader::DataReader()
+ *
+ *  Description:
+ *      Constructor for the DataReader object, which reads values from the
+ *      given DataBuffer starting at its read position.
+ *
+ *  Parameters:
+ *      data_buffer [in]
+ *          The DataBuffer from which values will be read.
+ *
+ *      length [in]
+ *          The number of octets that will be read.  See Require().
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if there is insufficient unread data
+ *      in the DataBuffer.
+ *
+ *  Comments:
+ *      None.
+ */
+DataReader::DataReader(DataBuffer &data_buffer, std::size_t length) :
+    DataCursor(data_buffer)
+{
+    Require(length);
+}
+
+/*
+ *  DataReader::Require()
+ *
+ *  Description:
+ *      Ensure there is sufficient unread data in the DataBuffer to read the
+ *      given number of octets beyond the current cursor position.
+ *
+ *  Parameters:
+ *      length [in]
+ *          The number of octets that will be read.
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if there is insufficient unread data
+ *      in the DataBuffer, in which case the required region is unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataReader::Require(std::size_t length)
+{
+    std::size_t read = GetLength();
+
+    if ((data_buffer.GetUnreadLength() - read) < length)
+    {
+        throw DataBufferException("Attempt to read beyond the data length");
+    }
+
+    start = data_buffer.buffer + data_buffer.read_position;
+    cursor = start + read;
+    limit = cursor + length;
+}
+
+/*
+ *  DataReader::Commit()
+ *
+ *  Description:
+ *      Advance the DataBuffer's read position past the values read since the
+ *      last commit.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void DataReader::Commit()
+{
+    data_buffer.read_position += GetLength();
+    start = cursor;
+}
+
+} // namespace Terra::NetUtil
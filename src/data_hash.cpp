@@ -0,0 +1,634 @@
+/*
+ *  data_hash.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements functions to compute a CRC-32C and a fast 64-bit
+ *      hash over data.
+ *
+ *      The CRC-32C is computed using the reflected polynomial 0x82f63b78 with
+ *      the initial value and final result inverted, per RFC 3720.  The table
+ *      lookup fallback processes eight octets per iteration using eight
+ *      tables (i.e., "slicing-by-8"), where table k gives the CRC of an octet
+ *      followed by k octets of zero.
+ *
+ *      The 64-bit hash is XXH64 as specified by the xxHash project, which
+ *      processes data in 32-octet stripes using four independent
+ *      accumulators and is therefore readily computed incrementally.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <bit>
+#include <cstring>
+#include <terra/netutil/byte_order.h>
+#include <terra/netutil/data_hash.h>
+#include "cpu_features.h"
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+namespace Terra::NetUtil
+{
+
+namespace
+{
+
+// Reflected CRC-32C (Castagnoli) polynomial
+constexpr std::uint32_t Crc32c_Polynomial = 0x82f63b78;
+
+// Tables used to compute the CRC-32C eight octets at a time
+constexpr auto Crc32c_Tables = []()
+{
+    std::array<std::array<std::uint32_t, 256>, 8> tables{};
+
+    for (std::uint32_t i = 0; i < 256; i++)
+    {
+        std::uint32_t crc = i;
+
+        for (unsigned bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (((crc & 1) != 0) ? Crc32c_Polynomial : 0);
+        }
+
+        tables[0][i] = crc;
+    }
+
+    for (std::size_t k = 1; k < tables.size(); k++)
+    {
+        for (std::size_t i = 0; i < 256; i++)
+        {
+            tables[k][i] = (tables[k - 1][i] >> 8) ^
+                           tables[0][tables[k - 1][i] & 0xff];
+        }
+    }
+
+    return tables;
+}();
+
+// Primes used by XXH64
+constexpr std::uint64_t Prime64_1 = 0x9e3779b185ebca87;
+constexpr std::uint64_t Prime64_2 = 0xc2b2ae3d27d4eb4f;
+constexpr std::uint64_t Prime64_3 = 0x165667b19e3779f9;
+constexpr std::uint64_t Prime64_4 = 0x85ebca77c2b2ae63;
+constexpr std::uint64_t Prime64_5 = 0x27d4eb2f165667c5;
+
+/*
+ *  Crc32cTable()
+ *
+ *  Description:
+ *      Update the CRC-32C over the given data using table lookups.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data over which to compute the CRC.
+ *
+ *      length [in]
+ *          The length of the data.
+ *
+ *      crc [in]
+ *          The CRC register value (i.e., not inverted).
+ *
+ *  Returns:
+ *      The updated CRC register value.
+ *
+ *  Comments:
+ *      None.
+ */
+std::uint32_t Crc32cTable(const std::uint8_t *data,
+                          std::size_t length,
+                          std::uint32_t crc)
+{
+    const auto &t = Crc32c_Tables;
+
+    for (; length >= 8; data += 8, length -= 8)
+    {
+        crc ^= static_cast<std::uint32_t>(data[0]) |
+               (static_cast<std::uint32_t>(data[1]) << 8) |
+               (static_cast<std::uint32_t>(data[2]) << 16) |
+               (static_cast<std::uint32_t>(data[3]) << 24);
+
+        crc = t[7][crc & 0xff] ^ t[6][(crc >> 8) & 0xff] ^
+              t[5][(crc >> 16) & 0xff] ^ t[4][crc >> 24] ^
+              t[3][data[4]] ^ t[2][data[5]] ^ t[1][data[6]] ^ t[0][data[7]];
+    }
+
+    for (; length > 0; data++, length--)
+    {
+        crc = (crc >> 8) ^ t[0][(crc ^ *data) & 0xff];
+    }
+
+    return crc;
+}
+
+#ifdef NETUTIL_X86_SIMD
+
+/*
+ *  Crc32cSSE42()
+ *
+ *  Description:
+ *      Update the CRC-32C over the given data using the SSE4.2 crc32
+ *      instruction.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data over which to compute the CRC.
+ *
+ *      length [in]
+ *          The length of the data.
+ *
+ *      crc [in]
+ *          The CRC register value (i.e., not inverted).
+ *
+ *  Returns:
+ *      The updated CRC register value.
+ *
+ *  Comments:
+ *      None.
+ */
+__attribute__((target("sse4.2")))
+std::uint32_t Crc32cSSE42(const std::uint8_t *data,
+                          std::size_t length,
+                          std::uint32_t crc)
+{
+#ifdef __x86_64__
+    std::uint64_t crc64 = crc;
+
+    for (; length >= 8; data += 8, length -= 8)
+    {
+        std::uint64_t value{};
+
+        std::memcpy(&value, data, sizeof(value));
+        crc64 = _mm_crc32_u64(crc64, value);
+    }
+
+    crc = static_cast<std::uint32_t>(crc64);
+#endif
+
+    for (; length >= 4; data += 4, length -= 4)
+    {
+        std::uint32_t value{};
+
+        std::memcpy(&value, data, sizeof(value));
+        crc = _mm_crc32_u32(crc, value);
+    }
+
+    for (; length > 0; data++, length--) crc = _mm_crc32_u8(crc, *data);
+
+    return crc;
+}
+
+#endif // NETUTIL_X86_SIMD
+
+#if defined(__ARM_FEATURE_CRC32)
+
+/*
+ *  Crc32cARM()
+ *
+ *  Description:
+ *      Update the CRC-32C over the given data using the ARMv8 CRC
+ *      instructions.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data over which to compute the CRC.
+ *
+ *      length [in]
+ *          The length of the data.
+ *
+ *      crc [in]
+ *          The CRC register value (i.e., not inverted).
+ *
+ *  Returns:
+ *      The updated CRC register value.
+ *
+ *  Comments:
+ *      The instructions consume values in little endian byte order.
+ */
+std::uint32_t Crc32cARM(const std::uint8_t *data,
+                        std::size_t length,
+                        std::uint32_t crc)
+{
+    for (; length >= 8; data += 8, length -= 8)
+    {
+        std::uint64_t value{};
+
+        std::memcpy(&value, data, sizeof(value));
+        crc = __crc32cd(crc, ConvertByteOrder<ByteOrder::Little>(value));
+    }
+
+    for (; length > 0; data++, length--) crc = __crc32cb(crc, *data);
+
+    return crc;
+}
+
+#endif // __ARM_FEATURE_CRC32
+
+/*
+ *  ReadLittle64()
+ *
+ *  Description:
+ *      Read a 64-bit value stored in little endian byte order.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The location of the value.
+ *
+ *  Returns:
+ *      The value in host byte order.
+ *
+ *  Comments:
+ *      None.
+ */
+std::uint64_t ReadLittle64(const std::uint8_t *data)
+{
+    std::uint64_t value{};
+
+    std::memcpy(&value, data, sizeof(value));
+
+    return ConvertByteOrder<ByteOrder::Little>(value);
+}
+
+/*
+ *  ReadLittle32()
+ *
+ *  Description:
+ *      Read a 32-bit value stored in little endian byte order.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The location of the value.
+ *
+ *  Returns:
+ *      The value in host byte order.
+ *
+ *  Comments:
+ *      None.
+ */
+std::uint32_t ReadLittle32(const std::uint8_t *data)
+{
+    std::uint32_t value{};
+
+    std::memcpy(&value, data, sizeof(value));
+
+    return ConvertByteOrder<ByteOrder::Little>(value);
+}
+
+/*
+ *  Round()
+ *
+ *  Description:
+ *      Mix a 64-bit input value into an XXH64 accumulator.
+ *
+ *  Parameters:
+ *      accumulator [in]
+ *          The accumulator value.
+ *
+ *      input [in]
+ *          The input value.
+ *
+ *  Returns:
+ *      The updated accumulator value.
+ *
+ *  Comments:
+ *      None.
+ */
+constexpr std::uint64_t Round(std::uint64_t accumulator, std::uint64_t input)
+{
+    accumulator += input * Prime64_2;
+    accumulator = std::rotl(accumulator, 31);
+
+    return accumulator * Prime64_1;
+}
+
+/*
+ *  MergeRound()
+ *
+ *  Description:
+ *      Merge an XXH64 accumulator into the hash value.
+ *
+ *  Parameters:
+ *      hash [in]
+ *          The hash value.
+ *
+ *      accumulator [in]
+ *          The accumulator value to merge.
+ *
+ *  Returns:
+ *      The updated hash value.
+ *
+ *  Comments:
+ *      None.
+ */
+constexpr std::uint64_t MergeRound(std::uint64_t hash,
+                                   std::uint64_t accumulator)
+{
+    hash ^= Round(0, accumulator);
+
+    return (hash * Prime64_1) + Prime64_4;
+}
+
+/*
+ *  ProcessStripe()
+ *
+ *  Description:
+ *      Mix a 32-octet stripe of data into the XXH64 accumulators.
+ *
+ *  Parameters:
+ *      accumulators [in/out]
+ *          The accumulators to update.
+ *
+ *      data [in]
+ *          The 32 octets of data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void ProcessStripe(std::array<std::uint64_t, 4> &accumulators,
+                   const std::uint8_t *data)
+{
+    accumulators[0] = Round(accumulators[0], ReadLittle64(data));
+    accumulators[1] = Round(accumulators[1], ReadLittle64(data + 8));
+    accumulators[2] = Round(accumulators[2], ReadLittle64(data + 16));
+    accumulators[3] = Round(accumulators[3], ReadLittle64(data + 24));
+}
+
+} // namespace
+
+/*
+ *  Crc32c()
+ *
+ *  Description:
+ *      Compute the CRC-32C over the given data.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data over which to compute the CRC.
+ *
+ *      crc [in]
+ *          The CRC of any preceding data, or zero if there is none.
+ *
+ *  Returns:
+ *      The CRC-32C of the preceding data (if any) followed by the given data.
+ *
+ *  Comments:
+ *      None.
+ */
+std::uint32_t Crc32c(std::span<const std::uint8_t> data, std::uint32_t crc)
+{
+    crc = ~crc;
+
+#if defined(NETUTIL_X86_SIMD)
+    if (HasSSE42()) return ~Crc32cSSE42(data.data(), data.size(), crc);
+#elif defined(__ARM_FEATURE_CRC32)
+    return ~Crc32cARM(data.data(), data.size(), crc);
+#endif
+
+    return ~Crc32cTable(data.data(), data.size(), crc);
+}
+
+/*
+ *  ContentHash()
+ *
+ *  Description:
+ *      Compute a 64-bit hash (XXH64) over the given data.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data over which to compute the hash.
+ *
+ *      seed [in]
+ *          A seed value, which produces a different hash for the same data.
+ *
+ *  Returns:
+ *      The 64-bit hash value.
+ *
+ *  Comments:
+ *      None.
+ */
+std::uint64_t ContentHash(std::span<const std::uint8_t> data,
+                          std::uint64_t seed)
+{
+    ContentHasher hasher(seed);
+
+    hasher.Update(data);
+
+    return hasher.Digest();
+}
+
+/*
+ *  ContentHash()
+ *
+ *  Description:
+ *      Compute a 64-bit hash (XXH64) over the contents of the given
+ *      DataBuffer.
+ *
+ *  Parameters:
+ *      data_buffer [in]
+ *          The DataBuffer over which to compute the hash.  The octets from
+ *          the start of the buffer up to the data length are hashed.
+ *
+ *      seed [in]
+ *          A seed value, which produces a different hash for the same data.
+ *
+ *  Returns:
+ *      The 64-bit hash value.
+ *
+ *  Comments:
+ *      DataBuffer objects that are equal produce the same hash, since the
+ *      read position is not a factor in either.
+ */
+std::uint64_t ContentHash(const DataBuffer &data_buffer, std::uint64_t seed)
+{
+    ContentHasher hasher(seed);
+
+    if (data_buffer.GetDataLength() > 0)
+    {
+        hasher.Update({data_buffer.GetBufferPointer(),
+                       data_buffer.GetDataLength()});
+    }
+
+    return hasher.Digest();
+}
+
+/*
+ *  ContentHasher::ContentHasher()
+ *
+ *  Description:
+ *      Constructor for the ContentHasher object.
+ *
+ *  Parameters:
+ *      seed [in]
+ *          A seed value, which produces a different hash for the same data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+ContentHasher::ContentHasher(std::uint64_t seed)
+{
+    Reset(seed);
+}
+
+/*
+ *  ContentHasher::Reset()
+ *
+ *  Description:
+ *      Reset the object so that a new hash may be computed.
+ *
+ *  Parameters:
+ *      seed [in]
+ *          A seed value, which produces a different hash for the same data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void ContentHasher::Reset(std::uint64_t seed)
+{
+    this->seed = seed;
+    total_length = 0;
+    accumulators = {seed + Prime64_1 + Prime64_2,
+                    seed + Prime64_2,
+                    seed,
+                    seed - Prime64_1};
+    pending = {};
+    pending_length = 0;
+}
+
+/*
+ *  ContentHasher::Update()
+ *
+ *  Description:
+ *      Add the given data to the data being hashed.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data to add.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Data that does not fill a 32-octet stripe is retained until more data
+ *      is given or Digest() is called.
+ */
+void ContentHasher::Update(std::span<const std::uint8_t> data)
+{
+    const std::uint8_t *p = data.data();
+    std::size_t length = data.size();
+
+    total_length += length;
+
+    // If the data does not complete a stripe, just retain it
+    if ((pending_length + length) < pending.size())
+    {
+        if (length > 0) std::memcpy(pending.data() + pending_length, p, length);
+        pending_length += length;
+        return;
+    }
+
+    // Complete and process any partial stripe
+    if (pending_length > 0)
+    {
+        std::size_t fill = pending.size() - pending_length;
+
+        std::memcpy(pending.data() + pending_length, p, fill);
+        ProcessStripe(accumulators, pending.data());
+        p += fill;
+        length -= fill;
+        pending_length = 0;
+    }
+
+    for (; length >= 32; p += 32, length -= 32) ProcessStripe(accumulators, p);
+
+    // Retain any remaining octets
+    if (length > 0) std::memcpy(pending.data(), p, length);
+    pending_length = length;
+}
+
+/*
+ *  ContentHasher::Digest()
+ *
+ *  Description:
+ *      Return the hash of all of the data given to Update() since the object
+ *      was constructed or reset.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The 64-bit hash value.
+ *
+ *  Comments:
+ *      The object is not modified, so more data may be added afterward.
+ */
+std::uint64_t ContentHasher::Digest() const
+{
+    std::uint64_t hash{};
+    const std::uint8_t *p = pending.data();
+    std::size_t length = pending_length;
+
+    if (total_length >= 32)
+    {
+        hash = std::rotl(accumulators[0], 1) + std::rotl(accumulators[1], 7) +
+               std::rotl(accumulators[2], 12) + std::rotl(accumulators[3], 18);
+        for (std::uint64_t accumulator : accumulators)
+        {
+            hash = MergeRound(hash, accumulator);
+        }
+    }
+    else
+    {
+        hash = seed + Prime64_5;
+    }
+
+    hash += total_length;
+
+    // Mix in the remaining octets
+    for (; length >= 8; p += 8, length -= 8)
+    {
+        hash ^= Round(0, ReadLittle64(p));
+        hash = (std::rotl(hash, 27) * Prime64_1) + Prime64_4;
+    }
+
+    if (length >= 4)
+    {
+        hash ^= static_cast<std::uint64_t>(ReadLittle32(p)) * Prime64_1;
+        hash = (std::rotl(hash, 23) * Prime64_2) + Prime64_3;
+        p += 4;
+        length -= 4;
+    }
+
+    for (; length > 0; p++, length--)
+    {
+        hash ^= *p * Prime64_5;
+        hash = std::rotl(hash, 11) * Prime64_1;
+    }
+
+    // Final avalanche
+    hash ^= hash >> 33;
+    hash *= Prime64_2;
+    hash ^= hash >> 29;
+    hash *= Prime64_3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+} // namespace Terra::NetUtil
@@ -0,0 +1,619 @@
+/*
+ *  hex_dump.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements functions to render data as hexadecimal text and
+ *      to parse such text back into a DataBuffer.
+ *
+ *      Octets are rendered using lookup tables giving the two hex digits and
+ *      the ASCII form of each octet value, and hex digits are parsed using a
+ *      table giving the value of each character.  The vectorized parsing
+ *      functions convert each character to its value by range comparisons,
+ *      then combine pairs of values into octets.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstring>
+#include <terra/netutil/hex_dump.h>
+#include "cpu_features.h"
+
+namespace Terra::NetUtil
+{
+
+namespace
+{
+
+// Uppercase hex digits
+constexpr std::string_view Hex_Digits = "0123456789ABCDEF";
+
+// Lowercase hex digits
+constexpr std::string_view Lowercase_Hex_Digits = "0123456789abcdef";
+
+// Produce a table giving the two hex digits for each octet value
+constexpr auto MakeHexPairs(std::string_view digits)
+{
+    std::array<std::array<char, 2>, 256> pairs{};
+
+    for (std::size_t i = 0; i < pairs.size(); i++)
+    {
+        pairs[i] = {digits[i >> 4], digits[i & 0x0f]};
+    }
+
+    return pairs;
+}
+
+// Tables giving the two hex digits for each octet value
+constexpr auto Hex_Pairs = MakeHexPairs(Hex_Digits);
+constexpr auto Lowercase_Hex_Pairs = MakeHexPairs(Lowercase_Hex_Digits);
+
+// Table giving the character shown in a hex dump for each octet value
+constexpr auto Ascii_Map = []()
+{
+    std::array<char, 256> map{};
+
+    for (std::size_t i = 0; i < map.size(); i++)
+    {
+        map[i] = ((i >= 0x20) && (i < 0x7f)) ? static_cast<char>(i) : '.';
+    }
+
+    return map;
+}();
+
+// Table giving the value of each hex digit, or -1 for other characters
+constexpr auto Hex_Values = []()
+{
+    std::array<std::int8_t, 256> values{};
+
+    values.fill(-1);
+    for (std::size_t i = 0; i < 10; i++)
+    {
+        values['0' + i] = static_cast<std::int8_t>(i);
+    }
+    for (std::size_t i = 0; i < 6; i++)
+    {
+        values['A' + i] = static_cast<std::int8_t>(10 + i);
+        values['a' + i] = static_cast<std::int8_t>(10 + i);
+    }
+
+    return values;
+}();
+
+/*
+ *  OffsetDigits()
+ *
+ *  Description:
+ *      Determine the number of hex digits used to render an offset in a hex
+ *      dump.
+ *
+ *  Parameters:
+ *      offset [in]
+ *          The offset to render.
+ *
+ *  Returns:
+ *      The number of hex digits, which is at least eight.
+ *
+ *  Comments:
+ *      None.
+ */
+constexpr std::size_t OffsetDigits(std::size_t offset)
+{
+    std::size_t digits = 8;
+
+    while ((digits < (sizeof(offset) * 2)) && ((offset >> (digits * 4)) != 0))
+    {
+        digits++;
+    }
+
+    return digits;
+}
+
+/*
+ *  ParseOctet()
+ *
+ *  Description:
+ *      Parse two hex digits as an octet.
+ *
+ *  Parameters:
+ *      hex [in]
+ *          The two hex digits.
+ *
+ *      octet [out]
+ *          The parsed octet.
+ *
+ *  Returns:
+ *      True if both characters were hex digits, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+bool ParseOctet(const char *hex, std::uint8_t &octet)
+{
+    int high = Hex_Values[static_cast<unsigned char>(hex[0])];
+    int low = Hex_Values[static_cast<unsigned char>(hex[1])];
+
+    if ((high < 0) || (low < 0)) return false;
+
+    octet = static_cast<std::uint8_t>((high << 4) | low);
+
+    return true;
+}
+
+#ifdef NETUTIL_X86_SIMD
+
+/*
+ *  FromHexSSE2()
+ *
+ *  Description:
+ *      Parse hex digits as octets, 32 digits at a time, using SSE2
+ *      instructions.
+ *
+ *  Parameters:
+ *      hex [in]
+ *          The hex digits to parse.
+ *
+ *      octets [out]
+ *          The parsed octets.
+ *
+ *      count [in]
+ *          The number of octets to parse, which must be a multiple of 16.
+ *
+ *  Returns:
+ *      True if all characters were hex digits, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+__attribute__((target("sse2")))
+bool FromHexSSE2(const char *hex, std::uint8_t *octets, std::size_t count)
+{
+    const __m128i zero_digit = _mm_set1_epi8('0');
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i lower_case = _mm_set1_epi8(0x20);
+    const __m128i a_digit = _mm_set1_epi8('a');
+    const __m128i five = _mm_set1_epi8(5);
+    const __m128i ten = _mm_set1_epi8(10);
+    const __m128i low_byte = _mm_set1_epi16(0x00ff);
+
+    // Convert 16 characters to their values, noting any invalid characters
+    auto convert = [&](__m128i v, __m128i &valid)
+    {
+        __m128i digit = _mm_sub_epi8(v, zero_digit);
+        __m128i is_digit =
+            _mm_cmpeq_epi8(_mm_min_epu8(digit, nine), digit);
+        __m128i letter =
+            _mm_sub_epi8(_mm_or_si128(v, lower_case), a_digit);
+        __m128i is_letter =
+            _mm_cmpeq_epi8(_mm_min_epu8(letter, five), letter);
+
+        valid = _mm_and_si128(valid, _mm_or_si128(is_digit, is_letter));
+
+        return _mm_or_si128(
+            _mm_and_si128(digit, is_digit),
+            _mm_and_si128(_mm_add_epi8(letter, ten), is_letter));
+    };
+
+    // Combine each pair of values into an octet in a 16-bit lane
+    auto combine = [&](__m128i values)
+    {
+        return _mm_or_si128(
+            _mm_slli_epi16(_mm_and_si128(values, low_byte), 4),
+            _mm_srli_epi16(values, 8));
+    };
+
+    __m128i valid = _mm_set1_epi8(-1);
+
+    for (std::size_t i = 0; i < count; i += 16)
+    {
+        const auto *in = reinterpret_cast<const __m128i *>(hex + (i * 2));
+        __m128i v0 = convert(_mm_loadu_si128(in), valid);
+        __m128i v1 = convert(_mm_loadu_si128(in + 1), valid);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(octets + i),
+                         _mm_packus_epi16(combine(v0), combine(v1)));
+    }
+
+    return _mm_movemask_epi8(valid) == 0xffff;
+}
+
+#endif // NETUTIL_X86_SIMD
+
+#ifdef NETUTIL_ARM_SIMD
+
+/*
+ *  FromHexNEON()
+ *
+ *  Description:
+ *      Parse hex digits as octets, 32 digits at a time, using NEON
+ *      instructions.
+ *
+ *  Parameters:
+ *      hex [in]
+ *          The hex digits to parse.
+ *
+ *      octets [out]
+ *          The parsed octets.
+ *
+ *      count [in]
+ *          The number of octets to parse, which must be a multiple of 16.
+ *
+ *  Returns:
+ *      True if all characters were hex digits, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+bool FromHexNEON(const char *hex, std::uint8_t *octets, std::size_t count)
+{
+    const uint8x16_t zero_digit = vdupq_n_u8('0');
+    const uint8x16_t nine = vdupq_n_u8(9);
+    const uint8x16_t lower_case = vdupq_n_u8(0x20);
+    const uint8x16_t a_digit = vdupq_n_u8('a');
+    const uint8x16_t five = vdupq_n_u8(5);
+    const uint8x16_t ten = vdupq_n_u8(10);
+
+    // Convert 16 characters to their values, noting any invalid characters
+    auto convert = [&](uint8x16_t v, uint8x16_t &valid)
+    {
+        uint8x16_t digit = vsubq_u8(v, zero_digit);
+        uint8x16_t is_digit = vcleq_u8(digit, nine);
+        uint8x16_t letter = vsubq_u8(vorrq_u8(v, lower_case), a_digit);
+        uint8x16_t is_letter = vcleq_u8(letter, five);
+
+        valid = vandq_u8(valid, vorrq_u8(is_digit, is_letter));
+
+        return vbslq_u8(is_digit, digit, vaddq_u8(letter, ten));
+    };
+
+    uint8x16_t valid = vdupq_n_u8(0xff);
+
+    for (std::size_t i = 0; i < count; i += 16)
+    {
+        // Load 32 characters, separating the high and low digits
+        uint8x16x2_t digits =
+            vld2q_u8(reinterpret_cast<const std::uint8_t *>(hex + (i * 2)));
+        uint8x16_t high = convert(digits.val[0], valid);
+        uint8x16_t low = convert(digits.val[1], valid);
+
+        vst1q_u8(octets + i, vorrq_u8(vshlq_n_u8(high, 4), low));
+    }
+
+    return vminvq_u8(valid) == 0xff;
+}
+
+#endif // NETUTIL_ARM_SIMD
+
+} // namespace
+
+/*
+ *  HexDumpLine()
+ *
+ *  Description:
+ *      Render one line of a hex dump.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data to render on this line.  At most Hex_Dump_Octets_Per_Line
+ *          octets are rendered.
+ *
+ *      offset [in]
+ *          The offset of the data, which is rendered at the start of the
+ *          line.
+ *
+ *      line [out]
+ *          The buffer into which the line is written.  This must be at least
+ *          Hex_Dump_Max_Line_Length characters in length.
+ *
+ *  Returns:
+ *      The number of characters written, including the newline character.
+ *      An exception is thrown if the line buffer is too small.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t HexDumpLine(std::span<const std::uint8_t> data,
+                        std::size_t offset,
+                        std::span<char> line)
+{
+    const std::size_t digits = OffsetDigits(offset);
+    const std::size_t count = std::min(data.size(), Hex_Dump_Octets_Per_Line);
+    const std::size_t padding = Hex_Dump_Octets_Per_Line - count;
+    char *p = line.data();
+
+    if (line.size() < (digits + 1 + (Hex_Dump_Octets_Per_Line * 4) + 4))
+    {
+        throw DataBufferException("Hex dump line buffer is too small");
+    }
+
+    // Render the offset
+    for (std::size_t i = digits; i > 0; i--)
+    {
+        *p++ = Hex_Digits[(offset >> ((i - 1) * 4)) & 0x0f];
+    }
+    *p++ = ':';
+
+    // Render the octets in hex
+    for (std::size_t i = 0; i < count; i++)
+    {
+        *p++ = ' ';
+        *p++ = Hex_Pairs[data[i]][0];
+        *p++ = Hex_Pairs[data[i]][1];
+    }
+    std::memset(p, ' ', padding * 3);
+    p += padding * 3;
+
+    // Render the octets in ASCII
+    *p++ = ' ';
+    *p++ = ':';
+    for (std::size_t i = 0; i < count; i++) *p++ = Ascii_Map[data[i]];
+    std::memset(p, ' ', padding);
+    p += padding;
+    *p++ = ':';
+    *p++ = '\n';
+
+    return static_cast<std::size_t>(p - line.data());
+}
+
+/*
+ *  HexDumpLength()
+ *
+ *  Description:
+ *      Determine the number of characters in a hex dump of data of the given
+ *      length.
+ *
+ *  Parameters:
+ *      length [in]
+ *          The length of the data.
+ *
+ *  Returns:
+ *      The number of characters in the hex dump.
+ *
+ *  Comments:
+ *      Lines have the same length unless the offset requires more than eight
+ *      hex digits.
+ */
+std::size_t HexDumpLength(std::size_t length)
+{
+    const std::size_t lines = (length + Hex_Dump_Octets_Per_Line - 1) /
+                              Hex_Dump_Octets_Per_Line;
+    std::size_t total = lines * (8 + 1 + (Hex_Dump_Octets_Per_Line * 4) + 4);
+
+    // Add a character for each line whose offset exceeds each digit limit
+    for (std::size_t digits = 8; digits < (sizeof(length) * 2); digits++)
+    {
+        std::size_t first_line = (std::size_t(1) << (digits * 4)) /
+                                 Hex_Dump_Octets_Per_Line;
+
+        if (lines <= first_line) break;
+        total += lines - first_line;
+    }
+
+    return total;
+}
+
+/*
+ *  HexDump()
+ *
+ *  Description:
+ *      Write a hex dump of the given data into the given character buffer.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data to dump.
+ *
+ *      output [out]
+ *          The buffer into which the hex dump is written.  This must be at
+ *          least HexDumpLength() characters in length.
+ *
+ *  Returns:
+ *      The number of characters written.  An exception is thrown if the
+ *      output buffer is too small.
+ *
+ *  Comments:
+ *      The output is not terminated with a null character.
+ */
+std::size_t HexDump(std::span<const std::uint8_t> data, std::span<char> output)
+{
+    std::size_t written = 0;
+
+    if (output.size() < HexDumpLength(data.size()))
+    {
+        throw DataBufferException("Hex dump output buffer is too small");
+    }
+
+    for (std::size_t offset = 0;
+         offset < data.size();
+         offset += Hex_Dump_Octets_Per_Line)
+    {
+        written += HexDumpLine(
+            data.subspan(offset,
+                         std::min(Hex_Dump_Octets_Per_Line,
+                                  data.size() - offset)),
+            offset,
+            output.subspan(written));
+    }
+
+    return written;
+}
+
+/*
+ *  ToHex()
+ *
+ *  Description:
+ *      Render the given data as a string of hex digits.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data to render.
+ *
+ *      output [out]
+ *          The buffer into which the hex digits are written.  This must be at
+ *          least twice the length of the data.
+ *
+ *      uppercase [in]
+ *          True if uppercase hex digits are to be used, false for lowercase.
+ *
+ *  Returns:
+ *      The number of characters written.  An exception is thrown if the
+ *      output buffer is too small.
+ *
+ *  Comments:
+ *      The output is not terminated with a null character.
+ */
+std::size_t ToHex(std::span<const std::uint8_t> data,
+                  std::span<char> output,
+                  bool uppercase)
+{
+    const auto &pairs = uppercase ? Hex_Pairs : Lowercase_Hex_Pairs;
+    char *p = output.data();
+
+    if ((output.size() / 2) < data.size())
+    {
+        throw DataBufferException("Hex output buffer is too small");
+    }
+
+    for (std::uint8_t octet : data)
+    {
+        *p++ = pairs[octet][0];
+        *p++ = pairs[octet][1];
+    }
+
+    return data.size() * 2;
+}
+
+/*
+ *  FromHex()
+ *
+ *  Description:
+ *      Parse a string of hex digits, two per octet.
+ *
+ *  Parameters:
+ *      hex [in]
+ *          The hex digits to parse.
+ *
+ *  Returns:
+ *      A DataBuffer containing the parsed octets.  An exception is thrown if
+ *      the string has an odd length or contains characters other than hex
+ *      digits.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBuffer FromHex(std::string_view hex)
+{
+    const std::size_t count = hex.size() / 2;
+    DataBuffer data_buffer(count);
+    std::size_t parsed = 0;
+    bool valid = true;
+
+    if ((hex.size() % 2) != 0)
+    {
+        throw DataBufferException("Hex string has an odd length");
+    }
+
+    if (count == 0) return data_buffer;
+
+    std::uint8_t *octets = data_buffer.GetFreeSpan().data();
+
+    // Parse groups of 16 octets using vector instructions, if possible
+#if defined(NETUTIL_X86_SIMD)
+    if (HasSSE2())
+    {
+        parsed = count - (count % 16);
+        valid = FromHexSSE2(hex.data(), octets, parsed);
+    }
+#elif defined(NETUTIL_ARM_SIMD)
+    parsed = count - (count % 16);
+    valid = FromHexNEON(hex.data(), octets, parsed);
+#endif
+
+    for (; valid && (parsed < count); parsed++)
+    {
+        valid = ParseOctet(hex.data() + (parsed * 2), octets[parsed]);
+    }
+
+    if (!valid) throw DataBufferException("Invalid hex digit");
+
+    data_buffer.AdvanceDataLength(count);
+
+    return data_buffer;
+}
+
+/*
+ *  FromHexDump()
+ *
+ *  Description:
+ *      Parse a hex dump having the layout produced by HexDump().
+ *
+ *  Parameters:
+ *      hex_dump [in]
+ *          The hex dump to parse.
+ *
+ *  Returns:
+ *      A DataBuffer containing the parsed octets.  An exception is thrown if
+ *      a line does not have the expected layout.
+ *
+ *  Comments:
+ *      The offsets are not verified, so lines from separate hex dumps may be
+ *      concatenated.  Lines may be terminated by CR LF.
+ */
+DataBuffer FromHexDump(std::string_view hex_dump)
+{
+    // Each octet requires at least three characters
+    DataBuffer data_buffer(hex_dump.size() / 3);
+    std::uint8_t *octets = data_buffer.GetFreeSpan().data();
+    std::size_t count = 0;
+
+    while (!hex_dump.empty())
+    {
+        std::size_t line_end = hex_dump.find('\n');
+        std::string_view line = hex_dump.substr(0, line_end);
+
+        hex_dump.remove_prefix((line_end == std::string_view::npos) ?
+                                   hex_dump.size() :
+                                   line_end + 1);
+
+        if (!line.empty() && (line.back() == '\r')) line.remove_suffix(1);
+        if (line.empty()) continue;
+
+        // Skip over the offset
+        std::size_t position = line.find(':');
+        if (position == std::string_view::npos)
+        {
+            throw DataBufferException("Invalid hex dump line");
+        }
+        position++;
+
+        // Parse each space followed by two hex digits
+        for (std::size_t i = 0; i < Hex_Dump_Octets_Per_Line; i++)
+        {
+            if (((position + 3) > line.size()) || (line[position] != ' ') ||
+                (line[position + 1] == ' ') || (line[position + 1] == ':'))
+            {
+                break;
+            }
+
+            if (!ParseOctet(line.data() + position + 1, octets[count]))
+            {
+                throw DataBufferException("Invalid hex dump line");
+            }
+
+            count++;
+            position += 3;
+        }
+    }
+
+    data_buffer.AdvanceDataLength(count);
+
+    return data_buffer;
+}
+
+} // namespace Terra::NetUtil
@@ -0,0 +1,621 @@
+/*
+ *  internet_checksum.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements functions to compute the Internet checksum.
+ *
+ *      As explained in RFC 1071, the ones' complement sum is independent of
+ *      byte order, so the data is summed as a series of 32- or 64-bit values
+ *      in host byte order (accumulating the carries) and the resulting 16-bit
+ *      sum is converted to network byte order afterward.  The vector functions
+ *      widen each 32-bit value to 64 bits and accumulate the values in 64-bit
+ *      lanes, which cannot overflow for any practical length of data.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <array>
+#include <cstring>
+#include <terra/netutil/byte_order.h>
+#include <terra/netutil/internet_checksum.h>
+#include "cpu_features.h"
+
+namespace Terra::NetUtil
+{
+
+namespace
+{
+
+/*
+ *  Fold()
+ *
+ *  Description:
+ *      Fold a sum into 16 bits by adding the carries.
+ *
+ *  Parameters:
+ *      sum [in]
+ *          The sum to fold.
+ *
+ *  Returns:
+ *      The folded sum.
+ *
+ *  Comments:
+ *      None.
+ */
+constexpr std::uint16_t Fold(std::uint64_t sum)
+{
+    while ((sum >> 16) != 0) sum = (sum & 0xffff) + (sum >> 16);
+
+    return static_cast<std::uint16_t>(sum);
+}
+
+/*
+ *  SumScalar()
+ *
+ *  Description:
+ *      Sum the given data in host byte order, one value at a time.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data to sum.
+ *
+ *      length [in]
+ *          The length of the data.
+ *
+ *  Returns:
+ *      The sum, which is not yet folded into 16 bits.
+ *
+ *  Comments:
+ *      If the length is odd, the final octet is summed as though followed by
+ *      an octet of zero.
+ */
+std::uint64_t SumScalar(const std::uint8_t *data, std::size_t length)
+{
+    std::uint64_t sum = 0;
+    std::uint64_t carries = 0;
+
+    // Sum 64-bit values, counting the carries out of the sum
+    for (; length >= 8; data += 8, length -= 8)
+    {
+        std::uint64_t value{};
+
+        std::memcpy(&value, data, sizeof(value));
+        sum += value;
+        carries += (sum < value) ? 1 : 0;
+    }
+
+    // Since 2^64 is congruent to 1, each carry adds one to the sum
+    sum = (sum & 0xffffffff) + (sum >> 32) + carries;
+
+    for (; length >= 2; data += 2, length -= 2)
+    {
+        std::uint16_t value{};
+
+        std::memcpy(&value, data, sizeof(value));
+        sum += value;
+    }
+
+    if (length > 0)
+    {
+        std::array<std::uint8_t, 2> octets{data[0], 0};
+        std::uint16_t value{};
+
+        std::memcpy(&value, octets.data(), sizeof(value));
+        sum += value;
+    }
+
+    return sum;
+}
+
+#ifdef NETUTIL_X86_SIMD
+
+/*
+ *  SumAVX2()
+ *
+ *  Description:
+ *      Sum the given data in host byte order, 32 octets at a time, using AVX2
+ *      instructions.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data to sum.
+ *
+ *      length [in/out]
+ *          The length of the data.  On return, this is reduced by the number
+ *          of octets summed, which is a multiple of 32.
+ *
+ *  Returns:
+ *      The sum, which is not yet folded into 16 bits.
+ *
+ *  Comments:
+ *      None.
+ */
+__attribute__((target("avx2")))
+std::uint64_t SumAVX2(const std::uint8_t *data, std::size_t &length)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i *in = reinterpret_cast<const __m256i *>(data);
+    std::size_t vectors = length / 32;
+    __m256i sum0 = zero;
+    __m256i sum1 = zero;
+    __m256i sum2 = zero;
+    __m256i sum3 = zero;
+    std::size_t i = 0;
+
+    // Sum two vectors per iteration using independent accumulators
+    for (; (i + 2) <= vectors; i += 2)
+    {
+        __m256i v0 = _mm256_loadu_si256(in + i);
+        __m256i v1 = _mm256_loadu_si256(in + i + 1);
+
+        sum0 = _mm256_add_epi64(sum0, _mm256_unpacklo_epi32(v0, zero));
+        sum1 = _mm256_add_epi64(sum1, _mm256_unpackhi_epi32(v0, zero));
+        sum2 = _mm256_add_epi64(sum2, _mm256_unpacklo_epi32(v1, zero));
+        sum3 = _mm256_add_epi64(sum3, _mm256_unpackhi_epi32(v1, zero));
+    }
+
+    for (; i < vectors; i++)
+    {
+        __m256i v = _mm256_loadu_si256(in + i);
+
+        sum0 = _mm256_add_epi64(sum0, _mm256_unpacklo_epi32(v, zero));
+        sum1 = _mm256_add_epi64(sum1, _mm256_unpackhi_epi32(v, zero));
+    }
+
+    std::array<std::uint64_t, 16> lanes{};
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&lanes[0]), sum0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&lanes[4]), sum1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&lanes[8]), sum2);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&lanes[12]), sum3);
+
+    length -= vectors * 32;
+
+    std::uint64_t sum = 0;
+    for (std::uint64_t lane : lanes) sum += (lane & 0xffffffff) + (lane >> 32);
+
+    return sum;
+}
+
+/*
+ *  SumSSE2()
+ *
+ *  Description:
+ *      Sum the given data in host byte order, 16 octets at a time, using SSE2
+ *      instructions.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data to sum.
+ *
+ *      length [in/out]
+ *          The length of the data.  On return, this is reduced by the number
+ *          of octets summed, which is a multiple of 16.
+ *
+ *  Returns:
+ *      The sum, which is not yet folded into 16 bits.
+ *
+ *  Comments:
+ *      None.
+ */
+__attribute__((target("sse2")))
+std::uint64_t SumSSE2(const std::uint8_t *data, std::size_t &length)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i *in = reinterpret_cast<const __m128i *>(data);
+    std::size_t vectors = length / 16;
+    __m128i sum0 = zero;
+    __m128i sum1 = zero;
+    __m128i sum2 = zero;
+    __m128i sum3 = zero;
+    std::size_t i = 0;
+
+    // Sum two vectors per iteration using independent accumulators
+    for (; (i + 2) <= vectors; i += 2)
+    {
+        __m128i v0 = _mm_loadu_si128(in + i);
+        __m128i v1 = _mm_loadu_si128(in + i + 1);
+
+        sum0 = _mm_add_epi64(sum0, _mm_unpacklo_epi32(v0, zero));
+        sum1 = _mm_add_epi64(sum1, _mm_unpackhi_epi32(v0, zero));
+        sum2 = _mm_add_epi64(sum2, _mm_unpacklo_epi32(v1, zero));
+        sum3 = _mm_add_epi64(sum3, _mm_unpackhi_epi32(v1, zero));
+    }
+
+    for (; i < vectors; i++)
+    {
+        __m128i v = _mm_loadu_si128(in + i);
+
+        sum0 = _mm_add_epi64(sum0, _mm_unpacklo_epi32(v, zero));
+        sum1 = _mm_add_epi64(sum1, _mm_unpackhi_epi32(v, zero));
+    }
+
+    std::array<std::uint64_t, 8> lanes{};
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&lanes[0]), sum0);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&lanes[2]), sum1);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&lanes[4]), sum2);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&lanes[6]), sum3);
+
+    length -= vectors * 16;
+
+    std::uint64_t sum = 0;
+    for (std::uint64_t lane : lanes) sum += (lane & 0xffffffff) + (lane >> 32);
+
+    return sum;
+}
+
+#endif // NETUTIL_X86_SIMD
+
+#ifdef NETUTIL_ARM_SIMD
+
+/*
+ *  SumNEON()
+ *
+ *  Description:
+ *      Sum the given data in host byte order, 32 octets at a time, using NEON
+ *      instructions.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data to sum.
+ *
+ *      length [in/out]
+ *          The length of the data.  On return, this is reduced by the number
+ *          of octets summed, which is a multiple of 32.
+ *
+ *  Returns:
+ *      The sum, which is not yet folded into 16 bits.
+ *
+ *  Comments:
+ *      None.
+ */
+std::uint64_t SumNEON(const std::uint8_t *data, std::size_t &length)
+{
+    std::size_t vectors = length / 32;
+    uint64x2_t sum0 = vdupq_n_u64(0);
+    uint64x2_t sum1 = vdupq_n_u64(0);
+
+    // Pairwise add adjacent 32-bit values into the 64-bit accumulators
+    for (std::size_t i = 0; i < vectors; i++)
+    {
+        uint32x4_t v0 = vreinterpretq_u32_u8(vld1q_u8(data + (i * 32)));
+        uint32x4_t v1 = vreinterpretq_u32_u8(vld1q_u8(data + (i * 32) + 16));
+
+        sum0 = vpadalq_u32(sum0, v0);
+        sum1 = vpadalq_u32(sum1, v1);
+    }
+
+    std::array<std::uint64_t, 4> lanes{};
+    vst1q_u64(&lanes[0], sum0);
+    vst1q_u64(&lanes[2], sum1);
+
+    length -= vectors * 32;
+
+    std::uint64_t sum = 0;
+    for (std::uint64_t lane : lanes) sum += (lane & 0xffffffff) + (lane >> 32);
+
+    return sum;
+}
+
+#endif // NETUTIL_ARM_SIMD
+
+/*
+ *  Sum()
+ *
+ *  Description:
+ *      Compute the ones' complement sum of the given data using the fastest
+ *      means available.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data to sum.
+ *
+ *  Returns:
+ *      The ones' complement sum in network byte order (i.e., as though each
+ *      pair of octets were read as a 16-bit value in network byte order).
+ *
+ *  Comments:
+ *      None.
+ */
+std::uint16_t Sum(std::span<const std::uint8_t> data)
+{
+    const std::uint8_t *octets = data.data();
+    std::size_t length = data.size();
+    std::uint64_t sum = 0;
+
+#if defined(NETUTIL_X86_SIMD)
+    if (HasAVX2())
+    {
+        sum = SumAVX2(octets, length);
+    }
+    else if (HasSSE2())
+    {
+        sum = SumSSE2(octets, length);
+    }
+#elif defined(NETUTIL_ARM_SIMD)
+    sum = SumNEON(octets, length);
+#endif
+
+    // Sum the remaining octets individually
+    sum += SumScalar(octets + (data.size() - length), length);
+
+    return ConvertByteOrder<ByteOrder::Network>(Fold(sum));
+}
+
+} // namespace
+
+/*
+ *  OnesComplementSum()
+ *
+ *  Description:
+ *      Compute the ones' complement sum of the given data, which is the
+ *      Internet checksum before taking its complement.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data to sum.  If the length is odd, the final octet is summed
+ *          as though followed by an octet of zero.
+ *
+ *      sum [in]
+ *          A sum to which the sum of the data is added, such as that returned
+ *          by a previous call to this function for preceding data.
+ *
+ *  Returns:
+ *      The ones' complement sum in host byte order.
+ *
+ *  Comments:
+ *      When summing data that is not contiguous, each piece of data other
+ *      than the last must have an even length.
+ */
+std::uint16_t OnesComplementSum(std::span<const std::uint8_t> data,
+                                std::uint16_t sum)
+{
+    return Fold(static_cast<std::uint32_t>(sum) + Sum(data));
+}
+
+/*
+ *  InternetChecksum()
+ *
+ *  Description:
+ *      Compute the Internet checksum of the given data.
+ *
+ *  Parameters:
+ *      data [in]
+ *          The data over which to compute the checksum.
+ *
+ *  Returns:
+ *      The Internet checksum in host byte order.
+ *
+ *  Comments:
+ *      None.
+ */
+std::uint16_t InternetChecksum(std::span<const std::uint8_t> data)
+{
+    return static_cast<std::uint16_t>(~OnesComplementSum(data));
+}
+
+/*
+ *  InternetChecksum()
+ *
+ *  Description:
+ *      Compute the Internet checksum of a range of octets within the given
+ *      DataBuffer.
+ *
+ *  Parameters:
+ *      data_buffer [in]
+ *          The DataBuffer containing the data.
+ *
+ *      offset [in]
+ *          The offset of the data within the buffer.
+ *
+ *      length [in]
+ *          The length of the data.
+ *
+ *  Returns:
+ *      The Internet checksum in host byte order.  An exception is thrown if
+ *      the range extends beyond the buffer.
+ *
+ *  Comments:
+ *      The data length and read position are not considered.
+ */
+std::uint16_t InternetChecksum(const DataBuffer &data_buffer,
+                               std::size_t offset,
+                               std::size_t length)
+{
+    const std::size_t buffer_size = data_buffer.GetBufferSize();
+
+    if ((offset > buffer_size) || (length > (buffer_size - offset)))
+    {
+        throw DataBufferException("Attempt to read beyond the buffer");
+    }
+
+    if (length == 0) return InternetChecksum({});
+
+    return InternetChecksum({data_buffer.GetBufferPointer(offset), length});
+}
+
+/*
+ *  InternetChecksum()
+ *
+ *  Description:
+ *      Compute the Internet checksum of a range of octets within the given
+ *      DataBuffer, including the IPv4 (RFC 791) or IPv6 (RFC 8200)
+ *      pseudo-header used by protocols such as UDP and TCP.
+ *
+ *  Parameters:
+ *      data_buffer [in]
+ *          The DataBuffer containing the data (e.g., the UDP header and
+ *          payload).
+ *
+ *      offset [in]
+ *          The offset of the data within the buffer.
+ *
+ *      length [in]
+ *          The length of the data, which is also the length given in the
+ *          pseudo-header.
+ *
+ *      source [in]
+ *          The source address.
+ *
+ *      destination [in]
+ *          The destination address.  This must be of the same type as the
+ *          source address.
+ *
+ *      protocol [in]
+ *          The protocol number (e.g., 17 for UDP or 6 for TCP).
+ *
+ *  Returns:
+ *      The Internet checksum in host byte order.  An exception is thrown if
+ *      the range extends beyond the buffer or if the addresses are not both
+ *      IPv4 or both IPv6 addresses.
+ *
+ *  Comments:
+ *      The ports of the addresses are not considered.
+ */
+std::uint16_t InternetChecksum(const DataBuffer &data_buffer,
+                               std::size_t offset,
+                               std::size_t length,
+                               const NetworkAddress &source,
+                               const NetworkAddress &destination,
+                               std::uint8_t protocol)
+{
+    std::array<std::uint8_t, 40> pseudo_header{};
+    DataBuffer header(pseudo_header.data(), pseudo_header.size());
+    const std::size_t buffer_size = data_buffer.GetBufferSize();
+
+    if ((offset > buffer_size) || (length > (buffer_size - offset)))
+    {
+        throw DataBufferException("Attempt to read beyond the buffer");
+    }
+
+    if (source.GetAddressType() != destination.GetAddressType())
+    {
+        throw DataBufferException("Pseudo-header address types differ");
+    }
+
+    switch (source.GetAddressType())
+    {
+        case NetworkAddressType::IPv4:
+            for (const NetworkAddress *address : {&source, &destination})
+            {
+                const auto *storage = reinterpret_cast<const sockaddr_in *>(
+                    address->GetAddressStorage());
+                header.AppendValue(std::span<const std::uint8_t>(
+                    reinterpret_cast<const std::uint8_t *>(&storage->sin_addr),
+                    4));
+            }
+            header << std::uint8_t(0) << protocol
+                   << static_cast<std::uint16_t>(length);
+            break;
+
+        case NetworkAddressType::IPv6:
+            for (const NetworkAddress *address : {&source, &destination})
+            {
+                const auto *storage = reinterpret_cast<const sockaddr_in6 *>(
+                    address->GetAddressStorage());
+                header.AppendValue(std::span<const std::uint8_t>(
+                    reinterpret_cast<const std::uint8_t *>(
+                        &storage->sin6_addr),
+                    16));
+            }
+            header << static_cast<std::uint32_t>(length) << std::uint16_t(0)
+                   << std::uint8_t(0) << protocol;
+            break;
+
+        default:
+            throw DataBufferException("Pseudo-header address type unknown");
+    }
+
+    std::uint16_t sum = OnesComplementSum(header.GetBufferSpan());
+
+    if (length > 0)
+    {
+        sum = OnesComplementSum({data_buffer.GetBufferPointer(offset), length},
+                                sum);
+    }
+
+    return static_cast<std::uint16_t>(~sum);
+}
+
+/*
+ *  UpdateChecksum()
+ *
+ *  Description:
+ *      Update an Internet checksum to reflect a change to a 16-bit value
+ *      covered by the checksum, per equation 3 of RFC 1624.
+ *
+ *  Parameters:
+ *      checksum [in]
+ *          The existing checksum in host byte order.
+ *
+ *      old_value [in]
+ *          The value before the change in host byte order.
+ *
+ *      new_value [in]
+ *          The value after the change in host byte order.
+ *
+ *  Returns:
+ *      The updated checksum in host byte order.
+ *
+ *  Comments:
+ *      The value must begin at an even offset from the start of the data
+ *      covered by the checksum.
+ */
+std::uint16_t UpdateChecksum(std::uint16_t checksum,
+                             std::uint16_t old_value,
+                             std::uint16_t new_value)
+{
+    std::uint32_t sum = static_cast<std::uint16_t>(~checksum);
+
+    sum += static_cast<std::uint16_t>(~old_value);
+    sum += new_value;
+
+    return static_cast<std::uint16_t>(~Fold(sum));
+}
+
+/*
+ *  UpdateChecksum()
+ *
+ *  Description:
+ *      Update an Internet checksum to reflect a change to a 32-bit value
+ *      covered by the checksum, such as an IPv4 address.
+ *
+ *  Parameters:
+ *      checksum [in]
+ *          The existing checksum in host byte order.
+ *
+ *      old_value [in]
+ *          The value before the change in host byte order.
+ *
+ *      new_value [in]
+ *          The value after the change in host byte order.
+ *
+ *  Returns:
+ *      The updated checksum in host byte order.
+ *
+ *  Comments:
+ *      The value must begin at an even offset from the start of the data
+ *      covered by the checksum.
+ */
+std::uint16_t UpdateChecksum(std::uint16_t checksum,
+                             std::uint32_t old_value,
+                             std::uint32_t new_value)
+{
+    std::uint32_t sum = static_cast<std::uint16_t>(~checksum);
+
+    sum += static_cast<std::uint16_t>(~(old_value >> 16));
+    sum += static_cast<std::uint16_t>(~(old_value & 0xffff));
+    sum += new_value >> 16;
+    sum += new_value & 0xffff;
+
+    return static_cast<std::uint16_t>(~Fold(sum));
+}
+
+} // namespace Terra::NetUtil
@@ -0,0 +1,367 @@
+/*
+ *  mapped_data_buffer.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements the MappedDataBuffer object.
+ *
+ *      The underlying DataBuffer does not own the mapped memory, so it is
+ *      never reallocated or freed by the DataBuffer.  In Read mode, the file
+ *      is mapped privately with write access so that setting values in the
+ *      buffer does not fault, but such changes are never written to the file.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#ifndef _WIN32
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <terra/netutil/mapped_data_buffer.h>
+
+namespace Terra::NetUtil
+{
+
+namespace
+{
+
+/*
+ *  PageSize()
+ *
+ *  Description:
+ *      Get the system page size.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The system page size.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t PageSize()
+{
+    return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+} // namespace
+
+/*
+ *  MappedDataBuffer::MappedDataBuffer()
+ *
+ *  Description:
+ *      Constructor for the MappedDataBuffer object, which opens the given
+ *      file and maps it into memory.
+ *
+ *  Parameters:
+ *      path [in]
+ *          The path of the file to open.
+ *
+ *      mode [in]
+ *          The mode in which to open the file.  In ReadWrite mode, the file
+ *          is created if it does not exist.
+ *
+ *      capacity [in]
+ *          The minimum buffer size when opening the file in ReadWrite mode.
+ *          If the file is smaller, it is extended to this size while open.
+ *          This is ignored in Read mode.
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if the file cannot be opened or
+ *      mapped.
+ *
+ *  Comments:
+ *      The data length is initially the size of the file and the read
+ *      position is zero.
+ */
+MappedDataBuffer::MappedDataBuffer(const std::filesystem::path &path,
+                                   MappedFileMode mode,
+                                   std::size_t capacity) :
+    DataBuffer(),
+    mode{mode},
+    fd{-1},
+    mapping{nullptr},
+    mapping_size{0}
+{
+    struct stat file_status{};
+
+    if (mode == MappedFileMode::Read)
+    {
+        fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+    else
+    {
+        fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    }
+    if (fd < 0) throw DataBufferException("Unable to open the file");
+
+    if (fstat(fd, &file_status) != 0)
+    {
+        close(fd);
+        fd = -1;
+        throw DataBufferException("Unable to determine the file size");
+    }
+
+    const auto file_size = static_cast<std::size_t>(file_status.st_size);
+
+    mapping_size = file_size;
+
+    // Extend the file to the requested capacity
+    if ((mode == MappedFileMode::ReadWrite) && (capacity > file_size))
+    {
+        if (ftruncate(fd, static_cast<off_t>(capacity)) != 0)
+        {
+            close(fd);
+            fd = -1;
+            throw DataBufferException("Unable to extend the file");
+        }
+        mapping_size = capacity;
+    }
+
+    // Nothing can be mapped if the buffer is empty
+    if (mapping_size == 0) return;
+
+    void *address = mmap(nullptr,
+                         mapping_size,
+                         PROT_READ | PROT_WRITE,
+                         (mode == MappedFileMode::Read) ? MAP_PRIVATE :
+                                                          MAP_SHARED,
+                         fd,
+                         0);
+    if (address == MAP_FAILED)
+    {
+        if (mapping_size != file_size)
+        {
+            [[maybe_unused]] int result =
+                ftruncate(fd, static_cast<off_t>(file_size));
+        }
+        close(fd);
+        fd = -1;
+        throw DataBufferException("Unable to map the file");
+    }
+    mapping = static_cast<std::uint8_t *>(address);
+
+    SetBuffer(mapping, mapping_size, file_size);
+}
+
+/*
+ *  MappedDataBuffer::~MappedDataBuffer()
+ *
+ *  Description:
+ *      Destructor for the MappedDataBuffer object.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      The file is closed if it is open.  Errors are ignored; call Close()
+ *      explicitly to be informed of errors.
+ */
+MappedDataBuffer::~MappedDataBuffer()
+{
+    try
+    {
+        Close();
+    }
+    catch (...)
+    {
+        // Nothing can be done about errors in the destructor
+    }
+}
+
+/*
+ *  MappedDataBuffer::Advise()
+ *
+ *  Description:
+ *      Advise the operating system about how a region of the buffer will be
+ *      accessed.
+ *
+ *  Parameters:
+ *      advice [in]
+ *          The advice to give to the operating system.
+ *
+ *      offset [in]
+ *          The offset of the region to which the advice applies.  This is
+ *          rounded down to a multiple of the system page size.
+ *
+ *      length [in]
+ *          The length of the region to which the advice applies.  If zero,
+ *          the region extends to the end of the buffer.
+ *
+ *  Returns:
+ *      True if the advice was accepted, false otherwise.
+ *
+ *  Comments:
+ *      Advice is only a hint, so failure need not be treated as an error.
+ *      Multiple pieces of advice may be given for the same region (e.g.,
+ *      Sequential and WillNeed).
+ */
+bool MappedDataBuffer::Advise(MappedFileAdvice advice,
+                              std::size_t offset,
+                              std::size_t length)
+{
+    int flag{};
+
+    switch (advice)
+    {
+        case MappedFileAdvice::Normal:
+            flag = MADV_NORMAL;
+            break;
+
+        case MappedFileAdvice::Sequential:
+            flag = MADV_SEQUENTIAL;
+            break;
+
+        case MappedFileAdvice::Random:
+            flag = MADV_RANDOM;
+            break;
+
+        case MappedFileAdvice::WillNeed:
+            flag = MADV_WILLNEED;
+            break;
+
+        case MappedFileAdvice::HugePage:
+#ifdef MADV_HUGEPAGE
+            flag = MADV_HUGEPAGE;
+            break;
+#else
+            return false;
+#endif
+
+        default:
+            return false;
+    }
+
+    if ((mapping == nullptr) || (offset >= mapping_size)) return false;
+
+    // Limit the region to the mapped memory
+    if ((length == 0) || (length > (mapping_size - offset)))
+    {
+        length = mapping_size - offset;
+    }
+
+    // The region must start on a page boundary
+    const std::size_t start = (offset / PageSize()) * PageSize();
+    length += offset - start;
+
+    return madvise(mapping + start, length, flag) == 0;
+}
+
+/*
+ *  MappedDataBuffer::Release()
+ *
+ *  Description:
+ *      Release the pages of the file preceding the read position from the
+ *      process's resident memory.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      The released pages remain accessible and are read from the file again
+ *      if accessed.  In ReadWrite mode, changes made to the released pages are
+ *      retained.  In Read mode, changes made to the released pages are lost.
+ */
+void MappedDataBuffer::Release()
+{
+    const std::size_t length = (read_position / PageSize()) * PageSize();
+
+    if ((mapping == nullptr) || (length == 0)) return;
+
+    madvise(mapping, length, MADV_DONTNEED);
+}
+
+/*
+ *  MappedDataBuffer::Sync()
+ *
+ *  Description:
+ *      Write changes made to the buffer up to the data length to the file.
+ *
+ *  Parameters:
+ *      asynchronous [in]
+ *          If true, the writes are scheduled and this function returns
+ *          immediately.  Otherwise, this function returns once the writes
+ *          have completed.
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if the changes cannot be written.
+ *
+ *  Comments:
+ *      This does nothing in Read mode.  The file is not truncated to the data
+ *      length until the MappedDataBuffer is closed.
+ */
+void MappedDataBuffer::Sync(bool asynchronous)
+{
+    if ((mode == MappedFileMode::Read) || (mapping == nullptr)) return;
+    if (data_length == 0) return;
+
+    if (msync(mapping, data_length, asynchronous ? MS_ASYNC : MS_SYNC) != 0)
+    {
+        throw DataBufferException("Unable to write changes to the file");
+    }
+}
+
+/*
+ *  MappedDataBuffer::Close()
+ *
+ *  Description:
+ *      Unmap and close the file.  In ReadWrite mode, the file is truncated to
+ *      the data length.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if the file cannot be truncated, though
+ *      the file is closed regardless.
+ *
+ *  Comments:
+ *      Once closed, the buffer is empty.
+ */
+void MappedDataBuffer::Close()
+{
+    if (fd < 0) return;
+
+    const std::size_t length = data_length;
+    bool truncated = true;
+
+    // Release the buffer before unmapping the memory
+    SetBuffer(nullptr, 0, 0);
+
+    if (mapping != nullptr) munmap(mapping, mapping_size);
+    mapping = nullptr;
+    mapping_size = 0;
+
+    if (mode == MappedFileMode::ReadWrite)
+    {
+        truncated = ftruncate(fd, static_cast<off_t>(length)) == 0;
+    }
+
+    close(fd);
+    fd = -1;
+
+    if (!truncated)
+    {
+        throw DataBufferException("Unable to set the length of the file");
+    }
+}
+
+} // namespace Terra::NetUtil
+
+#endif // _WIN32
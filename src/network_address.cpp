@@ -21,6 +21,7 @@
 
 #include <cstring>
 #include <array>
+#include <charconv>
 #include <regex>
 #include <utility>
 #ifndef _WIN32
@@ -477,43 +478,105 @@ bool NetworkAddress::AssignAddress(const struct sockaddr_storage *address,
  *      None.
  */
 std::string NetworkAddress::GetAddress() const
+{
+    std::array<char, Network_Address_Max_Length> string_storage{};
+
+    return {string_storage.data(), GetAddress(string_storage)};
+}
+
+/*
+ *  NetworkAddress::GetAddress()
+ *
+ *  Description:
+ *      Writes the assigned address in text form into the given buffer,
+ *      rendered in the given style.  Nothing is written if the address is
+ *      unassigned or contains an unknown address type, or if the conversion
+ *      of the address to text fails for any reason.
+ *
+ *  Parameters:
+ *      buffer [out]
+ *          The buffer into which the text is written.  This should be at
+ *          least Network_Address_Max_Length characters in length.
+ *
+ *      style [in]
+ *          The style in which to render the address.  The "Bracketed",
+ *          "Default", and "AddressPort" styles enclose IPv6 addresses in
+ *          brackets.  The "Default" style appends a colon and port number if
+ *          the port is non-zero, while "AddressPort" always does.
+ *
+ *  Returns:
+ *      The number of characters written, which is zero if there was an
+ *      error or if the buffer is too small.  The text is not terminated with
+ *      a null character.
+ *
+ *  Comments:
+ *      This function does not allocate memory.
+ */
+std::size_t NetworkAddress::GetAddress(std::span<char> buffer,
+                                       NetworkAddressStyle style) const
 {
     std::array<char, INET6_ADDRSTRLEN> string_storage{};
-    bool result = false;
+    const void *address = nullptr;
+    bool brackets = false;
+    std::size_t length = 0;
 
-    // Convert from binary to string form depending on the address type
+    // Locate the binary address depending on the address type
     switch (address_storage.ss.ss_family)
     {
         case AF_INET:
-            if (inet_ntop(AF_INET,
-                          &address_storage.sa4.sin_addr,
-                          string_storage.data(),
-                          string_storage.size()) != nullptr)
-            {
-                result = true;
-            }
+            address = &address_storage.sa4.sin_addr;
             break;
 
         case AF_INET6:
-            if (inet_ntop(AF_INET6,
-                          &address_storage.sa6.sin6_addr,
-                          string_storage.data(),
-                          string_storage.size()) != nullptr)
-            {
-                result = true;
-            }
+            address = &address_storage.sa6.sin6_addr;
+            brackets = (style != NetworkAddressStyle::Address);
             break;
 
         default:
             // Unknown or unspecified address type
-            result = false;
-            break;
+            return 0;
+    }
+
+    // Convert from binary to string form
+    if (inet_ntop(address_storage.ss.ss_family,
+                  address,
+                  string_storage.data(),
+                  string_storage.size()) == nullptr)
+    {
+        return 0;
+    }
+
+    std::size_t address_length = std::strlen(string_storage.data());
+    std::uint16_t port = GetPort();
+    std::array<char, 6> port_storage{':'};
+    std::size_t port_length = 0;
+
+    // Render the port, if it is to be included
+    if ((style == NetworkAddressStyle::AddressPort) ||
+        ((style == NetworkAddressStyle::Default) && (port > 0)))
+    {
+        port_length = static_cast<std::size_t>(
+            std::to_chars(port_storage.data() + 1,
+                          port_storage.data() + port_storage.size(),
+                          port).ptr -
+            port_storage.data());
     }
 
-    // If unable to produce a string, return an empty one
-    if (!result) return {};
+    // Ensure the text will fit in the buffer
+    if (buffer.size() <
+        (address_length + (brackets ? 2 : 0) + port_length))
+    {
+        return 0;
+    }
 
-    return {string_storage.data()};
+    if (brackets) buffer[length++] = '[';
+    std::memcpy(buffer.data() + length, string_storage.data(), address_length);
+    length += address_length;
+    if (brackets) buffer[length++] = ']';
+    std::memcpy(buffer.data() + length, port_storage.data(), port_length);
+    length += port_length;
+
+    return length;
 }
 
 /*
@@ -1114,20 +1177,15 @@ bool NetworkAddress::operator>(const NetworkAddress &other) const
  */
 std::ostream &operator<<(std::ostream &o, const NetworkAddress &address)
 {
+    std::array<char, Network_Address_Max_Length> string_storage{};
+
     // Only print something if the address is assigned
     if (address)
     {
-        bool ipv6 = (address.GetAddressType() == NetworkAddressType::IPv6);
-
-        if (ipv6) o << "[";
-
-        o << address.GetAddress();
-
-        if (ipv6) o << "]";
-
-        auto port = address.GetPort();
-
-        if (port > 0) o << ":" << port;
+        o.write(string_storage.data(),
+                static_cast<std::streamsize>(address.GetAddress(
+                    string_storage,
+                    NetworkAddressStyle::Default)));
     }
 
     return o;
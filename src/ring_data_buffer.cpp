@@ -0,0 +1,385 @@
+/*
+ *  ring_data_buffer.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements the RingDataBuffer object.
+ *
+ *      The underlying DataBuffer operates over a window of the doubly-mapped
+ *      memory beginning at the start of the first mapping.  The read position
+ *      is kept within the first mapping, while the data length may extend
+ *      into the second mapping.  The DataBuffer's buffer size is maintained
+ *      as the read position plus the ring size, so the DataBuffer functions
+ *      that append values cannot overwrite unread data.  Once the read
+ *      position moves into the second mapping, Reclaim() moves both the read
+ *      position and data length back by the ring size, which refers to the
+ *      same memory.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#ifndef _WIN32
+
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <terra/netutil/ring_data_buffer.h>
+
+namespace Terra::NetUtil
+{
+
+namespace
+{
+
+/*
+ *  CreateMemoryObject()
+ *
+ *  Description:
+ *      Create an anonymous shared memory object of the given size.
+ *
+ *  Parameters:
+ *      size [in]
+ *          The size of the memory object.
+ *
+ *  Returns:
+ *      A file descriptor referring to the memory object or -1 on failure.
+ *
+ *  Comments:
+ *      None.
+ */
+int CreateMemoryObject(std::size_t size)
+{
+#ifdef __linux__
+    int fd = memfd_create("netutil_ring", MFD_CLOEXEC);
+#else
+    // Create a uniquely named object and remove the name immediately
+    char name[64];
+    std::snprintf(name,
+                  sizeof(name),
+                  "/netutil_ring_%ld_%p",
+                  static_cast<long>(getpid()),
+                  static_cast<void *>(&name));
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) shm_unlink(name);
+#endif
+
+    if (fd < 0) return -1;
+
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+} // namespace
+
+/*
+ *  RingDataBuffer::RingDataBuffer()
+ *
+ *  Description:
+ *      Constructor for the RingDataBuffer object.
+ *
+ *  Parameters:
+ *      buffer_size [in]
+ *          The size of the ring buffer.  This will be rounded up to a
+ *          multiple of the system page size.
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if the memory cannot be allocated
+ *      and mapped.
+ *
+ *  Comments:
+ *      None.
+ */
+RingDataBuffer::RingDataBuffer(std::size_t buffer_size) :
+    DataBuffer(),
+    ring{nullptr},
+    ring_size{0}
+{
+    const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+    // Round the size up to a multiple of the page size
+    if (buffer_size == 0) buffer_size = 1;
+    ring_size = ((buffer_size + page_size - 1) / page_size) * page_size;
+
+    int fd = CreateMemoryObject(ring_size);
+    if (fd < 0)
+    {
+        throw DataBufferException("Unable to create the ring buffer memory");
+    }
+
+    // Reserve address space for both mappings
+    void *address = mmap(nullptr,
+                         ring_size * 2,
+                         PROT_NONE,
+                         MAP_PRIVATE | MAP_ANONYMOUS,
+                         -1,
+                         0);
+    if (address == MAP_FAILED)
+    {
+        close(fd);
+        throw DataBufferException("Unable to map the ring buffer memory");
+    }
+    ring = static_cast<std::uint8_t *>(address);
+
+    // Map the memory object twice into the reserved space
+    for (std::size_t i = 0; i < 2; i++)
+    {
+        address = mmap(ring + (i * ring_size),
+                       ring_size,
+                       PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_FIXED,
+                       fd,
+                       0);
+        if (address == MAP_FAILED)
+        {
+            munmap(ring, ring_size * 2);
+            close(fd);
+            throw DataBufferException("Unable to map the ring buffer memory");
+        }
+    }
+
+    // The mappings remain valid after the descriptor is closed
+    close(fd);
+
+    // Operate over the first mapping
+    SetBuffer(ring, ring_size, 0);
+}
+
+/*
+ *  RingDataBuffer::~RingDataBuffer()
+ *
+ *  Description:
+ *      Destructor for the RingDataBuffer object.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+RingDataBuffer::~RingDataBuffer()
+{
+    // Release the buffer before unmapping the memory
+    SetBuffer(nullptr, 0, 0);
+
+    munmap(ring, ring_size * 2);
+}
+
+/*
+ *  RingDataBuffer::GetDataBuffer()
+ *
+ *  Description:
+ *      Get a reference to the underlying DataBuffer for use with functions
+ *      or objects that operate on a DataBuffer, such as DataWriter and
+ *      DataReader.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A reference to the underlying DataBuffer.
+ *
+ *  Comments:
+ *      The space occupied by data that has been read is reclaimed before
+ *      returning.  Data may be appended to the DataBuffer up to the free
+ *      length at that time.  Functions that set the buffer or data length or
+ *      that move data (e.g., Compact()) must not be called on the returned
+ *      DataBuffer.
+ */
+DataBuffer &RingDataBuffer::GetDataBuffer()
+{
+    Reclaim();
+
+    return *this;
+}
+
+/*
+ *  RingDataBuffer::GetBufferSize()
+ *
+ *  Description:
+ *      Get the size of the ring buffer.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The size of the ring buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t RingDataBuffer::GetBufferSize() const
+{
+    return ring_size;
+}
+
+/*
+ *  RingDataBuffer::GetFreeLength()
+ *
+ *  Description:
+ *      Get the number of octets that may be appended to the ring buffer.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The number of octets that may be appended to the ring buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t RingDataBuffer::GetFreeLength() const
+{
+    return ring_size - GetUnreadLength();
+}
+
+/*
+ *  RingDataBuffer::Empty()
+ *
+ *  Description:
+ *      Determine whether there is any unread data in the ring buffer.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      True if there is no unread data in the ring buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+bool RingDataBuffer::Empty() const
+{
+    return GetUnreadLength() == 0;
+}
+
+/*
+ *  RingDataBuffer::Clear()
+ *
+ *  Description:
+ *      Discard any unread data in the ring buffer.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void RingDataBuffer::Clear()
+{
+    read_position = 0;
+    data_length = 0;
+    buffer_size = ring_size;
+}
+
+/*
+ *  RingDataBuffer::GetFreeSpan()
+ *
+ *  Description:
+ *      Get a span over the free space following the unread data, suitable
+ *      for receiving data into the ring buffer.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A span over the free space in the ring buffer.
+ *
+ *  Comments:
+ *      The span is contiguous, even if the free space wraps around the end
+ *      of the ring buffer.  AdvanceDataLength() should be called with the
+ *      number of octets written into the span.
+ */
+std::span<std::uint8_t> RingDataBuffer::GetFreeSpan()
+{
+    Reclaim();
+
+    return {buffer + data_length, buffer_size - data_length};
+}
+
+/*
+ *  RingDataBuffer::AdvanceDataLength()
+ *
+ *  Description:
+ *      Advance the data length to include octets written into the span
+ *      returned by GetFreeSpan().
+ *
+ *  Parameters:
+ *      length [in]
+ *          The number of octets written.
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if the length exceeds the free
+ *      length of the ring buffer.
+ *
+ *  Comments:
+ *      None.
+ */
+void RingDataBuffer::AdvanceDataLength(std::size_t length)
+{
+    Reclaim();
+
+    if (length > (buffer_size - data_length))
+    {
+        throw DataBufferException("Cannot set the data length beyond the "
+                                  "buffer size");
+    }
+
+    data_length += length;
+}
+
+/*
+ *  RingDataBuffer::Reclaim()
+ *
+ *  Description:
+ *      Make the space occupied by data that has been read available for
+ *      appending.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      If the read position is in the second mapping, the read position and
+ *      data length are moved back by the ring size, which refers to the same
+ *      memory.  If all data has been read, both are reset to zero.
+ */
+void RingDataBuffer::Reclaim()
+{
+    if (read_position == data_length)
+    {
+        read_position = 0;
+        data_length = 0;
+    }
+    else if (read_position >= ring_size)
+    {
+        read_position -= ring_size;
+        data_length -= ring_size;
+    }
+
+    buffer_size = read_position + ring_size;
+}
+
+} // namespace Terra::NetUtil
+
+#endif // _WIN32
@@ -0,0 +1,472 @@
+/*
+ *  shared_data_buffer.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements the SharedDataBuffer object, which is an
+ *      immutable, reference-counted view of data held in a DataBuffer.
+ *
+ *      The underlying DataBuffer base of each SharedDataBuffer does not own
+ *      the memory it refers to.  Rather, the memory is owned by a DataBuffer
+ *      held via a shared pointer that is shared by all views of it.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <utility>
+#include <terra/netutil/shared_data_buffer.h>
+
+namespace Terra::NetUtil
+{
+
+/*
+ *  SharedDataBuffer::SharedDataBuffer()
+ *
+ *  Description:
+ *      Default constructor for the SharedDataBuffer object, which produces
+ *      an empty view that does not refer to any storage.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+SharedDataBuffer::SharedDataBuffer() : DataBuffer()
+{
+}
+
+/*
+ *  SharedDataBuffer::SharedDataBuffer()
+ *
+ *  Description:
+ *      Constructor for the SharedDataBuffer object that takes the contents
+ *      of the given DataBuffer without copying the data.  The view covers
+ *      the data in the DataBuffer.
+ *
+ *  Parameters:
+ *      data_buffer [in]
+ *          The DataBuffer to move into shared storage.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      If the given DataBuffer does not own its buffer (e.g., it was
+ *      constructed over a span), the caller remains responsible for ensuring
+ *      the memory outlives all SharedDataBuffer objects referring to it.
+ */
+SharedDataBuffer::SharedDataBuffer(DataBuffer &&data_buffer) :
+    DataBuffer(),
+    storage{std::make_shared<const DataBuffer>(std::move(data_buffer))}
+{
+    SetView(storage->GetBufferPointer(), storage->GetDataLength());
+}
+
+/*
+ *  SharedDataBuffer::SharedDataBuffer()
+ *
+ *  Description:
+ *      Constructor for the SharedDataBuffer object that copies the data in
+ *      the given DataBuffer into shared storage sized to fit the data.  The
+ *      view covers the data in the DataBuffer.
+ *
+ *  Parameters:
+ *      data_buffer [in]
+ *          The DataBuffer to copy into shared storage.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+SharedDataBuffer::SharedDataBuffer(const DataBuffer &data_buffer) :
+    DataBuffer(),
+    storage{std::make_shared<const DataBuffer>(data_buffer,
+                                               DataBufferCopyMode::Data,
+                                               true)}
+{
+    SetView(storage->GetBufferPointer(), storage->GetDataLength());
+}
+
+/*
+ *  SharedDataBuffer::SharedDataBuffer()
+ *
+ *  Description:
+ *      Copy constructor for the SharedDataBuffer object.  The new object
+ *      refers to the same storage and data as the other object, including
+ *      the read position, though the data is not copied.
+ *
+ *  Parameters:
+ *      other [in]
+ *          The SharedDataBuffer to copy.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+SharedDataBuffer::SharedDataBuffer(const SharedDataBuffer &other) :
+    DataBuffer()
+{
+    *this = other;
+}
+
+/*
+ *  SharedDataBuffer::SharedDataBuffer()
+ *
+ *  Description:
+ *      Move constructor for the SharedDataBuffer object.
+ *
+ *  Parameters:
+ *      other [in]
+ *          The SharedDataBuffer to move.  The other object is left empty.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+SharedDataBuffer::SharedDataBuffer(SharedDataBuffer &&other) noexcept :
+    DataBuffer()
+{
+    *this = std::move(other);
+}
+
+/*
+ *  SharedDataBuffer::operator=()
+ *
+ *  Description:
+ *      Copy assignment operator for the SharedDataBuffer object.  This object
+ *      will refer to the same storage and data as the other object, including
+ *      the read position, though the data is not copied.
+ *
+ *  Parameters:
+ *      other [in]
+ *          The SharedDataBuffer to copy.
+ *
+ *  Returns:
+ *      A reference to this object.
+ *
+ *  Comments:
+ *      None.
+ */
+SharedDataBuffer &SharedDataBuffer::operator=(const SharedDataBuffer &other)
+{
+    // Do nothing if assigning to self
+    if (this == &other) return *this;
+
+    storage = other.storage;
+    SetView(other.buffer, other.data_length);
+    read_position = other.read_position;
+
+    return *this;
+}
+
+/*
+ *  SharedDataBuffer::operator=()
+ *
+ *  Description:
+ *      Move assignment operator for the SharedDataBuffer object.
+ *
+ *  Parameters:
+ *      other [in]
+ *          The SharedDataBuffer to move.  The other object is left empty.
+ *
+ *  Returns:
+ *      A reference to this object.
+ *
+ *  Comments:
+ *      None.
+ */
+SharedDataBuffer &SharedDataBuffer::operator=(SharedDataBuffer &&other) noexcept
+{
+    // Do nothing if assigning to self
+    if (this == &other) return *this;
+
+    storage = std::move(other.storage);
+    SetView(other.buffer, other.data_length);
+    read_position = other.read_position;
+
+    other.SetView(nullptr, 0);
+
+    return *this;
+}
+
+/*
+ *  SharedDataBuffer::Slice()
+ *
+ *  Description:
+ *      Return a SharedDataBuffer viewing a portion of the data in this
+ *      SharedDataBuffer.  The returned object shares the same storage, so
+ *      no data is copied, and has a read position of zero.
+ *
+ *  Parameters:
+ *      offset [in]
+ *          The offset into this object's data at which the slice begins.
+ *
+ *      length [in]
+ *          The length of the slice.
+ *
+ *  Returns:
+ *      A SharedDataBuffer viewing the requested portion of the data.  An
+ *      exception is thrown if the slice would extend beyond the data.
+ *
+ *  Comments:
+ *      The offset is relative to the start of the data, not to the read
+ *      position.
+ */
+SharedDataBuffer SharedDataBuffer::Slice(std::size_t offset,
+                                         std::size_t length) const
+{
+    // Ensure the slice is within the data
+    if ((offset > data_length) || (length > (data_length - offset)))
+    {
+        throw DataBufferException("Slice extends beyond the data length");
+    }
+
+    SharedDataBuffer slice;
+
+    slice.storage = storage;
+    slice.SetView(buffer + offset, length);
+
+    return slice;
+}
+
+/*
+ *  SharedDataBuffer::Slice()
+ *
+ *  Description:
+ *      Return a SharedDataBuffer viewing the data in this SharedDataBuffer
+ *      from the given offset to the end of the data.  The returned object
+ *      shares the same storage, so no data is copied, and has a read position
+ *      of zero.
+ *
+ *  Parameters:
+ *      offset [in]
+ *          The offset into this object's data at which the slice begins.
+ *
+ *  Returns:
+ *      A SharedDataBuffer viewing the requested portion of the data.  An
+ *      exception is thrown if the offset is beyond the data.
+ *
+ *  Comments:
+ *      None.
+ */
+SharedDataBuffer SharedDataBuffer::Slice(std::size_t offset) const
+{
+    if (offset > data_length)
+    {
+        throw DataBufferException("Slice extends beyond the data length");
+    }
+
+    return Slice(offset, data_length - offset);
+}
+
+/*
+ *  SharedDataBuffer::GetUseCount()
+ *
+ *  Description:
+ *      Return the number of SharedDataBuffer objects referring to the same
+ *      storage as this object.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The number of objects sharing the storage, or zero if this object
+ *      does not refer to any storage.
+ *
+ *  Comments:
+ *      When objects are used on multiple threads, the value is approximate.
+ */
+long SharedDataBuffer::GetUseCount() const
+{
+    return storage.use_count();
+}
+
+/*
+ *  SharedDataBuffer::GetDataBuffer()
+ *
+ *  Description:
+ *      Return a const reference to this view as a DataBuffer.  This allows
+ *      the SharedDataBuffer to be given to functions that accept a const
+ *      DataBuffer.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A const reference to the DataBuffer view of the shared data.
+ *
+ *  Comments:
+ *      The returned DataBuffer does not own the memory it refers to, so it
+ *      must not be used after this object is destroyed.  Copying it to
+ *      another DataBuffer will copy the data.
+ */
+const DataBuffer &SharedDataBuffer::GetDataBuffer() const
+{
+    return *this;
+}
+
+/*
+ *  SharedDataBuffer::GetBufferPointer()
+ *
+ *  Description:
+ *      Return a pointer to the shared data at the given offset.
+ *
+ *  Parameters:
+ *      offset [in]
+ *          The offset into the data.
+ *
+ *  Returns:
+ *      A pointer to the data at the given offset or nullptr if this object
+ *      refers to no data.  An exception is thrown if the offset is beyond the
+ *      end of the data.
+ *
+ *  Comments:
+ *      None.
+ */
+const std::uint8_t *SharedDataBuffer::GetBufferPointer(std::size_t offset) const
+{
+    return DataBuffer::GetBufferPointer(offset);
+}
+
+/*
+ *  SharedDataBuffer::GetBufferSpan()
+ *
+ *  Description:
+ *      Return a span over the shared data with respect to the current read
+ *      position and data length.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A span over the unread data.
+ *
+ *  Comments:
+ *      None.
+ */
+std::span<const std::uint8_t> SharedDataBuffer::GetBufferSpan() const
+{
+    return DataBuffer::GetBufferSpan();
+}
+
+/*
+ *  SharedDataBuffer::operator[]()
+ *
+ *  Description:
+ *      Return a reference to the octet at the given index.
+ *
+ *  Parameters:
+ *      index [in]
+ *          The index of the octet to return.
+ *
+ *  Returns:
+ *      A const reference to the requested octet.  An exception is thrown if
+ *      the index is beyond the end of the data.
+ *
+ *  Comments:
+ *      None.
+ */
+const std::uint8_t &SharedDataBuffer::operator[](std::size_t index) const
+{
+    return DataBuffer::operator[](index);
+}
+
+/*
+ *  SharedDataBuffer::operator==()
+ *
+ *  Description:
+ *      This operator will compare this SharedDataBuffer with another.  Two
+ *      SharedDataBuffer objects are considered equal if both have the same
+ *      data length and the data are identical.  The read position value is
+ *      not a factor in equality.
+ *
+ *  Parameters:
+ *      other [in]
+ *          A reference to the other SharedDataBuffer with which to compare.
+ *
+ *  Returns:
+ *      True if equal, false of not equal.
+ *
+ *  Comments:
+ *      None.
+ */
+bool SharedDataBuffer::operator==(const SharedDataBuffer &other) const
+{
+    // Is the data length the same?
+    if (data_length != other.data_length) return false;
+
+    // If the data length is zero or the data is the same, they are equal
+    if ((data_length == 0) || (buffer == other.buffer)) return true;
+
+    return std::equal(buffer, buffer + data_length, other.buffer);
+}
+
+/*
+ *  SharedDataBuffer::operator!=()
+ *
+ *  Description:
+ *      This operator will compare this SharedDataBuffer with another.  Two
+ *      SharedDataBuffer objects are considered equal if both have the same
+ *      data length and the data are identical.  The read position value is
+ *      not a factor in equality.
+ *
+ *  Parameters:
+ *      other [in]
+ *          A reference to the other SharedDataBuffer with which to compare.
+ *
+ *  Returns:
+ *      True if not equal, false if equal.
+ *
+ *  Comments:
+ *      None.
+ */
+bool SharedDataBuffer::operator!=(const SharedDataBuffer &other) const
+{
+    return !(*this == other);
+}
+
+/*
+ *  SharedDataBuffer::SetView()
+ *
+ *  Description:
+ *      Set the underlying DataBuffer to refer to the given data without
+ *      taking ownership of it.  The read position is set to zero.
+ *
+ *  Parameters:
+ *      data [in]
+ *          A pointer to the data within the shared storage.
+ *
+ *      length [in]
+ *          The length of the data.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      A zero length view refers to no buffer at all, since a DataBuffer
+ *      may not refer to a zero length buffer.
+ */
+void SharedDataBuffer::SetView(std::uint8_t *data, std::size_t length)
+{
+    SetBuffer((length > 0) ? data : nullptr, length, length);
+}
+
+} // namespace Terra::NetUtil
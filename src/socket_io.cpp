@@ -0,0 +1,868 @@
+/*
+ *  socket_io.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements the functions that send and receive data between
+ *      a socket and a DataBuffer.
+ *
+ *  Portability Issues:
+ *      The Windows socket functions accept a char pointer and an int length,
+ *      so the functions in the anonymous namespace hide those differences.
+ */
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstring>
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/uio.h>
+#endif
+#ifdef __linux__
+#include <netinet/udp.h>
+#endif
+#include <terra/netutil/socket_io.h>
+
+namespace Terra::NetUtil
+{
+
+namespace
+{
+
+/*
+ *  SocketReceive()
+ *
+ *  Description:
+ *      Call recvfrom() with arguments suitable for the platform.
+ *
+ *  Parameters:
+ *      socket [in]
+ *          The socket from which to receive.
+ *
+ *      buffer [out]
+ *          The buffer into which to receive.
+ *
+ *      length [in]
+ *          The length of the buffer.
+ *
+ *      flags [in]
+ *          Flags to pass to recvfrom().
+ *
+ *      address [out]
+ *          The source address, or nullptr if not required.
+ *
+ *      address_length [in/out]
+ *          The length of the address storage, or nullptr if not required.
+ *
+ *  Returns:
+ *      The value returned by recvfrom().
+ *
+ *  Comments:
+ *      None.
+ */
+std::ptrdiff_t SocketReceive(SocketHandle socket,
+                             std::uint8_t *buffer,
+                             std::size_t length,
+                             int flags,
+                             sockaddr *address,
+                             socklen_t *address_length)
+{
+#ifdef _WIN32
+    return recvfrom(socket,
+                    reinterpret_cast<char *>(buffer),
+                    static_cast<int>(std::min<std::size_t>(length, INT_MAX)),
+                    flags,
+                    address,
+                    address_length);
+#else
+    return recvfrom(socket, buffer, length, flags, address, address_length);
+#endif
+}
+
+/*
+ *  SocketSend()
+ *
+ *  Description:
+ *      Call sendto() with arguments suitable for the platform.
+ *
+ *  Parameters:
+ *      socket [in]
+ *          The socket on which to send.
+ *
+ *      buffer [in]
+ *          The data to send.
+ *
+ *      length [in]
+ *          The length of the data.
+ *
+ *      flags [in]
+ *          Flags to pass to sendto().
+ *
+ *      address [in]
+ *          The destination address, or nullptr if the socket is connected.
+ *
+ *      address_length [in]
+ *          The length of the address, or zero if the socket is connected.
+ *
+ *  Returns:
+ *      The value returned by sendto().
+ *
+ *  Comments:
+ *      None.
+ */
+std::ptrdiff_t SocketSend(SocketHandle socket,
+                          const std::uint8_t *buffer,
+                          std::size_t length,
+                          int flags,
+                          const sockaddr *address,
+                          socklen_t address_length)
+{
+#ifdef _WIN32
+    return sendto(socket,
+                  reinterpret_cast<const char *>(buffer),
+                  static_cast<int>(std::min<std::size_t>(length, INT_MAX)),
+                  flags,
+                  address,
+                  address_length);
+#else
+    return sendto(socket, buffer, length, flags, address, address_length);
+#endif
+}
+
+/*
+ *  ClearAddressTail()
+ *
+ *  Description:
+ *      Zero the part of the address storage following the address written
+ *      by the operating system, so that no part of any previously assigned
+ *      address remains.
+ *
+ *  Parameters:
+ *      address [in/out]
+ *          The address into which the operating system wrote an address.
+ *
+ *      address_length [in]
+ *          The length of the address written.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+[[maybe_unused]] void ClearAddressTail(NetworkAddress &address,
+                                       std::size_t address_length)
+{
+    auto *storage = reinterpret_cast<std::uint8_t *>(
+                                                address.GetAddressStorage());
+
+    if (address_length >= sizeof(sockaddr_storage)) return;
+
+    std::memset(storage + address_length,
+                0,
+                sizeof(sockaddr_storage) - address_length);
+}
+
+} // namespace
+
+/*
+ *  Receive()
+ *
+ *  Description:
+ *      Receive data from a stream socket into the free space following the
+ *      data in the given DataBuffer.
+ *
+ *  Parameters:
+ *      socket [in]
+ *          The socket from which to receive.
+ *
+ *      data_buffer [in/out]
+ *          The DataBuffer into which data is received.  The data length is
+ *          advanced by the number of octets received.
+ *
+ *      flags [in]
+ *          Flags to pass to the underlying socket function.
+ *
+ *  Returns:
+ *      The number of octets received, zero if the peer closed the connection
+ *      (or there is no free space), or -1 on failure.
+ *
+ *  Comments:
+ *      The DataBuffer is not grown, so one should ensure there is free space
+ *      (e.g., by calling GetFreeSpan() with a length) before calling this.
+ */
+std::ptrdiff_t Receive(SocketHandle socket,
+                       DataBuffer &data_buffer,
+                       int flags)
+{
+    std::span<std::uint8_t> free_space = data_buffer.GetFreeSpan();
+
+    std::ptrdiff_t result = SocketReceive(socket,
+                                          free_space.data(),
+                                          free_space.size(),
+                                          flags,
+                                          nullptr,
+                                          nullptr);
+
+    if (result > 0)
+    {
+        data_buffer.AdvanceDataLength(
+            std::min(static_cast<std::size_t>(result), free_space.size()));
+    }
+
+    return result;
+}
+
+/*
+ *  Send()
+ *
+ *  Description:
+ *      Send the unread data in the given DataBuffer on a stream socket.
+ *
+ *  Parameters:
+ *      socket [in]
+ *          The socket on which to send.
+ *
+ *      data_buffer [in/out]
+ *          The DataBuffer holding the data to send.  The read position is
+ *          advanced by the number of octets sent.
+ *
+ *      flags [in]
+ *          Flags to pass to the underlying socket function.
+ *
+ *  Returns:
+ *      The number of octets sent or -1 on failure.
+ *
+ *  Comments:
+ *      None.
+ */
+std::ptrdiff_t Send(SocketHandle socket, DataBuffer &data_buffer, int flags)
+{
+    std::span<std::uint8_t> unread = data_buffer.GetBufferSpan();
+
+    std::ptrdiff_t result = SocketSend(socket,
+                                       unread.data(),
+                                       unread.size(),
+                                       flags,
+                                       nullptr,
+                                       0);
+
+    if (result > 0)
+    {
+        data_buffer.AdvanceReadPosition(static_cast<std::size_t>(result));
+    }
+
+    return result;
+}
+
+/*
+ *  ReceiveFrom()
+ *
+ *  Description:
+ *      Receive a datagram into the start of the given DataBuffer.
+ *
+ *  Parameters:
+ *      socket [in]
+ *          The socket from which to receive.
+ *
+ *      data_buffer [out]
+ *          The DataBuffer into which the datagram is received.  The data
+ *          length is set to the length of the datagram and the read position
+ *          is set to zero.
+ *
+ *      address [out]
+ *          The source address of the datagram.
+ *
+ *      flags [in]
+ *          Flags to pass to the underlying socket function.
+ *
+ *  Returns:
+ *      The length of the datagram or -1 on failure.
+ *
+ *  Comments:
+ *      If the datagram is larger than the buffer, the excess is discarded.
+ */
+std::ptrdiff_t ReceiveFrom(SocketHandle socket,
+                           DataBuffer &data_buffer,
+                           NetworkAddress &address,
+                           int flags)
+{
+    sockaddr_storage storage{};
+    auto *storage_address = reinterpret_cast<sockaddr *>(&storage);
+    socklen_t storage_length = sizeof(storage);
+
+    std::ptrdiff_t result = SocketReceive(socket,
+                                          data_buffer.GetBufferPointer(),
+                                          data_buffer.GetBufferSize(),
+                                          flags,
+                                          storage_address,
+                                          &storage_length);
+
+    if (result < 0) return result;
+
+    data_buffer.SetDataLength(std::min(static_cast<std::size_t>(result),
+                                       data_buffer.GetBufferSize()));
+    address.AssignAddress(&storage, storage_length);
+
+    return result;
+}
+
+/*
+ *  SendTo()
+ *
+ *  Description:
+ *      Send the unread data in the given DataBuffer as a datagram.
+ *
+ *  Parameters:
+ *      socket [in]
+ *          The socket on which to send.
+ *
+ *      data_buffer [in/out]
+ *          The DataBuffer holding the data to send.  The read position is
+ *          advanced by the number of octets sent.
+ *
+ *      address [in]
+ *          The destination address.  If empty, the datagram is sent to the
+ *          address to which the socket is connected.
+ *
+ *      flags [in]
+ *          Flags to pass to the underlying socket function.
+ *
+ *  Returns:
+ *      The number of octets sent or -1 on failure.
+ *
+ *  Comments:
+ *      None.
+ */
+std::ptrdiff_t SendTo(SocketHandle socket,
+                      DataBuffer &data_buffer,
+                      const NetworkAddress &address,
+                      int flags)
+{
+    std::span<std::uint8_t> unread = data_buffer.GetBufferSpan();
+
+    std::ptrdiff_t result = SocketSend(
+        socket,
+        unread.data(),
+        unread.size(),
+        flags,
+        address.Empty() ? nullptr :
+                          reinterpret_cast<const sockaddr *>(
+                              address.GetAddressStorage()),
+        address.Empty() ? 0 : address.GetAddressStorageSize());
+
+    if (result > 0)
+    {
+        data_buffer.AdvanceReadPosition(static_cast<std::size_t>(result));
+    }
+
+    return result;
+}
+
+/*
+ *  ReceiveFrom()
+ *
+ *  Description:
+ *      Receive multiple datagrams, each into the start of the DataBuffer of
+ *      the corresponding Datagram.
+ *
+ *  Parameters:
+ *      socket [in]
+ *          The socket from which to receive.
+ *
+ *      datagrams [out]
+ *          The Datagrams into which datagrams are received.  For each
+ *          datagram received, the data length of the DataBuffer is set to the
+ *          length of the datagram, the read position is set to zero, and the
+ *          address is set to the source address.  At most Socket_Batch_Size
+ *          datagrams are received.
+ *
+ *      flags [in]
+ *          Flags to pass to the underlying socket function.
+ *
+ *  Returns:
+ *      The number of datagrams received or -1 on failure.
+ *
+ *  Comments:
+ *      If the socket is blocking, this waits for the first datagram only.
+ *      Datagrams beyond the number returned are unchanged.
+ */
+std::ptrdiff_t ReceiveFrom(SocketHandle socket,
+                           std::span<Datagram> datagrams,
+                           int flags)
+{
+    const std::size_t count = std::min(datagrams.size(), Socket_Batch_Size);
+
+    if (count == 0) return 0;
+
+#ifdef __linux__
+    std::array<mmsghdr, Socket_Batch_Size> messages{};
+    std::array<iovec, Socket_Batch_Size> vectors{};
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        DataBuffer &data_buffer = datagrams[i].data_buffer;
+
+        vectors[i].iov_base = data_buffer.GetBufferPointer();
+        vectors[i].iov_len = data_buffer.GetBufferSize();
+        messages[i].msg_hdr.msg_name = datagrams[i].address.GetAddressStorage();
+        messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+        messages[i].msg_hdr.msg_iov = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int result = recvmmsg(socket,
+                          messages.data(),
+                          static_cast<unsigned int>(count),
+                          flags | MSG_WAITFORONE,
+                          nullptr);
+
+    if (result < 0) return result;
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(result); i++)
+    {
+        Datagram &datagram = datagrams[i];
+
+        datagram.data_buffer.SetDataLength(
+            std::min(static_cast<std::size_t>(messages[i].msg_len),
+                     datagram.data_buffer.GetBufferSize()));
+        datagram.truncated = (messages[i].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+        ClearAddressTail(datagram.address, messages[i].msg_hdr.msg_namelen);
+    }
+
+    return result;
+#else
+    // Wait only for the first datagram
+    std::ptrdiff_t result = ReceiveFrom(socket,
+                                        datagrams[0].data_buffer,
+                                        datagrams[0].address,
+                                        flags);
+    if (result < 0) return result;
+    datagrams[0].truncated = false;
+
+#ifdef _WIN32
+    // There is no means of receiving only those datagrams already available
+    return 1;
+#else
+    std::size_t received = 1;
+
+    while (received < count)
+    {
+        Datagram &datagram = datagrams[received];
+
+        result = ReceiveFrom(socket,
+                             datagram.data_buffer,
+                             datagram.address,
+                             flags | MSG_DONTWAIT);
+        if (result < 0) break;
+        datagram.truncated = false;
+        received++;
+    }
+
+    return static_cast<std::ptrdiff_t>(received);
+#endif
+#endif
+}
+
+/*
+ *  SendTo()
+ *
+ *  Description:
+ *      Send the unread data in the DataBuffer of each Datagram as a datagram
+ *      to the corresponding address.
+ *
+ *  Parameters:
+ *      socket [in]
+ *          The socket on which to send.
+ *
+ *      datagrams [in/out]
+ *          The Datagrams to send.  For each datagram sent, the read position
+ *          of the DataBuffer is advanced by the number of octets sent.  If
+ *          an address is empty, the datagram is sent to the address to which
+ *          the socket is connected.
+ *
+ *      flags [in]
+ *          Flags to pass to the underlying socket function.
+ *
+ *  Returns:
+ *      The number of datagrams sent or -1 on failure.
+ *
+ *  Comments:
+ *      Datagrams are sent in groups of up to Socket_Batch_Size, each with a
+ *      single system call.  If fewer datagrams than requested are sent (e.g.,
+ *      because a non-blocking socket's buffer is full), the number sent is
+ *      returned and the remaining datagrams may be sent by calling this
+ *      function again.  Failure is indicated only if no datagram was sent.
+ */
+std::ptrdiff_t SendTo(SocketHandle socket,
+                      std::span<Datagram> datagrams,
+                      int flags)
+{
+    std::size_t sent = 0;
+
+#ifdef __linux__
+    std::array<mmsghdr, Socket_Batch_Size> messages{};
+    std::array<iovec, Socket_Batch_Size> vectors{};
+
+    while (sent < datagrams.size())
+    {
+        const std::size_t count = std::min(datagrams.size() - sent,
+                                           Socket_Batch_Size);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            Datagram &datagram = datagrams[sent + i];
+            std::span<std::uint8_t> unread =
+                datagram.data_buffer.GetBufferSpan();
+
+            vectors[i].iov_base = unread.data();
+            vectors[i].iov_len = unread.size();
+            messages[i].msg_hdr = {};
+            if (!datagram.address.Empty())
+            {
+                messages[i].msg_hdr.msg_name =
+                    datagram.address.GetAddressStorage();
+                messages[i].msg_hdr.msg_namelen =
+                    datagram.address.GetAddressStorageSize();
+            }
+            messages[i].msg_hdr.msg_iov = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        int result = sendmmsg(socket,
+                              messages.data(),
+                              static_cast<unsigned int>(count),
+                              flags);
+
+        if (result < 0) break;
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(result); i++)
+        {
+            datagrams[sent + i].data_buffer.AdvanceReadPosition(
+                messages[i].msg_len);
+        }
+
+        sent += static_cast<std::size_t>(result);
+
+        if (static_cast<std::size_t>(result) < count) break;
+    }
+#else
+    while (sent < datagrams.size())
+    {
+        std::ptrdiff_t result = SendTo(socket,
+                                       datagrams[sent].data_buffer,
+                                       datagrams[sent].address,
+                                       flags);
+        if (result < 0) break;
+        sent++;
+    }
+#endif
+
+    if ((sent == 0) && !datagrams.empty()) return -1;
+
+    return static_cast<std::ptrdiff_t>(sent);
+}
+
+/*
+ *  SendSegments()
+ *
+ *  Description:
+ *      Send the unread data in the given DataBuffer as a series of datagrams
+ *      of the given segment size, using UDP segmentation offload where
+ *      available.
+ *
+ *  Parameters:
+ *      socket [in]
+ *          The socket on which to send.
+ *
+ *      data_buffer [in/out]
+ *          The DataBuffer holding the data to send.  The read position is
+ *          advanced by the number of octets sent.
+ *
+ *      segment_size [in]
+ *          The size of each datagram.  The last datagram is shorter if the
+ *          unread data is not a multiple of the segment size.  If zero, the
+ *          unread data is sent as a single datagram.
+ *
+ *      address [in]
+ *          The destination address.  If empty, the datagrams are sent to the
+ *          address to which the socket is connected.
+ *
+ *      flags [in]
+ *          Flags to pass to the underlying socket function.
+ *
+ *  Returns:
+ *      The number of octets sent or -1 on failure.
+ *
+ *  Comments:
+ *      Up to Segment_Offload_Count segments totaling no more than
+ *      Segment_Offload_Length octets are sent with each system call.  If a
+ *      system call fails after some data was sent, the number of octets sent
+ *      is returned.
+ */
+std::ptrdiff_t SendSegments(SocketHandle socket,
+                            DataBuffer &data_buffer,
+                            std::size_t segment_size,
+                            const NetworkAddress &address,
+                            int flags)
+{
+    std::span<std::uint8_t> unread = data_buffer.GetBufferSpan();
+    std::size_t sent = 0;
+
+    // Data that fits in a single datagram needs no segmentation
+    if ((segment_size == 0) || (segment_size >= unread.size()))
+    {
+        return SendTo(socket, data_buffer, address, flags);
+    }
+
+    const auto *name = address.Empty() ?
+                           nullptr :
+                           reinterpret_cast<const sockaddr *>(
+                               address.GetAddressStorage());
+    const socklen_t name_length =
+        address.Empty() ? 0 : address.GetAddressStorageSize();
+
+#ifdef UDP_SEGMENT
+    // Determine how much data may be sent with each system call
+    const std::size_t limit =
+        std::max<std::size_t>(std::min(Segment_Offload_Count,
+                                       Segment_Offload_Length / segment_size),
+                              1) *
+        segment_size;
+
+    while (sent < unread.size())
+    {
+        const std::size_t length = std::min(unread.size() - sent, limit);
+        alignas(cmsghdr) std::array<std::uint8_t,
+                                    CMSG_SPACE(sizeof(std::uint16_t))>
+            control{};
+        iovec vector{unread.data() + sent, length};
+        msghdr message{};
+
+        message.msg_name = const_cast<sockaddr *>(name);
+        message.msg_namelen = name_length;
+        message.msg_iov = &vector;
+        message.msg_iovlen = 1;
+
+        // Request segmentation if there is more than one segment
+        if (length > segment_size)
+        {
+            const auto segment = static_cast<std::uint16_t>(segment_size);
+
+            message.msg_control = control.data();
+            message.msg_controllen = control.size();
+
+            cmsghdr *header = CMSG_FIRSTHDR(&message);
+            header->cmsg_level = IPPROTO_UDP;
+            header->cmsg_type = UDP_SEGMENT;
+            header->cmsg_len = CMSG_LEN(sizeof(segment));
+            std::memcpy(CMSG_DATA(header), &segment, sizeof(segment));
+        }
+
+        std::ptrdiff_t result = sendmsg(socket, &message, flags);
+        if (result < 0) break;
+
+        sent += static_cast<std::size_t>(result);
+    }
+#else
+    while (sent < unread.size())
+    {
+        const std::size_t length = std::min(unread.size() - sent,
+                                            segment_size);
+
+        std::ptrdiff_t result = SocketSend(socket,
+                                           unread.data() + sent,
+                                           length,
+                                           flags,
+                                           name,
+                                           name_length);
+        if (result < 0) break;
+
+        sent += static_cast<std::size_t>(result);
+    }
+#endif
+
+    if (sent == 0) return -1;
+
+    data_buffer.AdvanceReadPosition(sent);
+
+    return static_cast<std::ptrdiff_t>(sent);
+}
+
+/*
+ *  EnableReceiveOffload()
+ *
+ *  Description:
+ *      Enable UDP receive offload on the given socket, allowing the kernel to
+ *      coalesce datagrams received from the same source.
+ *
+ *  Parameters:
+ *      socket [in]
+ *          The socket on which to enable receive offload.
+ *
+ *  Returns:
+ *      True if receive offload was enabled, false otherwise.
+ *
+ *  Comments:
+ *      Once enabled, datagrams should be received using ReceiveSegments(),
+ *      since other functions do not report the segment size.
+ */
+bool EnableReceiveOffload([[maybe_unused]] SocketHandle socket)
+{
+#ifdef UDP_GRO
+    int enable = 1;
+
+    return setsockopt(socket,
+                      IPPROTO_UDP,
+                      UDP_GRO,
+                      &enable,
+                      sizeof(enable)) == 0;
+#else
+    return false;
+#endif
+}
+
+/*
+ *  ReceiveSegments()
+ *
+ *  Description:
+ *      Receive one or more datagrams coalesced by UDP receive offload into the
+ *      start of the given DataBuffer.
+ *
+ *  Parameters:
+ *      socket [in]
+ *          The socket from which to receive.
+ *
+ *      data_buffer [out]
+ *          The DataBuffer into which the datagrams are received.  The data
+ *          length is set to the length received and the read position is set
+ *          to zero.
+ *
+ *      address [out]
+ *          The source address of the datagrams.
+ *
+ *      segment_size [out]
+ *          The size of each datagram, except that the last may be shorter.
+ *          If the datagrams were not coalesced, this is the length received.
+ *
+ *      flags [in]
+ *          Flags to pass to the underlying socket function.
+ *
+ *  Returns:
+ *      The length received or -1 on failure.
+ *
+ *  Comments:
+ *      See SplitSegments() to separate the datagrams.
+ */
+std::ptrdiff_t ReceiveSegments(SocketHandle socket,
+                               DataBuffer &data_buffer,
+                               NetworkAddress &address,
+                               std::size_t &segment_size,
+                               int flags)
+{
+#ifdef UDP_GRO
+    alignas(cmsghdr) std::array<std::uint8_t, 256> control{};
+    sockaddr_storage storage{};
+    iovec vector{data_buffer.GetBufferPointer(), data_buffer.GetBufferSize()};
+    msghdr message{};
+
+    message.msg_name = &storage;
+    message.msg_namelen = sizeof(storage);
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    message.msg_control = control.data();
+    message.msg_controllen = control.size();
+
+    std::ptrdiff_t result = recvmsg(socket, &message, flags);
+
+    if (result < 0) return result;
+
+    data_buffer.SetDataLength(std::min(static_cast<std::size_t>(result),
+                                       data_buffer.GetBufferSize()));
+    address.AssignAddress(&storage, message.msg_namelen);
+
+    // The segment size is reported only if datagrams were coalesced
+    segment_size = data_buffer.GetDataLength();
+    for (cmsghdr *header = CMSG_FIRSTHDR(&message);
+         header != nullptr;
+         header = CMSG_NXTHDR(&message, header))
+    {
+        if ((header->cmsg_level == IPPROTO_UDP) &&
+            (header->cmsg_type == UDP_GRO))
+        {
+            int segment{};
+            std::memcpy(&segment, CMSG_DATA(header), sizeof(segment));
+            segment_size = static_cast<std::size_t>(segment);
+        }
+    }
+
+    return result;
+#else
+    std::ptrdiff_t result = ReceiveFrom(socket, data_buffer, address, flags);
+
+    if (result >= 0) segment_size = data_buffer.GetDataLength();
+
+    return result;
+#endif
+}
+
+/*
+ *  SplitSegments()
+ *
+ *  Description:
+ *      Assign each of the datagrams in the unread data of the given DataBuffer
+ *      to a DataBuffer that refers to that datagram.
+ *
+ *  Parameters:
+ *      data_buffer [in/out]
+ *          The DataBuffer holding the datagrams (see ReceiveSegments()).  The
+ *          read position is advanced past the datagrams assigned.
+ *
+ *      segment_size [in]
+ *          The size of each datagram, except that the last may be shorter.
+ *          If zero, the unread data is treated as a single datagram.
+ *
+ *      segments [out]
+ *          The DataBuffers to which the datagrams are assigned.  Each refers
+ *          to memory within the given DataBuffer, so the given DataBuffer
+ *          must not be modified or destroyed while they are in use.
+ *
+ *  Returns:
+ *      The number of datagrams assigned.
+ *
+ *  Comments:
+ *      If there are more datagrams than DataBuffers given, this function may
+ *      be called again to assign the remaining datagrams.
+ */
+std::size_t SplitSegments(DataBuffer &data_buffer,
+                          std::size_t segment_size,
+                          std::span<DataBuffer> segments)
+{
+    std::span<std::uint8_t> unread = data_buffer.GetBufferSpan();
+    std::size_t offset = 0;
+    std::size_t count = 0;
+
+    if (segment_size == 0) segment_size = unread.size();
+
+    while ((offset < unread.size()) && (count < segments.size()))
+    {
+        const std::size_t length = std::min(segment_size,
+                                            unread.size() - offset);
+
+        segments[count++].SetBuffer(unread.subspan(offset, length));
+        offset += length;
+    }
+
+    data_buffer.AdvanceReadPosition(offset);
+
+    return count;
+}
+
+} // namespace Terra::NetUtil
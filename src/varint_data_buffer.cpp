@@ -31,12 +31,51 @@
  *      None.
  */
 
+#include <cstring>
 #include <terra/netutil/varint_data_buffer.h>
 #include <terra/bitutil/significant_bit.h>
 
 namespace Terra::NetUtil
 {
 
+namespace
+{
+
+/*
+ *  CheckStatus()
+ *
+ *  Description:
+ *      Throw an exception if the given status resulting from decoding a
+ *      variable-width integer indicates failure.
+ *
+ *  Parameters:
+ *      status [in]
+ *          The status returned by VarIntDataBuffer::DecodeValue().
+ *
+ *  Returns:
+ *      Nothing.  An exception is thrown if the status is not success.
+ *
+ *  Comments:
+ *      None.
+ */
+void CheckStatus(DataBufferStatus status)
+{
+    switch (status)
+    {
+        case DataBufferStatus::Success:
+            break;
+
+        case DataBufferStatus::Malformed:
+            throw DataBufferException("Variable width integer read from the "
+                                      "buffer is malformed");
+
+        default:
+            throw DataBufferException("Attempt to read beyond the data length");
+    }
+}
+
+} // namespace
+
 /*
  *  VarIntDataBuffer::SetValue()
  *
@@ -173,43 +212,11 @@ std::size_t VarIntDataBuffer::SetValue(const VarInt64_t &value,
 std::size_t VarIntDataBuffer::GetValue(VarUint64_t &value,
                                        std::size_t offset) const
 {
-    std::uint8_t octet{0x80};
-    std::size_t total_octets{0};
+    std::size_t length{};
 
-    // Initialize the VarUint64_t
-    value = 0;
+    CheckStatus(DecodeValue(value, offset, buffer_size, length));
 
-    // Read octets until we find the last one having a 0 MSb
-    while ((octet & 0x80) != 0)
-    {
-        // A 64-bits value should never require more than 10 octets
-        if (++total_octets == 11)
-        {
-            throw DataBufferException("Variable width integer exceeds the "
-                                      "maximum supported length");
-        }
-
-        // Ensure we do not read beyond the buffer
-        if ((offset + total_octets) > buffer_size)
-        {
-            throw DataBufferException("Attempt to read beyond the data length");
-        }
-
-        // Get the target octet
-        octet = buffer[offset + total_octets - 1];
-
-        // Add these bits to the returned value
-        value = (value << 7) | (octet & 0x7f);
-    }
-
-    // If the total length is 10 octets, initial octet must be 0x81
-    if ((total_octets == 10) && (buffer[offset] != 0x81))
-    {
-        throw DataBufferException("Variable width integer read from the buffer "
-                                  "is malformed");
-    }
-
-    return total_octets;
+    return length;
 }
 
 /*
@@ -240,51 +247,11 @@ std::size_t VarIntDataBuffer::GetValue(VarUint64_t &value,
 std::size_t VarIntDataBuffer::GetValue(VarInt64_t &value,
                                        std::size_t offset) const
 {
-    std::uint8_t octet{0x80};
-    std::size_t total_octets{0};
+    std::size_t length{};
 
-    // Ensure we do not read beyond the buffer
-    if (offset > buffer_size)
-    {
-        throw DataBufferException("Attempt to read beyond the data length");
-    }
-
-    // Determine the sign of the number by inspecting the leading sign bit
-    value = ((buffer[offset] & 0x40) != 0) ? -1 : 0;
+    CheckStatus(DecodeValue(value, offset, buffer_size, length));
 
-    // Read octets until we find the last one having a 0 MSb
-    while ((octet & 0x80) != 0)
-    {
-        // A 64-bits value should never require more than 10 octets
-        if (++total_octets == 11)
-        {
-            throw DataBufferException("VarInt exceeds the maximum supported "
-                                      "length");
-        }
-
-        // Ensure we do not read beyond the buffer
-        if ((offset + total_octets) > buffer_size)
-        {
-            throw DataBufferException("Attempt to read beyond the data length");
-        }
-
-        // Get the target octet
-        octet = buffer[offset + total_octets - 1];
-
-        // Add these bits to the returned value
-        value = (value << 7) | (octet & 0x7f);
-    }
-
-    // If the total length is 10 octets, ensure the initial octet is one
-    // of the only two valid values
-    if ((total_octets == 10) && (buffer[offset] != 0x80) &&
-        (buffer[offset] != 0xff))
-    {
-        throw DataBufferException("Variable width integer read from the buffer "
-                                  "is malformed");
-    }
-
-    return total_octets;
+    return length;
 }
 
 /*
@@ -306,6 +273,9 @@ std::size_t VarIntDataBuffer::GetValue(VarInt64_t &value,
  */
 std::size_t VarIntDataBuffer::AppendValue(const VarUint64_t &value)
 {
+    // Ensure there is space if the buffer is growable
+    EnsureAppendSpace(VarUintSize(value));
+
     std::size_t length = SetValue(value, data_length);
     data_length += length;
 
@@ -331,6 +301,9 @@ std::size_t VarIntDataBuffer::AppendValue(const VarUint64_t &value)
  */
 std::size_t VarIntDataBuffer::AppendValue(const VarInt64_t &value)
 {
+    // Ensure there is space if the buffer is growable
+    EnsureAppendSpace(VarIntSize(value));
+
     std::size_t length = SetValue(value, data_length);
     data_length += length;
 
@@ -358,12 +331,9 @@ std::size_t VarIntDataBuffer::AppendValue(const VarInt64_t &value)
  */
 std::size_t VarIntDataBuffer::ReadValue(VarUint64_t &value)
 {
-    std::size_t length = GetValue(value, read_position);
+    std::size_t length{};
 
-    if ((read_position + length) > data_length)
-    {
-        throw DataBufferException("Attempt to read beyond the data length");
-    }
+    CheckStatus(DecodeValue(value, read_position, data_length, length));
 
     read_position += length;
 
@@ -391,15 +361,510 @@ std::size_t VarIntDataBuffer::ReadValue(VarUint64_t &value)
  */
 std::size_t VarIntDataBuffer::ReadValue(VarInt64_t &value)
 {
-    std::size_t length = GetValue(value, read_position);
+    std::size_t length{};
 
-    if ((read_position + length) > data_length)
+    CheckStatus(DecodeValue(value, read_position, data_length, length));
+
+    read_position += length;
+
+    return length;
+}
+
+/*
+ *  VarIntDataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset
+ *      without throwing an exception.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *      length [out]
+ *          The total number of octets the value consumed in the DataBuffer.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was read,
+ *      DataBufferStatus::BeyondBuffer if the value extends beyond the buffer,
+ *      or DataBufferStatus::Malformed if the value is malformed.  On failure,
+ *      the value and length parameters are unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBufferStatus VarIntDataBuffer::TryGetValue(
+    VarUint64_t &value,
+    std::size_t offset,
+    std::size_t &length) const noexcept
+{
+    return DecodeValue(value, offset, buffer_size, length);
+}
+
+/*
+ *  VarIntDataBuffer::TryGetValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the given offset
+ *      without throwing an exception.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value to retrieve from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *      length [out]
+ *          The total number of octets the value consumed in the DataBuffer.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was read,
+ *      DataBufferStatus::BeyondBuffer if the value extends beyond the buffer,
+ *      or DataBufferStatus::Malformed if the value is malformed.  On failure,
+ *      the value and length parameters are unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBufferStatus VarIntDataBuffer::TryGetValue(
+    VarInt64_t &value,
+    std::size_t offset,
+    std::size_t &length) const noexcept
+{
+    return DecodeValue(value, offset, buffer_size, length);
+}
+
+/*
+ *  VarIntDataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+DataBufferStatus VarIntDataBuffer::TryAppendValue(const VarUint64_t &value)
+{
+    const std::size_t length = VarUintSize(value);
+
+    // Ensure there is space if the buffer is growable
+    EnsureAppendSpace(length);
+    if (!InBounds(data_length, length, buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    data_length += SetValue(value, data_length);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  VarIntDataBuffer::TryAppendValue()
+ *
+ *  Description:
+ *      This function will append the given value to the end of the existing
+ *      data in the buffer without throwing an exception if there is
+ *      insufficient space.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to append to the end of the existing data.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was appended or
+ *      DataBufferStatus::BeyondBuffer if there is insufficient space, in which
+ *      case the DataBuffer is unchanged.
+ *
+ *  Comments:
+ *      A growable DataBuffer will be grown as necessary, so an exception of
+ *      std::bad_alloc may still be thrown if memory allocation fails.
+ */
+DataBufferStatus VarIntDataBuffer::TryAppendValue(const VarInt64_t &value)
+{
+    const std::size_t length = VarIntSize(value);
+
+    // Ensure there is space if the buffer is growable
+    EnsureAppendSpace(length);
+    if (!InBounds(data_length, length, buffer_size))
+    {
+        return DataBufferStatus::BeyondBuffer;
+    }
+
+    data_length += SetValue(value, data_length);
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  VarIntDataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position without throwing an exception.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was read,
+ *      DataBufferStatus::BeyondDataLength if the value extends beyond the
+ *      data length, or DataBufferStatus::Malformed if the value is malformed.
+ *      On failure, the value parameter and read position are unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBufferStatus VarIntDataBuffer::TryReadValue(VarUint64_t &value) noexcept
+{
+    std::size_t length{};
+
+    DataBufferStatus status =
+        DecodeValue(value, read_position, data_length, length);
+    if (status == DataBufferStatus::BeyondBuffer)
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+    if (status != DataBufferStatus::Success) return status;
+
+    read_position += length;
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  VarIntDataBuffer::TryReadValue()
+ *
+ *  Description:
+ *      This function will read a value from the buffer at the current read
+ *      position without throwing an exception.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value read from the data buffer at the current read position.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was read,
+ *      DataBufferStatus::BeyondDataLength if the value extends beyond the
+ *      data length, or DataBufferStatus::Malformed if the value is malformed.
+ *      On failure, the value parameter and read position are unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+DataBufferStatus VarIntDataBuffer::TryReadValue(VarInt64_t &value) noexcept
+{
+    std::size_t length{};
+
+    DataBufferStatus status =
+        DecodeValue(value, read_position, data_length, length);
+    if (status == DataBufferStatus::BeyondBuffer)
     {
-        throw DataBufferException("Attempt to read beyond the data length");
+        return DataBufferStatus::BeyondDataLength;
     }
+    if (status != DataBufferStatus::Success) return status;
 
     read_position += length;
 
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  VarIntDataBuffer::ReadBytesView()
+ *
+ *  Description:
+ *      This function will read an octet string preceded by its length as a
+ *      variable-width unsigned integer at the current read position,
+ *      returning a span over the octets within the buffer.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A span over the octets of the string.  An exception will be thrown if
+ *      the length is malformed or the string extends beyond the data length,
+ *      in which case the read position is unchanged.
+ *
+ *  Comments:
+ *      The octets are not copied.  The span is invalidated if the buffer is
+ *      grown, compacted, or replaced.
+ */
+std::span<std::uint8_t> VarIntDataBuffer::ReadBytesView()
+{
+    std::size_t offset{};
+    std::size_t length{};
+
+    CheckStatus(DecodeView(offset, length));
+
+    read_position = offset + length;
+
+    return {buffer + offset, length};
+}
+
+/*
+ *  VarIntDataBuffer::ReadStringView()
+ *
+ *  Description:
+ *      This function will read a character string preceded by its length as
+ *      a variable-width unsigned integer at the current read position,
+ *      returning a view of the characters within the buffer.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A view of the characters of the string.  An exception will be thrown
+ *      if the length is malformed or the string extends beyond the data
+ *      length, in which case the read position is unchanged.
+ *
+ *  Comments:
+ *      The characters are not copied.  The view is invalidated if the buffer
+ *      is grown, compacted, or replaced.
+ */
+std::string_view VarIntDataBuffer::ReadStringView()
+{
+    std::size_t offset{};
+    std::size_t length{};
+
+    CheckStatus(DecodeView(offset, length));
+
+    read_position = offset + length;
+
+    return {reinterpret_cast<const char *>(buffer + offset), length};
+}
+
+/*
+ *  VarIntDataBuffer::TryReadBytesView()
+ *
+ *  Description:
+ *      This function will read an octet string preceded by its length as a
+ *      variable-width unsigned integer at the current read position without
+ *      throwing an exception.
+ *
+ *  Parameters:
+ *      value [out]
+ *          A span over the octets of the string within the buffer.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was read,
+ *      DataBufferStatus::BeyondDataLength if the string extends beyond the
+ *      data length, or DataBufferStatus::Malformed if the length is
+ *      malformed.  On failure, the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      The span is invalidated if the buffer is grown, compacted, or
+ *      replaced.
+ */
+DataBufferStatus VarIntDataBuffer::TryReadBytesView(
+    std::span<std::uint8_t> &value) noexcept
+{
+    std::size_t offset{};
+    std::size_t length{};
+
+    DataBufferStatus status = DecodeView(offset, length);
+    if (status != DataBufferStatus::Success) return status;
+
+    value = {buffer + offset, length};
+    read_position = offset + length;
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  VarIntDataBuffer::TryReadStringView()
+ *
+ *  Description:
+ *      This function will read a character string preceded by its length as
+ *      a variable-width unsigned integer at the current read position without
+ *      throwing an exception.
+ *
+ *  Parameters:
+ *      value [out]
+ *          A view of the characters of the string within the buffer.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was read,
+ *      DataBufferStatus::BeyondDataLength if the string extends beyond the
+ *      data length, or DataBufferStatus::Malformed if the length is
+ *      malformed.  On failure, the value parameter and read position are
+ *      unchanged.
+ *
+ *  Comments:
+ *      The view is invalidated if the buffer is grown, compacted, or
+ *      replaced.
+ */
+DataBufferStatus VarIntDataBuffer::TryReadStringView(
+    std::string_view &value) noexcept
+{
+    std::size_t offset{};
+    std::size_t length{};
+
+    DataBufferStatus status = DecodeView(offset, length);
+    if (status != DataBufferStatus::Success) return status;
+
+    value = {reinterpret_cast<const char *>(buffer + offset), length};
+    read_position = offset + length;
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  VarIntDataBuffer::DecodeView()
+ *
+ *  Description:
+ *      This function will decode the variable-width length of a string at
+ *      the current read position and ensure the string is within the data.
+ *
+ *  Parameters:
+ *      offset [out]
+ *          The offset of the string following its length.
+ *
+ *      length [out]
+ *          The length of the string.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the string is within the data,
+ *      DataBufferStatus::BeyondDataLength if the length or string extends
+ *      beyond the data length, or DataBufferStatus::Malformed if the length
+ *      is malformed.  On failure, the offset and length parameters are
+ *      unchanged.
+ *
+ *  Comments:
+ *      This is the common logic for the ReadBytesView(), ReadStringView(),
+ *      TryReadBytesView(), and TryReadStringView() functions.
+ */
+DataBufferStatus VarIntDataBuffer::DecodeView(
+    std::size_t &offset,
+    std::size_t &length) const noexcept
+{
+    VarUint64_t view_length;
+    std::size_t octets{};
+
+    DataBufferStatus status =
+        DecodeValue(view_length, read_position, data_length, octets);
+    if (status == DataBufferStatus::BeyondBuffer)
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+    if (status != DataBufferStatus::Success) return status;
+
+    if (!InBounds(read_position + octets, view_length, data_length))
+    {
+        return DataBufferStatus::BeyondDataLength;
+    }
+
+    offset = read_position + octets;
+    length = view_length;
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  VarIntDataBuffer::ReserveLength()
+ *
+ *  Description:
+ *      This function will append space for a variable-width length field
+ *      that is to be written by CompleteLength() once the data it covers has
+ *      been appended.
+ *
+ *  Parameters:
+ *      width [in]
+ *          The number of octets to reserve, which is the number of octets
+ *          required to encode the maximum length.
+ *
+ *  Returns:
+ *      The offset of the length field.  An exception will be thrown if there
+ *      is insufficient space in the buffer.
+ *
+ *  Comments:
+ *      This is the common logic for the BeginLength() functions.
+ */
+std::size_t VarIntDataBuffer::ReserveLength(std::size_t width)
+{
+    const std::size_t offset = data_length;
+
+    // Ensure there is space if the buffer is growable
+    EnsureAppendSpace(width);
+    if (!InBounds(data_length, width, buffer_size))
+    {
+        throw DataBufferException("Attempt to write beyond the buffer");
+    }
+
+    std::memset(buffer + offset, 0, width);
+    data_length += width;
+
+    return offset;
+}
+
+/*
+ *  VarIntDataBuffer::CompleteLength()
+ *
+ *  Description:
+ *      This function will write the length field reserved by ReserveLength()
+ *      at the given offset, moving the data that follows it if the length
+ *      requires fewer octets than were reserved.
+ *
+ *  Parameters:
+ *      offset [in]
+ *          The offset of the length field returned by BeginLength().
+ *
+ *      width [in]
+ *          The number of octets reserved for the length field.
+ *
+ *      maximum [in]
+ *          The maximum length the length field may hold.
+ *
+ *  Returns:
+ *      The length written into the length field.  An exception will be
+ *      thrown if the length field is not within the data or if the length
+ *      exceeds the maximum.
+ *
+ *  Comments:
+ *      This is the common logic for the EndLength() functions.  The data
+ *      length is reduced by the number of reserved octets not required.
+ */
+std::size_t VarIntDataBuffer::CompleteLength(std::size_t offset,
+                                             std::size_t width,
+                                             std::uint64_t maximum)
+{
+    if (!InBounds(offset, width, data_length))
+    {
+        throw DataBufferException("Length field is beyond the data length");
+    }
+
+    const std::size_t length = data_length - offset - width;
+
+    if (length > maximum)
+    {
+        throw DataBufferException("Length exceeds the length field maximum");
+    }
+
+    // Write the length and move the data to follow it, if necessary
+    const std::size_t octets = SetValue(VarUint64_t(length), offset);
+    if (octets < width)
+    {
+        std::memmove(buffer + offset + octets, buffer + offset + width, length);
+        data_length -= width - octets;
+    }
+
     return length;
 }
 
@@ -449,4 +914,157 @@ std::size_t VarIntDataBuffer::VarIntSize(const VarInt64_t &value)
     return (BitUtil::FindMSb(value) + 1) / 7 + 1;
 }
 
+/*
+ *  VarIntDataBuffer::DecodeValue()
+ *
+ *  Description:
+ *      This function will decode a variable-width unsigned integer from the
+ *      buffer at the given offset, reading no octets at or beyond the given
+ *      limit.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value decoded from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *      limit [in]
+ *          The offset beyond which no octets may be read (i.e., the buffer
+ *          size or the data length).
+ *
+ *      length [out]
+ *          The total number of octets the value consumed in the DataBuffer.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was decoded,
+ *      DataBufferStatus::BeyondBuffer if the value extends beyond the limit,
+ *      or DataBufferStatus::Malformed if the value is malformed.  On failure,
+ *      the value and length parameters are unchanged.
+ *
+ *  Comments:
+ *      This is the common logic for the GetValue(), ReadValue(),
+ *      TryGetValue(), and TryReadValue() functions.
+ */
+DataBufferStatus VarIntDataBuffer::DecodeValue(
+    VarUint64_t &value,
+    std::size_t offset,
+    std::size_t limit,
+    std::size_t &length) const noexcept
+{
+    std::uint8_t octet{0x80};
+    std::size_t total_octets{0};
+    VarUint64_t decoded_value{0};
+
+    // Read octets until we find the last one having a 0 MSb
+    while ((octet & 0x80) != 0)
+    {
+        // A 64-bits value should never require more than 10 octets
+        if (++total_octets == 11) return DataBufferStatus::Malformed;
+
+        // Ensure we do not read beyond the limit
+        if (!InBounds(offset, total_octets, limit))
+        {
+            return DataBufferStatus::BeyondBuffer;
+        }
+
+        // Get the target octet
+        octet = buffer[offset + total_octets - 1];
+
+        // Add these bits to the returned value
+        decoded_value = (decoded_value << 7) | (octet & 0x7f);
+    }
+
+    // If the total length is 10 octets, initial octet must be 0x81
+    if ((total_octets == 10) && (buffer[offset] != 0x81))
+    {
+        return DataBufferStatus::Malformed;
+    }
+
+    value = decoded_value;
+    length = total_octets;
+
+    return DataBufferStatus::Success;
+}
+
+/*
+ *  VarIntDataBuffer::DecodeValue()
+ *
+ *  Description:
+ *      This function will decode a variable-width signed integer from the
+ *      buffer at the given offset, reading no octets at or beyond the given
+ *      limit.
+ *
+ *  Parameters:
+ *      value [out]
+ *          The value decoded from the buffer.
+ *
+ *      offset [in]
+ *          The offset into the buffer from which the value will be read.
+ *
+ *      limit [in]
+ *          The offset beyond which no octets may be read (i.e., the buffer
+ *          size or the data length).
+ *
+ *      length [out]
+ *          The total number of octets the value consumed in the DataBuffer.
+ *
+ *  Returns:
+ *      DataBufferStatus::Success if the value was decoded,
+ *      DataBufferStatus::BeyondBuffer if the value extends beyond the limit,
+ *      or DataBufferStatus::Malformed if the value is malformed.  On failure,
+ *      the value and length parameters are unchanged.
+ *
+ *  Comments:
+ *      This is the common logic for the GetValue(), ReadValue(),
+ *      TryGetValue(), and TryReadValue() functions.
+ */
+DataBufferStatus VarIntDataBuffer::DecodeValue(
+    VarInt64_t &value,
+    std::size_t offset,
+    std::size_t limit,
+    std::size_t &length) const noexcept
+{
+    std::uint8_t octet{0x80};
+    std::size_t total_octets{0};
+
+    // Ensure there is at least one octet to read
+    if (!InBounds(offset, 1, limit)) return DataBufferStatus::BeyondBuffer;
+
+    // Determine the sign of the number by inspecting the leading sign bit
+    VarInt64_t decoded_value = ((buffer[offset] & 0x40) != 0) ? -1 : 0;
+
+    // Read octets until we find the last one having a 0 MSb
+    while ((octet & 0x80) != 0)
+    {
+        // A 64-bits value should never require more than 10 octets
+        if (++total_octets == 11) return DataBufferStatus::Malformed;
+
+        // Ensure we do not read beyond the limit
+        if (!InBounds(offset, total_octets, limit))
+        {
+            return DataBufferStatus::BeyondBuffer;
+        }
+
+        // Get the target octet
+        octet = buffer[offset + total_octets - 1];
+
+        // Add these bits to the returned value
+        decoded_value = (decoded_value << 7) | (octet & 0x7f);
+    }
+
+    // If the total length is 10 octets, ensure the initial octet is one
+    // of the only two valid values
+    if ((total_octets == 10) && (buffer[offset] != 0x80) &&
+        (buffer[offset] != 0xff))
+    {
+        return DataBufferStatus::Malformed;
+    }
+
+    value = decoded_value;
+    length = total_octets;
+
+    return DataBufferStatus::Success;
+}
+
 } // namespace Terra::NetUtil
@@ -0,0 +1,112 @@
+/*
+ *  test_aligned_memory_resource.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the AlignedMemoryResource object.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <terra/netutil/aligned_memory_resource.h>
+#include <terra/netutil/data_buffer.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+namespace
+{
+
+// Determine whether the given pointer has the given alignment
+bool IsAligned(const void *pointer, std::size_t alignment)
+{
+    return (reinterpret_cast<std::uintptr_t>(pointer) % alignment) == 0;
+}
+
+} // namespace
+
+STF_TEST(TestAlignedMemoryResource, Options)
+{
+    NetUtil::AlignedMemoryResource resource1;
+    NetUtil::AlignedMemoryResource resource2({.alignment = 100});
+    NetUtil::AlignedMemoryResource resource3({.alignment = 1});
+
+    STF_ASSERT_EQ(64, resource1.GetOptions().alignment);
+    STF_ASSERT_FALSE(resource1.GetOptions().huge_pages);
+    STF_ASSERT_FALSE(resource1.GetOptions().prefault);
+
+    // The alignment is rounded up to a suitable power of two
+    STF_ASSERT_EQ(128, resource2.GetOptions().alignment);
+    STF_ASSERT_EQ(alignof(std::max_align_t), resource3.GetOptions().alignment);
+
+    STF_ASSERT_TRUE(resource1 == resource1);
+    STF_ASSERT_FALSE(resource1 == resource2);
+}
+
+STF_TEST(TestAlignedMemoryResource, Alignment)
+{
+    for (std::size_t alignment : {64, 4096})
+    {
+        NetUtil::AlignedMemoryResource resource({.alignment = alignment});
+
+        for (std::size_t size : {1, 63, 64, 1000, 65536})
+        {
+            void *memory = resource.allocate(size);
+            STF_ASSERT_TRUE(IsAligned(memory, alignment));
+            resource.deallocate(memory, size);
+        }
+    }
+}
+
+STF_TEST(TestAlignedMemoryResource, GrowableDataBuffer)
+{
+    NetUtil::AlignedMemoryResource resource({.alignment = 4096,
+                                             .prefault = true});
+    NetUtil::DataBuffer data_buffer(16, &resource, true);
+
+    STF_ASSERT_TRUE(IsAligned(data_buffer.GetBufferPointer(), 4096));
+
+    for (std::uint32_t i = 0; i < 10000; i++) data_buffer << i;
+
+    STF_ASSERT_EQ(40000, data_buffer.GetDataLength());
+    STF_ASSERT_TRUE(IsAligned(data_buffer.GetBufferPointer(), 4096));
+
+    // Copies allocate from the same memory resource
+    NetUtil::DataBuffer copy = data_buffer;
+    STF_ASSERT_TRUE(IsAligned(copy.GetBufferPointer(), 4096));
+    STF_ASSERT_TRUE(copy == data_buffer);
+}
+
+STF_TEST(TestAlignedMemoryResource, HugePages)
+{
+    NetUtil::AlignedMemoryResource resource({.huge_pages = true,
+                                             .huge_page_threshold = 1048576,
+                                             .prefault = true});
+    constexpr std::size_t Size = 3 * 1048576;
+    NetUtil::DataBuffer data_buffer(Size, &resource);
+
+    // Small allocations are not affected
+    NetUtil::DataBuffer small_buffer(1024, &resource);
+    STF_ASSERT_TRUE(IsAligned(small_buffer.GetBufferPointer(), 64));
+
+#ifdef __linux__
+    STF_ASSERT_TRUE(IsAligned(data_buffer.GetBufferPointer(), 2097152));
+#endif
+
+    for (std::size_t i = 0; i < Size; i++)
+    {
+        data_buffer.AppendValue(static_cast<std::uint8_t>(i));
+    }
+
+    STF_ASSERT_EQ(Size, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(0xff, data_buffer[Size - 1]);
+}
@@ -0,0 +1,271 @@
+/*
+ *  test_base64.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the base64 encoding and decoding
+ *      functions.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <terra/netutil/base64.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+namespace
+{
+
+// Produce test data containing every octet value
+std::vector<std::uint8_t> TestData(std::size_t length)
+{
+    std::vector<std::uint8_t> data(length);
+
+    for (std::size_t i = 0; i < length; i++)
+    {
+        data[i] = static_cast<std::uint8_t>((i * 37) + 5);
+    }
+
+    return data;
+}
+
+// Straightforward encoder against which results are compared
+std::string ReferenceEncode(const std::vector<std::uint8_t> &data,
+                            std::string_view alphabet,
+                            bool padding)
+{
+    std::string text;
+
+    for (std::size_t i = 0; i < data.size(); i += 3)
+    {
+        std::size_t count = std::min<std::size_t>(3, data.size() - i);
+        std::uint32_t value = 0;
+
+        for (std::size_t j = 0; j < 3; j++)
+        {
+            value = (value << 8) | ((j < count) ? data[i + j] : 0);
+        }
+
+        for (std::size_t j = 0; j < 4; j++)
+        {
+            if (j <= count)
+            {
+                text.push_back(alphabet[(value >> (18 - (j * 6))) & 0x3f]);
+            }
+            else if (padding)
+            {
+                text.push_back('=');
+            }
+        }
+    }
+
+    return text;
+}
+
+} // namespace
+
+STF_TEST(Base64, RFC4648Vectors)
+{
+    const std::array<std::pair<std::string, std::string>, 7> vectors =
+    {{
+        {"", ""},
+        {"f", "Zg=="},
+        {"fo", "Zm8="},
+        {"foo", "Zm9v"},
+        {"foob", "Zm9vYg=="},
+        {"fooba", "Zm9vYmE="},
+        {"foobar", "Zm9vYmFy"}
+    }};
+
+    for (const auto &[plain, encoded] : vectors)
+    {
+        std::vector<std::uint8_t> data(plain.begin(), plain.end());
+        NetUtil::DataBuffer data_buffer(data.data(), data.size(), data.size());
+
+        STF_ASSERT_EQ(encoded, NetUtil::Base64Encode(data_buffer));
+
+        NetUtil::DataBuffer decoded = NetUtil::Base64Decode(encoded);
+        STF_ASSERT_EQ(plain.size(), decoded.GetDataLength());
+        STF_ASSERT_EQ(plain,
+                      std::string(decoded.GetBufferSpan().begin(),
+                                  decoded.GetBufferSpan().end()));
+
+        // Unpadded text decodes the same
+        std::string unpadded = encoded.substr(0, encoded.find('='));
+        STF_ASSERT_TRUE(decoded == NetUtil::Base64Decode(unpadded));
+        STF_ASSERT_EQ(unpadded,
+                      NetUtil::Base64Encode(data_buffer,
+                                            NetUtil::Base64Alphabet::Standard,
+                                            false));
+    }
+}
+
+STF_TEST(Base64, URLAlphabet)
+{
+    std::array<std::uint8_t, 3> data{0xfb, 0xff, 0xbf};
+    std::array<char, 4> text{};
+
+    STF_ASSERT_EQ(4, NetUtil::Base64Encode(data, text));
+    STF_ASSERT_EQ(std::string("+/+/"), std::string(text.data(), text.size()));
+
+    STF_ASSERT_EQ(4,
+                  NetUtil::Base64Encode(data,
+                                        text,
+                                        NetUtil::Base64Alphabet::URL));
+    STF_ASSERT_EQ(std::string("-_-_"), std::string(text.data(), text.size()));
+
+    NetUtil::DataBuffer data_buffer =
+        NetUtil::Base64Decode("-_-_", NetUtil::Base64Alphabet::URL);
+    STF_ASSERT_EQ(3, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(0xfb, data_buffer[0]);
+    STF_ASSERT_EQ(0xff, data_buffer[1]);
+    STF_ASSERT_EQ(0xbf, data_buffer[2]);
+
+    // Characters of the other alphabet are rejected
+    auto test_standard = [&] { NetUtil::Base64Decode("-_-_"); };
+    auto test_url = [&]
+    {
+        NetUtil::Base64Decode("+/+/", NetUtil::Base64Alphabet::URL);
+    };
+    STF_ASSERT_EXCEPTION_E(test_standard, NetUtil::DataBufferException);
+    STF_ASSERT_EXCEPTION_E(test_url, NetUtil::DataBufferException);
+}
+
+STF_TEST(Base64, RoundTrip)
+{
+    std::vector<std::uint8_t> all = TestData(300);
+
+    // Use various lengths so that both vector and scalar coding are used
+    for (std::size_t length = 0; length <= all.size(); length++)
+    {
+        std::vector<std::uint8_t> data(all.begin(), all.begin() + length);
+
+        for (auto alphabet : {NetUtil::Base64Alphabet::Standard,
+                              NetUtil::Base64Alphabet::URL})
+        {
+            const std::string_view characters =
+                (alphabet == NetUtil::Base64Alphabet::Standard) ?
+                    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                    "0123456789+/" :
+                    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                    "0123456789-_";
+
+            for (bool padding : {true, false})
+            {
+                std::string expected =
+                    ReferenceEncode(data, characters, padding);
+                std::vector<char> text(
+                    NetUtil::Base64EncodedLength(length, padding));
+
+                STF_ASSERT_EQ(expected.size(), text.size());
+                STF_ASSERT_EQ(
+                    text.size(),
+                    NetUtil::Base64Encode(data, text, alphabet, padding));
+                STF_ASSERT_EQ(expected, std::string(text.begin(), text.end()));
+
+                NetUtil::DataBuffer data_buffer =
+                    NetUtil::Base64Decode(expected, alphabet);
+                STF_ASSERT_EQ(length, data_buffer.GetDataLength());
+                for (std::size_t i = 0; i < length; i++)
+                {
+                    STF_ASSERT_EQ(data[i], data_buffer[i]);
+                }
+            }
+        }
+    }
+}
+
+STF_TEST(Base64, EncodeUnreadData)
+{
+    std::vector<std::uint8_t> data = TestData(10);
+    NetUtil::DataBuffer data_buffer(data.data(), data.size(), data.size());
+    std::string expected(NetUtil::Base64EncodedLength(6), '\0');
+
+    // Only the unread portion of the buffer is encoded
+    data_buffer.AdvanceReadPosition(4);
+    NetUtil::Base64Encode(std::span(data).subspan(4), expected);
+
+    STF_ASSERT_EQ(expected, NetUtil::Base64Encode(data_buffer));
+    STF_ASSERT_EQ(4, data_buffer.GetReadPosition());
+
+    // An output buffer that is too small results in an exception
+    std::array<char, 7> text{};
+    auto test_func = [&] { NetUtil::Base64Encode(data, text); };
+    STF_ASSERT_EXCEPTION_E(test_func, NetUtil::DataBufferException);
+}
+
+STF_TEST(Base64, InvalidCharacters)
+{
+    std::vector<std::uint8_t> data = TestData(96);
+    std::string text(NetUtil::Base64EncodedLength(data.size()), '\0');
+
+    NetUtil::Base64Encode(data, text);
+
+    // Invalid characters are detected in both vector and scalar decoding
+    for (std::size_t i = 0; i < text.size(); i++)
+    {
+        for (char c : {'=', '-', '_', '.', '@', '[', '`', '{', ' ', '\n',
+                       '\x80', '\xff'})
+        {
+            std::string bad = text;
+            bad[i] = c;
+
+            // Padding is valid as the final character
+            if ((c == '=') && (i == (text.size() - 1))) continue;
+
+            auto test_func = [&] { NetUtil::Base64Decode(bad); };
+            STF_ASSERT_EXCEPTION_E(test_func, NetUtil::DataBufferException);
+        }
+    }
+}
+
+STF_TEST(Base64, InvalidLength)
+{
+    for (std::string_view text : {"A", "Zm9vY", "Zg=", "Zm9=v", "Zm9v=",
+                                  "Zm9v====", "=", "=="})
+    {
+        auto test_func = [&] { NetUtil::Base64Decode(text); };
+        STF_ASSERT_EXCEPTION_E(test_func, NetUtil::DataBufferException);
+    }
+}
+
+STF_TEST(Base64, AppendToDataBuffer)
+{
+    NetUtil::DataBuffer data_buffer(4, true);
+
+    data_buffer.AppendValue(std::uint8_t(0x01));
+
+    // The decoded octets follow the existing data, growing the buffer
+    STF_ASSERT_EQ(6, NetUtil::Base64Decode("Zm9vYmFy", data_buffer));
+    STF_ASSERT_EQ(7, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(0x01, data_buffer[0]);
+    STF_ASSERT_EQ('f', data_buffer[1]);
+    STF_ASSERT_EQ('r', data_buffer[6]);
+
+    // A buffer that cannot grow must have sufficient free space
+    std::array<std::uint8_t, 8> storage{};
+    NetUtil::DataBuffer fixed_buffer(storage.data(), storage.size());
+
+    STF_ASSERT_EQ(6, NetUtil::Base64Decode("Zm9vYmFy", fixed_buffer));
+    auto test_func = [&] { NetUtil::Base64Decode("Zm9v", fixed_buffer); };
+    STF_ASSERT_EXCEPTION_E(test_func, NetUtil::DataBufferException);
+    STF_ASSERT_EQ(6, fixed_buffer.GetDataLength());
+
+    // Invalid text does not change the data length
+    auto test_invalid = [&] { NetUtil::Base64Decode("Z.", fixed_buffer); };
+    STF_ASSERT_EXCEPTION_E(test_invalid, NetUtil::DataBufferException);
+    STF_ASSERT_EQ(6, fixed_buffer.GetDataLength());
+}
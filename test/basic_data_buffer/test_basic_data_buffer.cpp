@@ -0,0 +1,182 @@
+/*
+ *  test_basic_data_buffer.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the BasicDataBuffer object.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <terra/netutil/basic_data_buffer.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+STF_TEST(TestBasicDataBuffer, LittleEndian)
+{
+    NetUtil::LittleEndianDataBuffer data_buffer(32);
+
+    data_buffer << std::uint8_t(0x01) << std::uint16_t(0x0203)
+                << std::uint32_t(0x04050607) << std::int64_t(-2)
+                << float(1.0);
+
+    STF_ASSERT_EQ(19, data_buffer.GetDataLength());
+
+    const std::array<std::uint8_t, 19> expected =
+    {
+        0x01,
+        0x03, 0x02,
+        0x07, 0x06, 0x05, 0x04,
+        0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x00, 0x00, 0x80, 0x3f
+    };
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        STF_ASSERT_EQ(expected[i], data_buffer[i]);
+    }
+
+    std::uint8_t u8{};
+    std::uint16_t u16{};
+    std::uint32_t u32{};
+    std::int64_t i64{};
+    float f{};
+
+    data_buffer >> u8 >> u16 >> u32 >> i64 >> f;
+
+    STF_ASSERT_EQ(0x01, u8);
+    STF_ASSERT_EQ(0x0203, u16);
+    STF_ASSERT_EQ(0x04050607, u32);
+    STF_ASSERT_EQ(-2, i64);
+    STF_ASSERT_EQ(1.0, f);
+    STF_ASSERT_EQ(0, data_buffer.GetUnreadLength());
+}
+
+STF_TEST(TestBasicDataBuffer, BigEndianMatchesDataBuffer)
+{
+    NetUtil::BasicDataBuffer<NetUtil::ByteOrder::Big> data_buffer1(16);
+    NetUtil::DataBuffer data_buffer2(16);
+
+    data_buffer1 << std::uint16_t(0x0102) << double(-2.75);
+    data_buffer2 << std::uint16_t(0x0102) << double(-2.75);
+
+    STF_ASSERT_TRUE(data_buffer1.GetDataBuffer() == data_buffer2);
+}
+
+STF_TEST(TestBasicDataBuffer, ByteOrderOverride)
+{
+    NetUtil::LittleEndianDataBuffer data_buffer(8);
+    std::uint16_t value{};
+
+    data_buffer.AppendValue(std::uint16_t(0x0102));
+    data_buffer.AppendValue<NetUtil::ByteOrder::Big>(std::uint16_t(0x0304));
+    data_buffer.SetValue<NetUtil::ByteOrder::Network>(std::uint16_t(0x0506),
+                                                      4);
+
+    STF_ASSERT_EQ(0x02, data_buffer[0]);
+    STF_ASSERT_EQ(0x01, data_buffer[1]);
+    STF_ASSERT_EQ(0x03, data_buffer[2]);
+    STF_ASSERT_EQ(0x04, data_buffer[3]);
+    STF_ASSERT_EQ(0x05, data_buffer[4]);
+    STF_ASSERT_EQ(0x06, data_buffer[5]);
+
+    data_buffer.GetValue<NetUtil::ByteOrder::Big>(value, 0);
+    STF_ASSERT_EQ(0x0201, value);
+    data_buffer.GetValue(value, 4);
+    STF_ASSERT_EQ(0x0605, value);
+}
+
+STF_TEST(TestBasicDataBuffer, PeekAndReadSpan)
+{
+    NetUtil::LittleEndianDataBuffer data_buffer(8);
+    std::uint16_t value{};
+
+    data_buffer.AppendValue(std::uint16_t(0x0102));
+
+    // Values are peeked in the buffer's byte order unless overridden
+    data_buffer.PeekValue(value);
+    STF_ASSERT_EQ(0x0102, value);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryPeekValue<NetUtil::ByteOrder::Big>(value));
+    STF_ASSERT_EQ(0x0201, value);
+    STF_ASSERT_EQ(2, data_buffer.PeekSpan(2).size());
+    STF_ASSERT_EQ(0, data_buffer.GetReadPosition());
+
+    STF_ASSERT_EQ(0x02, data_buffer.ReadSpan(2)[0]);
+    STF_ASSERT_EQ(2, data_buffer.GetReadPosition());
+}
+
+STF_TEST(TestBasicDataBuffer, LengthFields)
+{
+    NetUtil::LittleEndianDataBuffer data_buffer(8);
+
+    // Length fields are in the buffer's byte order unless overridden
+    std::size_t little = data_buffer.BeginLength<std::uint16_t>();
+    std::size_t big =
+        data_buffer.BeginLength<std::uint16_t, NetUtil::ByteOrder::Big>();
+    data_buffer.AppendValue(std::uint8_t(0xff));
+    STF_ASSERT_EQ(1,
+                  (data_buffer.EndLength<std::uint16_t,
+                                         NetUtil::ByteOrder::Big>(big)));
+    STF_ASSERT_EQ(3, data_buffer.EndLength<std::uint16_t>(little));
+
+    STF_ASSERT_EQ(0x03, data_buffer[0]);
+    STF_ASSERT_EQ(0x00, data_buffer[1]);
+    STF_ASSERT_EQ(0x00, data_buffer[2]);
+    STF_ASSERT_EQ(0x01, data_buffer[3]);
+}
+
+STF_TEST(TestBasicDataBuffer, OctetsAndTry)
+{
+    NetUtil::LittleEndianDataBuffer data_buffer(6);
+    std::array<char, 2> text{};
+    std::uint32_t value{};
+
+    data_buffer.AppendValue(std::span<const char>("Hi", 2));
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryAppendValue(std::uint32_t(0x01020304)));
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondBuffer,
+                  data_buffer.TryAppendValue(std::uint8_t(0)));
+    STF_ASSERT_EQ(0x04, data_buffer[2]);
+
+    data_buffer.ReadValue(std::span<char>(text));
+    STF_ASSERT_EQ('H', text[0]);
+    STF_ASSERT_EQ('i', text[1]);
+
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryReadValue(value));
+    STF_ASSERT_EQ(0x01020304, value);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondDataLength,
+                  data_buffer.TryReadValue(value));
+}
+
+STF_TEST(TestBasicDataBuffer, ReadBeyondDataLength)
+{
+    NetUtil::LittleEndianDataBuffer data_buffer(8);
+    std::uint32_t value{};
+    bool exception_caught = false;
+
+    data_buffer << std::uint16_t(1);
+
+    try
+    {
+        data_buffer >> value;
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+    STF_ASSERT_EQ(0, data_buffer.GetReadPosition());
+}
@@ -0,0 +1,209 @@
+/*
+ *  test_buffer_pool.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the BufferPool object.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <terra/netutil/buffer_pool.h>
+#include <terra/netutil/data_buffer.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+STF_TEST(TestBufferPool, BlockSize)
+{
+    NetUtil::BufferPool pool(64, 4096);
+
+    STF_ASSERT_EQ(0, pool.GetBlockSize(0));
+    STF_ASSERT_EQ(64, pool.GetBlockSize(1));
+    STF_ASSERT_EQ(64, pool.GetBlockSize(64));
+    STF_ASSERT_EQ(128, pool.GetBlockSize(65));
+    STF_ASSERT_EQ(1024, pool.GetBlockSize(1000));
+    STF_ASSERT_EQ(4096, pool.GetBlockSize(4096));
+    STF_ASSERT_EQ(4097, pool.GetBlockSize(4097));
+
+    auto statistics = pool.GetStatistics();
+    STF_ASSERT_EQ(7, statistics.size_classes.size());
+    STF_ASSERT_EQ(64, statistics.size_classes.front().block_size);
+    STF_ASSERT_EQ(4096, statistics.size_classes.back().block_size);
+}
+
+STF_TEST(TestBufferPool, InvalidSizes)
+{
+    bool exception_caught = false;
+
+    try
+    {
+        NetUtil::BufferPool pool(128, 64);
+    }
+    catch (const std::invalid_argument &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+}
+
+STF_TEST(TestBufferPool, HitsAndMisses)
+{
+    NetUtil::BufferPool pool(64, 4096);
+
+    std::uint8_t *block1 = pool.Allocate(100);
+    STF_ASSERT_NE(nullptr, block1);
+
+    auto statistics = pool.GetStatistics();
+    STF_ASSERT_EQ(0, statistics.hits);
+    STF_ASSERT_EQ(1, statistics.misses);
+    STF_ASSERT_EQ(128, statistics.bytes_outstanding);
+    STF_ASSERT_EQ(1, statistics.size_classes[1].blocks_outstanding);
+
+    pool.Release(block1, 100);
+
+    statistics = pool.GetStatistics();
+    STF_ASSERT_EQ(0, statistics.bytes_outstanding);
+    STF_ASSERT_EQ(0, statistics.size_classes[1].blocks_outstanding);
+
+    // The same block should be reused for a request in the same class
+    std::uint8_t *block2 = pool.Allocate(128);
+    STF_ASSERT_EQ(block1, block2);
+
+    statistics = pool.GetStatistics();
+    STF_ASSERT_EQ(1, statistics.hits);
+    STF_ASSERT_EQ(1, statistics.misses);
+    STF_ASSERT_EQ(1, statistics.size_classes[1].hits);
+
+    pool.Release(block2, 128);
+}
+
+STF_TEST(TestBufferPool, Oversize)
+{
+    NetUtil::BufferPool pool(64, 4096);
+
+    std::uint8_t *block = pool.Allocate(10000);
+    STF_ASSERT_NE(nullptr, block);
+
+    auto statistics = pool.GetStatistics();
+    STF_ASSERT_EQ(1, statistics.misses);
+    STF_ASSERT_EQ(10000, statistics.bytes_outstanding);
+
+    pool.Release(block, 10000);
+
+    statistics = pool.GetStatistics();
+    STF_ASSERT_EQ(0, statistics.bytes_outstanding);
+}
+
+STF_TEST(TestBufferPool, ThreadCacheOverflow)
+{
+    NetUtil::BufferPool pool(64, 4096, 4);
+    std::vector<std::uint8_t *> blocks;
+
+    for (std::size_t i = 0; i < 20; i++) blocks.push_back(pool.Allocate(64));
+    for (auto block : blocks) pool.Release(block, 64);
+    blocks.clear();
+
+    // All blocks should be reused, whether from the thread cache or the
+    // shared free list
+    for (std::size_t i = 0; i < 20; i++) blocks.push_back(pool.Allocate(64));
+    for (auto block : blocks) pool.Release(block, 64);
+
+    auto statistics = pool.GetStatistics();
+    STF_ASSERT_EQ(20, statistics.hits);
+    STF_ASSERT_EQ(20, statistics.misses);
+    STF_ASSERT_EQ(0, statistics.bytes_outstanding);
+}
+
+STF_TEST(TestBufferPool, MultipleThreads)
+{
+    NetUtil::BufferPool pool(64, 4096, 8);
+    std::vector<std::thread> threads;
+
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        threads.emplace_back(
+            [&pool]()
+            {
+                for (std::size_t j = 0; j < 1000; j++)
+                {
+                    std::uint8_t *block = pool.Allocate(64 + (j % 512));
+                    block[0] = static_cast<std::uint8_t>(j);
+                    pool.Release(block, 64 + (j % 512));
+                }
+            });
+    }
+
+    for (auto &thread : threads) thread.join();
+
+    auto statistics = pool.GetStatistics();
+    STF_ASSERT_EQ(4000, statistics.hits + statistics.misses);
+    STF_ASSERT_EQ(0, statistics.bytes_outstanding);
+
+    // Blocks cached by exited threads were returned and may be reused
+    std::uint8_t *block = pool.Allocate(64);
+    STF_ASSERT_GT(pool.GetStatistics().hits, statistics.hits);
+    pool.Release(block, 64);
+}
+
+STF_TEST(TestBufferPool, DataBuffer)
+{
+    NetUtil::BufferPool pool(64, 4096);
+
+    {
+        NetUtil::DataBuffer data_buffer(100, pool);
+
+        STF_ASSERT_EQ(&pool, data_buffer.GetBufferPool());
+        STF_ASSERT_EQ(100, data_buffer.GetBufferSize());
+        STF_ASSERT_EQ(128, pool.GetStatistics().bytes_outstanding);
+
+        data_buffer << std::uint32_t(0xcafebabe);
+
+        // A copy borrows memory from the same pool
+        NetUtil::DataBuffer data_buffer2(data_buffer);
+        STF_ASSERT_EQ(&pool, data_buffer2.GetBufferPool());
+        STF_ASSERT_EQ(256, pool.GetStatistics().bytes_outstanding);
+        STF_ASSERT_TRUE(data_buffer == data_buffer2);
+
+        // Moving retains the association with the pool
+        NetUtil::DataBuffer data_buffer3;
+        data_buffer3 = std::move(data_buffer2);
+        STF_ASSERT_EQ(&pool, data_buffer3.GetBufferPool());
+        STF_ASSERT_EQ(256, pool.GetStatistics().bytes_outstanding);
+    }
+
+    // All memory should be returned to the pool
+    STF_ASSERT_EQ(0, pool.GetStatistics().bytes_outstanding);
+}
+
+STF_TEST(TestBufferPool, GrowableDataBuffer)
+{
+    NetUtil::BufferPool pool(64, 4096);
+
+    {
+        NetUtil::DataBuffer data_buffer(64, pool, true);
+
+        for (std::uint32_t i = 0; i < 64; i++) data_buffer << i;
+
+        STF_ASSERT_EQ(256, data_buffer.GetDataLength());
+        STF_ASSERT_EQ(256, pool.GetStatistics().bytes_outstanding);
+
+        data_buffer.SetReadPosition(252);
+        std::uint32_t value;
+        data_buffer >> value;
+        STF_ASSERT_EQ(63, value);
+    }
+
+    STF_ASSERT_EQ(0, pool.GetStatistics().bytes_outstanding);
+}
@@ -15,10 +15,15 @@
  *      None.
  */
 
+#include <array>
+#include <bit>
 #include <span>
 #include <cstdint>
 #include <sstream>
 #include <limits>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
 #include <terra/netutil/data_buffer.h>
 #include <terra/stf/stf.h>
 
@@ -29,6 +34,58 @@ std::size_t SpanReceiver(std::span<const std::uint8_t> buffer)
     return buffer.size();
 }
 
+// Produce an array of values not a multiple of any vector length
+template<typename T>
+std::vector<T> MakeValues()
+{
+    std::vector<T> values(1003);
+
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            values[i] = static_cast<T>(i) + static_cast<T>(0.25);
+        }
+        else
+        {
+            values[i] = static_cast<T>(0x0123456789abcdefULL * (i + 1));
+        }
+    }
+
+    return values;
+}
+
+// Verify arrays are serialized as individual values are and read back
+template<typename T>
+bool VerifyArrayValues()
+{
+    std::vector<T> values = MakeValues<T>();
+    std::vector<T> values_read(values.size());
+    NetUtil::DataBuffer db1(values.size() * sizeof(T) + 3);
+    NetUtil::DataBuffer db2(values.size() * sizeof(T) + 3);
+
+    // Serialize at an odd offset to exercise unaligned access
+    db1.AppendValue(std::uint8_t(0));
+    db2.AppendValue(std::uint8_t(0));
+    db1.AppendValues(std::span<const T>(values));
+    for (T value : values) db2.AppendValue(value);
+    if (!(db1 == db2)) return false;
+
+    // Read the values back
+    std::uint8_t octet;
+    db1 >> octet;
+    db1.ReadValues(std::span<T>(values_read));
+    if (values != values_read) return false;
+    if (db1.GetUnreadLength() != 0) return false;
+
+    // Repeat using SetValues() and GetValues() at another odd offset
+    std::fill(values_read.begin(), values_read.end(), T{});
+    db1.SetValues(std::span<const T>(values), 3);
+    db1.GetValues(std::span<T>(values_read), 3);
+
+    return values == values_read;
+}
+
 STF_TEST(TestDataBuffer, Constructor1)
 {
     NetUtil::DataBuffer data_buffer;
@@ -172,6 +229,94 @@ STF_TEST(TestDataBuffer, MoveAssignmentOperator)
     STF_ASSERT_EQ(value, value_read);
 }
 
+STF_TEST(TestDataBuffer, CopyModeData)
+{
+    NetUtil::DataBuffer db1(64);
+
+    // Write a value and an octet beyond the data length
+    db1 << std::uint32_t(0xcafebabe);
+    db1[32] = 0x55;
+
+    // A copy has the same buffer size, but only the data is copied
+    NetUtil::DataBuffer db2(db1);
+    STF_ASSERT_EQ(64, db2.GetBufferSize());
+    STF_ASSERT_EQ(4, db2.GetDataLength());
+    STF_ASSERT_TRUE(db1 == db2);
+
+    // Copying the entire buffer includes the octet beyond the data length
+    NetUtil::DataBuffer db3(db1, NetUtil::DataBufferCopyMode::Buffer);
+    STF_ASSERT_EQ(64, db3.GetBufferSize());
+    STF_ASSERT_EQ(4, db3.GetDataLength());
+    STF_ASSERT_EQ(0x55, db3[32]);
+
+    NetUtil::DataBuffer db4(128);
+    db4.Assign(db1, NetUtil::DataBufferCopyMode::Buffer);
+    STF_ASSERT_EQ(64, db4.GetBufferSize());
+    STF_ASSERT_EQ(0x55, db4[32]);
+}
+
+STF_TEST(TestDataBuffer, CopyModeUnread)
+{
+    NetUtil::DataBuffer db1(64);
+    std::uint16_t value16;
+    std::uint32_t value32;
+
+    db1 << std::uint16_t(0x0102) << std::uint32_t(0x03040506);
+    db1 >> value16;
+
+    NetUtil::DataBuffer db2(db1, NetUtil::DataBufferCopyMode::Unread);
+    STF_ASSERT_EQ(64, db2.GetBufferSize());
+    STF_ASSERT_EQ(4, db2.GetDataLength());
+    STF_ASSERT_EQ(0, db2.GetReadPosition());
+
+    db2 >> value32;
+    STF_ASSERT_EQ(0x03040506, value32);
+
+    // Assigning into an existing buffer shrunk to fit
+    NetUtil::DataBuffer db3(16);
+    db3.Assign(db1, NetUtil::DataBufferCopyMode::Unread, true);
+    STF_ASSERT_EQ(4, db3.GetBufferSize());
+    STF_ASSERT_EQ(4, db3.GetDataLength());
+    db3 >> value32;
+    STF_ASSERT_EQ(0x03040506, value32);
+}
+
+STF_TEST(TestDataBuffer, Clone)
+{
+    NetUtil::DataBuffer db1(65536, true);
+    std::uint8_t value;
+
+    db1 << std::uint32_t(0xcafebabe);
+    db1 >> value;
+
+    // Clone only the data, shrinking the buffer
+    NetUtil::DataBuffer db2 = db1.Clone();
+    STF_ASSERT_EQ(4, db2.GetBufferSize());
+    STF_ASSERT_EQ(4, db2.GetDataLength());
+    STF_ASSERT_EQ(1, db2.GetReadPosition());
+    STF_ASSERT_TRUE(db2.IsGrowable());
+    STF_ASSERT_TRUE(db1 == db2);
+
+    // Clone without shrinking
+    NetUtil::DataBuffer db3 = db1.Clone(false);
+    STF_ASSERT_EQ(65536, db3.GetBufferSize());
+    STF_ASSERT_EQ(4, db3.GetDataLength());
+
+    // Clone only the unread data
+    NetUtil::DataBuffer db4 =
+        db1.Clone(true, NetUtil::DataBufferCopyMode::Unread);
+    STF_ASSERT_EQ(3, db4.GetBufferSize());
+    STF_ASSERT_EQ(3, db4.GetDataLength());
+    STF_ASSERT_EQ(0, db4.GetReadPosition());
+    STF_ASSERT_EQ(0xfe, db4[0]);
+
+    // Cloning an empty buffer while shrinking produces no buffer
+    NetUtil::DataBuffer db5(64);
+    NetUtil::DataBuffer db6 = db5.Clone();
+    STF_ASSERT_EQ(0, db6.GetBufferSize());
+    STF_ASSERT_EQ(nullptr, db6.GetBufferPointer());
+}
+
 STF_TEST(TestDataBuffer, SetBuffer1)
 {
     std::uint8_t buffer[64];
@@ -2035,3 +2180,657 @@ STF_TEST(TestDataBufer, ChainedStream)
     data_buffer >> hello_string_read >> cafe_babe_read;
 
 }
+
+STF_TEST(TestDataBuffer, GrowableAppend)
+{
+    NetUtil::DataBuffer data_buffer(4, true);
+
+    STF_ASSERT_TRUE(data_buffer.IsGrowable());
+    STF_ASSERT_EQ(4, data_buffer.GetBufferSize());
+
+    // Append more data than the initial buffer will hold
+    for (std::uint32_t i = 0; i < 100; i++) data_buffer << i;
+
+    STF_ASSERT_EQ(400, data_buffer.GetDataLength());
+    STF_ASSERT_GE(data_buffer.GetBufferSize(), 400);
+
+    // Ensure the contents were preserved as the buffer grew
+    for (std::uint32_t i = 0; i < 100; i++)
+    {
+        std::uint32_t value;
+        data_buffer >> value;
+        STF_ASSERT_EQ(i, value);
+    }
+}
+
+STF_TEST(TestDataBuffer, GrowableNoBuffer)
+{
+    NetUtil::DataBuffer data_buffer;
+
+    data_buffer.SetGrowable(true);
+    data_buffer << std::uint16_t(0x1234);
+
+    STF_ASSERT_EQ(2, data_buffer.GetDataLength());
+    STF_ASSERT_GE(data_buffer.GetBufferSize(), 2);
+    STF_ASSERT_EQ(0x12, data_buffer[0]);
+    STF_ASSERT_EQ(0x34, data_buffer[1]);
+}
+
+STF_TEST(TestDataBuffer, GrowableNotOwned)
+{
+    std::uint8_t buffer[4];
+    NetUtil::DataBuffer data_buffer(buffer, sizeof(buffer));
+    bool exception_caught = false;
+
+    data_buffer.SetGrowable(true);
+    data_buffer << std::uint32_t(0xcafebabe);
+
+    // A buffer that is not owned must not grow
+    try
+    {
+        data_buffer << std::uint8_t(0);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+    STF_ASSERT_EQ(buffer, data_buffer.GetBufferPointer());
+    STF_ASSERT_EQ(4, data_buffer.GetBufferSize());
+}
+
+STF_TEST(TestDataBuffer, NotGrowable)
+{
+    NetUtil::DataBuffer data_buffer(4);
+    bool exception_caught = false;
+
+    STF_ASSERT_FALSE(data_buffer.IsGrowable());
+
+    data_buffer << std::uint32_t(0xcafebabe);
+
+    try
+    {
+        data_buffer << std::uint8_t(0);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+    STF_ASSERT_EQ(4, data_buffer.GetBufferSize());
+}
+
+STF_TEST(TestDataBuffer, Reserve)
+{
+    NetUtil::DataBuffer data_buffer(8);
+
+    data_buffer << std::uint32_t(0xcafebabe);
+    data_buffer.SetReadPosition(2);
+
+    // Reserving less than the current size does nothing
+    data_buffer.Reserve(4);
+    STF_ASSERT_EQ(8, data_buffer.GetBufferSize());
+
+    data_buffer.Reserve(1024);
+    STF_ASSERT_EQ(1024, data_buffer.GetBufferSize());
+    STF_ASSERT_EQ(4, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(2, data_buffer.GetReadPosition());
+
+    std::uint16_t value;
+    data_buffer >> value;
+    STF_ASSERT_EQ(0xbabe, value);
+
+    // Reserving space in a buffer that is not owned is an error
+    std::uint8_t buffer[4];
+    NetUtil::DataBuffer data_buffer2(buffer, sizeof(buffer));
+    bool exception_caught = false;
+
+    try
+    {
+        data_buffer2.Reserve(16);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+}
+
+STF_TEST(TestDataBuffer, Resize)
+{
+    NetUtil::DataBuffer data_buffer(8);
+
+    data_buffer << std::uint32_t(0xcafebabe) << std::uint32_t(0xdeadbeef);
+    data_buffer.SetReadPosition(6);
+
+    // Shrinking the buffer truncates the data and read position
+    data_buffer.Resize(5);
+    STF_ASSERT_EQ(5, data_buffer.GetBufferSize());
+    STF_ASSERT_EQ(5, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(5, data_buffer.GetReadPosition());
+    STF_ASSERT_EQ(0xca, data_buffer[0]);
+    STF_ASSERT_EQ(0xde, data_buffer[4]);
+
+    // Growing the buffer retains the contents
+    data_buffer.Resize(64);
+    STF_ASSERT_EQ(64, data_buffer.GetBufferSize());
+    STF_ASSERT_EQ(5, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(0xbe, data_buffer[3]);
+
+    // Resizing to zero frees the buffer
+    data_buffer.Resize(0);
+    STF_ASSERT_EQ(0, data_buffer.GetBufferSize());
+    STF_ASSERT_EQ(nullptr, data_buffer.GetBufferPointer());
+}
+
+STF_TEST(TestDataBuffer, GrowableCopyMove)
+{
+    NetUtil::DataBuffer data_buffer(2, true);
+
+    data_buffer << std::uint32_t(0xcafebabe);
+
+    NetUtil::DataBuffer data_buffer2(data_buffer);
+    STF_ASSERT_TRUE(data_buffer2.IsGrowable());
+    STF_ASSERT_TRUE(data_buffer == data_buffer2);
+
+    NetUtil::DataBuffer data_buffer3(std::move(data_buffer2));
+    STF_ASSERT_TRUE(data_buffer3.IsGrowable());
+
+    NetUtil::DataBuffer data_buffer4;
+    data_buffer4 = data_buffer3;
+    STF_ASSERT_TRUE(data_buffer4.IsGrowable());
+
+    data_buffer4 << std::uint64_t(0);
+    STF_ASSERT_EQ(12, data_buffer4.GetDataLength());
+}
+
+// Memory resource that counts allocations and deallocations
+class CountingResource : public std::pmr::memory_resource
+{
+    public:
+        std::size_t allocations = 0;
+        std::size_t deallocations = 0;
+
+    protected:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            allocations++;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void *p,
+                           std::size_t bytes,
+                           std::size_t alignment) override
+        {
+            deallocations++;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(
+                const std::pmr::memory_resource &other) const noexcept override
+        {
+            return this == &other;
+        }
+};
+
+STF_TEST(TestDataBuffer, MemoryResource)
+{
+    CountingResource resource;
+
+    {
+        NetUtil::DataBuffer data_buffer(64, &resource);
+
+        STF_ASSERT_EQ(&resource, data_buffer.GetMemoryResource());
+        STF_ASSERT_EQ(64, data_buffer.GetBufferSize());
+        STF_ASSERT_EQ(1, resource.allocations);
+
+        data_buffer << std::uint32_t(0xcafebabe);
+
+        // Copies allocate from the same memory resource
+        NetUtil::DataBuffer data_buffer2(data_buffer);
+        STF_ASSERT_EQ(&resource, data_buffer2.GetMemoryResource());
+        STF_ASSERT_EQ(2, resource.allocations);
+        STF_ASSERT_TRUE(data_buffer == data_buffer2);
+
+        // Copy assignment uses the receiving object's allocation method
+        NetUtil::DataBuffer data_buffer3(16);
+        data_buffer3 = data_buffer;
+        STF_ASSERT_EQ(nullptr, data_buffer3.GetMemoryResource());
+        STF_ASSERT_EQ(2, resource.allocations);
+        STF_ASSERT_TRUE(data_buffer == data_buffer3);
+
+        // Copy from a heap-allocated buffer into the memory resource
+        NetUtil::DataBuffer data_buffer4(data_buffer3, &resource);
+        STF_ASSERT_EQ(&resource, data_buffer4.GetMemoryResource());
+        STF_ASSERT_EQ(3, resource.allocations);
+        STF_ASSERT_TRUE(data_buffer == data_buffer4);
+
+        // Growing allocates from the memory resource
+        data_buffer.SetGrowable(true);
+        for (std::size_t i = 0; i < 16; i++) data_buffer << std::uint32_t(0);
+        STF_ASSERT_EQ(4, resource.allocations);
+        STF_ASSERT_EQ(1, resource.deallocations);
+        STF_ASSERT_EQ(68, data_buffer.GetDataLength());
+    }
+
+    STF_ASSERT_EQ(resource.allocations, resource.deallocations);
+}
+
+STF_TEST(TestDataBuffer, MonotonicResource)
+{
+    std::uint8_t arena[1024];
+    std::pmr::monotonic_buffer_resource resource(
+                                            arena,
+                                            sizeof(arena),
+                                            std::pmr::null_memory_resource());
+
+    NetUtil::DataBuffer data_buffer1(100, &resource);
+    NetUtil::DataBuffer data_buffer2(100, &resource);
+
+    // Both buffers should be carved from the arena
+    STF_ASSERT_TRUE(data_buffer1.GetBufferPointer() >= arena);
+    STF_ASSERT_TRUE(data_buffer1.GetBufferPointer() < arena + sizeof(arena));
+    STF_ASSERT_TRUE(data_buffer2.GetBufferPointer() >= arena);
+    STF_ASSERT_TRUE(data_buffer2.GetBufferPointer() < arena + sizeof(arena));
+    STF_ASSERT_NE(data_buffer1.GetBufferPointer(),
+                  data_buffer2.GetBufferPointer());
+}
+
+STF_TEST(TestDataBuffer, ArrayValues)
+{
+    STF_ASSERT_TRUE(VerifyArrayValues<std::uint16_t>());
+    STF_ASSERT_TRUE(VerifyArrayValues<std::int16_t>());
+    STF_ASSERT_TRUE(VerifyArrayValues<std::uint32_t>());
+    STF_ASSERT_TRUE(VerifyArrayValues<std::int32_t>());
+    STF_ASSERT_TRUE(VerifyArrayValues<std::uint64_t>());
+    STF_ASSERT_TRUE(VerifyArrayValues<std::int64_t>());
+    STF_ASSERT_TRUE(VerifyArrayValues<float>());
+    STF_ASSERT_TRUE(VerifyArrayValues<double>());
+}
+
+STF_TEST(TestDataBuffer, ArrayValuesNetworkOrder)
+{
+    NetUtil::DataBuffer data_buffer(16);
+    std::vector<std::uint16_t> values16 = {0x0102, 0x0304};
+    std::vector<std::uint32_t> values32 = {0x05060708};
+    std::vector<std::uint64_t> values64 = {0x090a0b0c0d0e0f10};
+
+    data_buffer.AppendValues(std::span<const std::uint16_t>(values16));
+    data_buffer.AppendValues(std::span<const std::uint32_t>(values32));
+    data_buffer.AppendValues(std::span<const std::uint64_t>(values64));
+
+    STF_ASSERT_EQ(16, data_buffer.GetDataLength());
+    for (std::size_t i = 0; i < data_buffer.GetDataLength(); i++)
+    {
+        STF_ASSERT_EQ(i + 1, data_buffer[i]);
+    }
+}
+
+STF_TEST(TestDataBuffer, ArrayValuesBounds)
+{
+    NetUtil::DataBuffer data_buffer(8);
+    std::vector<std::uint32_t> values = {1, 2, 3};
+    bool exception_caught = false;
+
+    try
+    {
+        data_buffer.AppendValues(std::span<const std::uint32_t>(values));
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+    STF_ASSERT_TRUE(exception_caught);
+    STF_ASSERT_EQ(0, data_buffer.GetDataLength());
+
+    exception_caught = false;
+    try
+    {
+        data_buffer.SetValues(std::span<const std::uint32_t>(values).first(1),
+                              5);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+    STF_ASSERT_TRUE(exception_caught);
+
+    exception_caught = false;
+    data_buffer.AppendValues(std::span<const std::uint32_t>(values).first(1));
+    try
+    {
+        data_buffer.ReadValues(std::span<std::uint32_t>(values).first(2));
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+    STF_ASSERT_TRUE(exception_caught);
+    STF_ASSERT_EQ(0, data_buffer.GetReadPosition());
+}
+
+STF_TEST(TestDataBuffer, GrowableArrayValues)
+{
+    NetUtil::DataBuffer data_buffer(0, true);
+    std::vector<double> values = MakeValues<double>();
+    std::vector<double> values_read(values.size());
+
+    data_buffer.AppendValues(std::span<const double>(values));
+    STF_ASSERT_EQ(values.size() * sizeof(double), data_buffer.GetDataLength());
+
+    data_buffer.ReadValues(std::span<double>(values_read));
+    STF_ASSERT_EQ(values, values_read);
+}
+
+STF_TEST(TestDataBuffer, TryGetValue)
+{
+    NetUtil::DataBuffer data_buffer(6);
+    std::uint32_t value = 0;
+    std::array<std::uint8_t, 4> octets{};
+    constexpr std::size_t Max_Offset = std::numeric_limits<std::size_t>::max();
+
+    data_buffer.SetValue(std::uint32_t(0x01020304), 2);
+
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryGetValue(value, 2));
+    STF_ASSERT_EQ(0x01020304, value);
+
+    // Attempt to read beyond the buffer leaves the value unchanged
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondBuffer,
+                  data_buffer.TryGetValue(value, 3));
+    STF_ASSERT_EQ(0x01020304, value);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondBuffer,
+                  data_buffer.TryGetValue(value, Max_Offset));
+
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryGetValue(std::span<std::uint8_t>(octets), 2));
+    STF_ASSERT_EQ(0x04, octets[3]);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondBuffer,
+                  data_buffer.TryGetValue(std::span<std::uint8_t>(octets), 3));
+}
+
+STF_TEST(TestDataBuffer, TryAppendValue)
+{
+    NetUtil::DataBuffer data_buffer(6);
+    NetUtil::DataBuffer growable_buffer(2, true);
+
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryAppendValue(std::uint32_t(0x01020304)));
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondBuffer,
+                  data_buffer.TryAppendValue(std::uint32_t(0x05060708)));
+    STF_ASSERT_EQ(4, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondBuffer,
+                  data_buffer.TryAppendValue(std::span<const char>("abc", 3)));
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryAppendValue(std::span<const char>("ab", 2)));
+    STF_ASSERT_EQ(6, data_buffer.GetDataLength());
+
+    // A growable buffer grows rather than failing
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  growable_buffer.TryAppendValue(double(1.5)));
+    STF_ASSERT_EQ(8, growable_buffer.GetDataLength());
+}
+
+STF_TEST(TestDataBuffer, TryReadValue)
+{
+    NetUtil::DataBuffer data_buffer(16);
+    std::uint16_t u16 = 0;
+    std::int64_t i64 = 0;
+    float f = 0;
+
+    data_buffer << std::uint16_t(0x0102) << float(2.5) << std::uint8_t(3);
+
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryReadValue(u16));
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryReadValue(f));
+    STF_ASSERT_EQ(0x0102, u16);
+    STF_ASSERT_EQ(2.5, f);
+
+    // Only one octet remains, though the buffer is larger
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondDataLength,
+                  data_buffer.TryReadValue(i64));
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondDataLength,
+                  data_buffer.TryReadValue(u16));
+    STF_ASSERT_EQ(0x0102, u16);
+    STF_ASSERT_EQ(6, data_buffer.GetReadPosition());
+    STF_ASSERT_EQ(1, data_buffer.GetUnreadLength());
+}
+
+STF_TEST(TestDataBuffer, ExplicitByteOrder)
+{
+    NetUtil::DataBuffer data_buffer(16);
+    std::uint32_t u32 = 0x01020304;
+    double d{};
+
+    data_buffer.AppendValue<NetUtil::ByteOrder::Little>(u32);
+    data_buffer.AppendValue<NetUtil::ByteOrder::Big>(u32);
+    data_buffer.AppendValue<NetUtil::ByteOrder::Little>(double(-2.75));
+
+    STF_ASSERT_EQ(0x04, data_buffer[0]);
+    STF_ASSERT_EQ(0x01, data_buffer[3]);
+    STF_ASSERT_EQ(0x01, data_buffer[4]);
+    STF_ASSERT_EQ(0x04, data_buffer[7]);
+
+    data_buffer.ReadValue<NetUtil::ByteOrder::Little>(u32);
+    STF_ASSERT_EQ(0x01020304, u32);
+    data_buffer.ReadValue(u32);
+    STF_ASSERT_EQ(0x01020304, u32);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryReadValue<NetUtil::ByteOrder::Little>(d));
+    STF_ASSERT_EQ(-2.75, d);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondDataLength,
+                  data_buffer.TryReadValue<NetUtil::ByteOrder::Little>(d));
+
+    // Host byte order is equivalent to the native order of the value
+    data_buffer.SetValue<NetUtil::ByteOrder::Host>(std::uint16_t(0x0102), 0);
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        STF_ASSERT_EQ(0x02, data_buffer[0]);
+    }
+    else
+    {
+        STF_ASSERT_EQ(0x01, data_buffer[0]);
+    }
+}
+
+STF_TEST(TestDataBuffer, Compact)
+{
+    NetUtil::DataBuffer data_buffer(8);
+    std::uint16_t value{};
+
+    data_buffer << std::uint16_t(0x0102) << std::uint16_t(0x0304)
+                << std::uint16_t(0x0506);
+    data_buffer >> value;
+
+    data_buffer.Compact();
+
+    STF_ASSERT_EQ(0, data_buffer.GetReadPosition());
+    STF_ASSERT_EQ(4, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(0x03, data_buffer[0]);
+    STF_ASSERT_EQ(0x06, data_buffer[3]);
+
+    // Space is now available to append
+    data_buffer << std::uint32_t(0x0708090a);
+    data_buffer >> value;
+    STF_ASSERT_EQ(0x0304, value);
+}
+
+STF_TEST(TestDataBuffer, Consume)
+{
+    NetUtil::DataBuffer data_buffer(16);
+    bool exception_caught = false;
+
+    data_buffer << std::uint32_t(0x01020304) << std::uint32_t(0x05060708)
+                << std::uint32_t(0x090a0b0c);
+
+    // Consuming less than the given fraction does not move data
+    data_buffer.Consume(4);
+    STF_ASSERT_EQ(4, data_buffer.GetReadPosition());
+    STF_ASSERT_EQ(12, data_buffer.GetDataLength());
+
+    // Reaching the given fraction moves the unread data
+    data_buffer.Consume(4);
+    STF_ASSERT_EQ(0, data_buffer.GetReadPosition());
+    STF_ASSERT_EQ(4, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(0x09, data_buffer[0]);
+
+    // Consuming everything resets the buffer
+    data_buffer.Consume(4, 2.0);
+    STF_ASSERT_EQ(0, data_buffer.GetReadPosition());
+    STF_ASSERT_EQ(0, data_buffer.GetDataLength());
+
+    try
+    {
+        data_buffer.Consume(1);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+}
+
+STF_TEST(TestDataBuffer, FreeSpan)
+{
+    NetUtil::DataBuffer data_buffer(8);
+    NetUtil::DataBuffer growable_buffer(2, true);
+    std::uint32_t value{};
+    bool exception_caught = false;
+
+    data_buffer << std::uint16_t(0x0102);
+    data_buffer.AdvanceReadPosition(1);
+
+    std::span<std::uint8_t> free_span = data_buffer.GetFreeSpan();
+    STF_ASSERT_EQ(6, free_span.size());
+    free_span[0] = 0x03;
+    free_span[1] = 0x04;
+    free_span[2] = 0x05;
+    data_buffer.AdvanceDataLength(3);
+
+    // The read position is retained
+    STF_ASSERT_EQ(1, data_buffer.GetReadPosition());
+    data_buffer >> value;
+    STF_ASSERT_EQ(0x02030405, value);
+
+    try
+    {
+        data_buffer.AdvanceDataLength(4);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+
+    // A growable buffer grows to provide the requested space
+    STF_ASSERT_GE(growable_buffer.GetFreeSpan(100).size(), 100);
+}
+
+STF_TEST(TestDataBuffer, LengthFields)
+{
+    NetUtil::DataBuffer data_buffer(4, true);
+    std::uint16_t outer_length{};
+    std::uint8_t inner_length{};
+    std::uint32_t value{};
+
+    // Write nested structures, each preceded by its length
+    std::size_t outer = data_buffer.BeginLength<std::uint16_t>();
+    data_buffer << std::uint8_t(0x01);
+    std::size_t inner = data_buffer.BeginLength<std::uint8_t>();
+    data_buffer << std::uint32_t(0x02030405);
+    STF_ASSERT_EQ(4, data_buffer.EndLength<std::uint8_t>(inner));
+    STF_ASSERT_EQ(6, data_buffer.EndLength<std::uint16_t>(outer));
+
+    STF_ASSERT_EQ(8, data_buffer.GetDataLength());
+    data_buffer >> outer_length;
+    STF_ASSERT_EQ(6, outer_length);
+    data_buffer >> inner_length;
+    STF_ASSERT_EQ(0x01, inner_length);
+    data_buffer >> inner_length;
+    STF_ASSERT_EQ(4, inner_length);
+    data_buffer >> value;
+    STF_ASSERT_EQ(0x02030405, value);
+
+    // A length field may be written in another byte order
+    std::size_t little = data_buffer.BeginLength<std::uint16_t,
+                                                 NetUtil::ByteOrder::Little>();
+    data_buffer << std::uint8_t(0xff);
+    data_buffer.EndLength<std::uint16_t, NetUtil::ByteOrder::Little>(little);
+    STF_ASSERT_EQ(0x01, data_buffer[8]);
+    STF_ASSERT_EQ(0x00, data_buffer[9]);
+
+    // A length that does not fit in the length field results in an exception
+    std::size_t too_long = data_buffer.BeginLength<std::uint8_t>();
+    data_buffer.AppendValue(std::vector<std::uint8_t>(256));
+    auto test_length = [&]
+    {
+        data_buffer.EndLength<std::uint8_t>(too_long);
+    };
+    STF_ASSERT_EXCEPTION_E(test_length, NetUtil::DataBufferException);
+
+    // As does an offset that is not within the data
+    auto test_offset = [&]
+    {
+        data_buffer.EndLength<std::uint32_t>(data_buffer.GetDataLength() - 3);
+    };
+    STF_ASSERT_EXCEPTION_E(test_offset, NetUtil::DataBufferException);
+}
+
+STF_TEST(TestDataBuffer, ReadSpanAndPeek)
+{
+    NetUtil::DataBuffer data_buffer(16);
+    std::span<std::uint8_t> span;
+    std::uint16_t value{};
+    std::uint32_t large_value{};
+
+    data_buffer << std::uint16_t(0x0102) << std::uint32_t(0x03040506);
+
+    // Peeking does not advance the read position
+    data_buffer.PeekValue(value);
+    STF_ASSERT_EQ(0x0102, value);
+    data_buffer.PeekValue<NetUtil::ByteOrder::Little>(value);
+    STF_ASSERT_EQ(0x0201, value);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryPeekValue(large_value));
+    STF_ASSERT_EQ(0x01020304, large_value);
+    STF_ASSERT_EQ(0, data_buffer.GetReadPosition());
+
+    span = data_buffer.PeekSpan(2);
+    STF_ASSERT_EQ(data_buffer.GetBufferPointer(), span.data());
+    STF_ASSERT_EQ(0, data_buffer.GetReadPosition());
+
+    // Reading a span refers to the buffer rather than copying
+    span = data_buffer.ReadSpan(3);
+    STF_ASSERT_EQ(3, span.size());
+    STF_ASSERT_EQ(data_buffer.GetBufferPointer(), span.data());
+    STF_ASSERT_EQ(3, data_buffer.GetReadPosition());
+    span[0] = 0xff;
+    STF_ASSERT_EQ(0xff, data_buffer[0]);
+
+    // Values beyond the data length cannot be peeked or read
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondDataLength,
+                  data_buffer.TryPeekValue(large_value));
+    STF_ASSERT_EQ(0x01020304, large_value);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondDataLength,
+                  data_buffer.TryReadSpan(span, 4));
+    STF_ASSERT_EQ(3, span.size());
+    STF_ASSERT_EQ(3, data_buffer.GetReadPosition());
+
+    auto test_peek = [&] { data_buffer.PeekValue(large_value); };
+    auto test_peek_span = [&] { data_buffer.PeekSpan(4); };
+    auto test_read_span = [&] { data_buffer.ReadSpan(4); };
+    STF_ASSERT_EXCEPTION_E(test_peek, NetUtil::DataBufferException);
+    STF_ASSERT_EXCEPTION_E(test_peek_span, NetUtil::DataBufferException);
+    STF_ASSERT_EXCEPTION_E(test_read_span, NetUtil::DataBufferException);
+
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryReadSpan(span, 3));
+    STF_ASSERT_EQ(0x04, span[0]);
+    STF_ASSERT_EQ(0x06, span[2]);
+    STF_ASSERT_EQ(0, data_buffer.GetUnreadLength());
+    STF_ASSERT_TRUE(data_buffer.ReadSpan(0).empty());
+}
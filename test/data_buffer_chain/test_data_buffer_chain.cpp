@@ -0,0 +1,261 @@
+/*
+ *  test_data_buffer_chain.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the DataBufferChain object.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/uio.h>
+#endif
+#include <terra/netutil/data_buffer_chain.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+STF_TEST(TestDataBufferChain, Constructor)
+{
+    NetUtil::DataBufferChain chain;
+
+    STF_ASSERT_EQ(0, chain.GetSegmentCount());
+    STF_ASSERT_EQ(0, chain.GetDataLength());
+    STF_ASSERT_EQ(0, chain.GetUnreadLength());
+    STF_ASSERT_TRUE(chain.Empty());
+}
+
+STF_TEST(TestDataBufferChain, AppendAcrossSegments)
+{
+    NetUtil::DataBufferChain chain(3);
+
+    chain << std::uint8_t(0x01) << std::uint32_t(0x02030405)
+          << std::uint64_t(0x060708090a0b0c0d) << std::uint16_t(0x0e0f);
+
+    STF_ASSERT_EQ(15, chain.GetDataLength());
+    STF_ASSERT_EQ(15, chain.GetUnreadLength());
+    STF_ASSERT_EQ(4, chain.GetSegmentCount());
+    STF_ASSERT_FALSE(chain.Empty());
+
+    // Verify the octets were laid out in order across segments
+    std::array<std::uint8_t, 15> octets{};
+    chain.ReadValue(std::span<std::uint8_t>(octets));
+    for (std::size_t i = 0; i < octets.size(); i++)
+    {
+        STF_ASSERT_EQ(i + 1, octets[i]);
+    }
+
+    STF_ASSERT_EQ(0, chain.GetUnreadLength());
+}
+
+STF_TEST(TestDataBufferChain, ReadAcrossSegments)
+{
+    NetUtil::DataBufferChain chain(4);
+    std::uint8_t u8{};
+    std::int16_t i16{};
+    std::uint32_t u32{};
+    std::int64_t i64{};
+    float f{};
+    double d{};
+
+    chain << std::uint8_t(0xfe) << std::int16_t(-2)
+          << std::uint32_t(0xdeadbeef) << std::int64_t(-1234567890123)
+          << float(1.5) << double(-2.25);
+
+    chain >> u8 >> i16 >> u32 >> i64 >> f >> d;
+
+    STF_ASSERT_EQ(0xfe, u8);
+    STF_ASSERT_EQ(-2, i16);
+    STF_ASSERT_EQ(0xdeadbeef, u32);
+    STF_ASSERT_EQ(-1234567890123, i64);
+    STF_ASSERT_EQ(1.5, f);
+    STF_ASSERT_EQ(-2.25, d);
+    STF_ASSERT_EQ(0, chain.GetUnreadLength());
+}
+
+STF_TEST(TestDataBufferChain, ReadBeyondData)
+{
+    NetUtil::DataBufferChain chain(2);
+    std::uint32_t value{};
+    bool exception_caught = false;
+
+    chain << std::uint16_t(0x0102) << std::uint8_t(0x03);
+
+    try
+    {
+        chain >> value;
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+
+    // Nothing should have been consumed
+    STF_ASSERT_EQ(3, chain.GetUnreadLength());
+}
+
+STF_TEST(TestDataBufferChain, AppendBufferZeroCopy)
+{
+    NetUtil::DataBufferChain chain;
+    NetUtil::DataBuffer header(4);
+    std::array<std::uint8_t, 6> payload = {1, 2, 3, 4, 5, 6};
+
+    header << std::uint32_t(0x0a0b0c0d);
+    const std::uint8_t *header_pointer = header.GetBufferPointer();
+
+    chain.AppendBuffer(std::move(header));
+    chain.AppendBuffer(std::span<std::uint8_t>(payload));
+
+    STF_ASSERT_EQ(2, chain.GetSegmentCount());
+    STF_ASSERT_EQ(10, chain.GetDataLength());
+
+    // Neither segment should have been copied
+    STF_ASSERT_EQ(header_pointer, chain.GetSegment(0).GetBufferPointer());
+    STF_ASSERT_EQ(payload.data(), chain.GetSegment(1).GetBufferPointer());
+
+    // Appending values should use a new segment after the payload
+    chain << std::uint16_t(0x0708);
+    STF_ASSERT_EQ(3, chain.GetSegmentCount());
+    STF_ASSERT_EQ(12, chain.GetDataLength());
+
+    std::uint32_t value{};
+    std::array<std::uint8_t, 8> octets{};
+    chain >> value;
+    chain.ReadValue(std::span<std::uint8_t>(octets));
+    STF_ASSERT_EQ(0x0a0b0c0d, value);
+    for (std::size_t i = 0; i < octets.size(); i++)
+    {
+        STF_ASSERT_EQ(i + 1, octets[i]);
+    }
+}
+
+STF_TEST(TestDataBufferChain, GetSegment)
+{
+    NetUtil::DataBufferChain chain;
+    bool exception_caught = false;
+
+    try
+    {
+        chain.GetSegment(0);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+}
+
+STF_TEST(TestDataBufferChain, AdvancePositions)
+{
+    NetUtil::DataBufferChain chain;
+    bool exception_caught = false;
+
+    chain.AppendBuffer(NetUtil::DataBuffer(4));
+    chain.AppendBuffer(NetUtil::DataBuffer(4));
+
+    chain.AdvanceDataLength(6);
+    STF_ASSERT_EQ(4, chain.GetSegment(0).GetDataLength());
+    STF_ASSERT_EQ(2, chain.GetSegment(1).GetDataLength());
+
+    try
+    {
+        chain.AdvanceDataLength(3);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+    STF_ASSERT_TRUE(exception_caught);
+    STF_ASSERT_EQ(6, chain.GetDataLength());
+
+    chain.AdvanceReadPosition(5);
+    STF_ASSERT_EQ(1, chain.GetUnreadLength());
+
+    exception_caught = false;
+    try
+    {
+        chain.AdvanceReadPosition(2);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+    STF_ASSERT_TRUE(exception_caught);
+    STF_ASSERT_EQ(1, chain.GetUnreadLength());
+
+    chain.Clear();
+    STF_ASSERT_EQ(0, chain.GetSegmentCount());
+    STF_ASSERT_TRUE(chain.Empty());
+}
+
+#ifndef _WIN32
+
+STF_TEST(TestDataBufferChain, WriteAndReadVectors)
+{
+    NetUtil::DataBufferChain send_chain(4);
+    NetUtil::DataBufferChain receive_chain;
+    std::array<std::uint8_t, 3> payload = {0xaa, 0xbb, 0xcc};
+    int fds[2];
+
+    STF_ASSERT_EQ(0, pipe(fds));
+
+    send_chain << std::uint32_t(0x01020304) << std::uint16_t(0x0506);
+    send_chain.AppendBuffer(std::span<std::uint8_t>(payload));
+
+    // Skip over the first octet to exercise a partial first segment
+    send_chain.AdvanceReadPosition(1);
+
+    std::span<const iovec> iov = send_chain.GetIOVec();
+    STF_ASSERT_EQ(3, iov.size());
+    ssize_t sent = writev(fds[1], iov.data(), static_cast<int>(iov.size()));
+    STF_ASSERT_EQ(8, sent);
+    send_chain.AdvanceReadPosition(static_cast<std::size_t>(sent));
+    STF_ASSERT_EQ(0, send_chain.GetUnreadLength());
+
+    // Receive into two small segments
+    receive_chain.AppendBuffer(NetUtil::DataBuffer(5));
+    receive_chain.AppendBuffer(NetUtil::DataBuffer(5));
+    iov = receive_chain.GetFreeIOVec();
+    STF_ASSERT_EQ(2, iov.size());
+    ssize_t received = readv(fds[0], iov.data(), static_cast<int>(iov.size()));
+    STF_ASSERT_EQ(8, received);
+    receive_chain.AdvanceDataLength(static_cast<std::size_t>(received));
+
+    close(fds[0]);
+    close(fds[1]);
+
+    std::array<std::uint8_t, 3> start{};
+    std::uint16_t value{};
+    std::array<std::uint8_t, 3> end{};
+    receive_chain.ReadValue(std::span<std::uint8_t>(start));
+    receive_chain >> value;
+    receive_chain.ReadValue(std::span<std::uint8_t>(end));
+
+    STF_ASSERT_EQ(0x02, start[0]);
+    STF_ASSERT_EQ(0x03, start[1]);
+    STF_ASSERT_EQ(0x04, start[2]);
+    STF_ASSERT_EQ(0x0506, value);
+    STF_ASSERT_EQ(payload, end);
+
+    // The free space remaining follows the data
+    iov = receive_chain.GetFreeIOVec();
+    STF_ASSERT_EQ(1, iov.size());
+    STF_ASSERT_EQ(2, iov[0].iov_len);
+}
+
+#endif
@@ -0,0 +1,228 @@
+/*
+ *  test_data_cursor.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the DataWriter and DataReader
+ *      objects.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <terra/netutil/data_cursor.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+STF_TEST(TestDataCursor, WriteMatchesAppend)
+{
+    NetUtil::DataBuffer db1(64);
+    NetUtil::DataBuffer db2(64);
+    std::array<std::uint8_t, 3> octets = {0xaa, 0xbb, 0xcc};
+    std::string text = "Hi";
+
+    db1.AppendValue(std::uint8_t(0x01));
+    db2.AppendValue(std::uint8_t(0x01));
+
+    {
+        NetUtil::DataWriter writer(db1, 47);
+
+        writer << std::uint8_t(0x02) << std::int8_t(-3) << std::uint16_t(0x0405)
+               << std::int16_t(-6) << std::uint32_t(0x0708090a)
+               << std::int32_t(-11) << std::uint64_t(0x0c0d0e0f10111213)
+               << std::int64_t(-20) << float(1.5) << double(-2.75);
+        writer.WriteValue(std::span<const std::uint8_t>(octets));
+        writer.WriteValue(std::span<const char>(text));
+
+        STF_ASSERT_EQ(47, writer.GetLength());
+        STF_ASSERT_EQ(0, writer.GetRemaining());
+
+        // Nothing is visible until committed
+        STF_ASSERT_EQ(1, db1.GetDataLength());
+        writer.Commit();
+        STF_ASSERT_EQ(48, db1.GetDataLength());
+        STF_ASSERT_EQ(0, writer.GetLength());
+    }
+
+    db2 << std::uint8_t(0x02) << std::int8_t(-3) << std::uint16_t(0x0405)
+        << std::int16_t(-6) << std::uint32_t(0x0708090a) << std::int32_t(-11)
+        << std::uint64_t(0x0c0d0e0f10111213) << std::int64_t(-20) << float(1.5)
+        << double(-2.75);
+    db2.AppendValue(std::span<const std::uint8_t>(octets));
+    db2.AppendValue(std::span<const char>(text));
+
+    STF_ASSERT_TRUE(db1 == db2);
+}
+
+STF_TEST(TestDataCursor, ReadValues)
+{
+    NetUtil::DataBuffer data_buffer(64);
+    std::uint8_t u8{};
+    std::int8_t i8{};
+    std::uint16_t u16{};
+    std::int16_t i16{};
+    std::uint32_t u32{};
+    std::int32_t i32{};
+    std::uint64_t u64{};
+    std::int64_t i64{};
+    float f{};
+    double d{};
+    std::array<char, 2> text{};
+
+    data_buffer << std::uint8_t(0x02) << std::int8_t(-3)
+                << std::uint16_t(0x0405) << std::int16_t(-6)
+                << std::uint32_t(0x0708090a) << std::int32_t(-11)
+                << std::uint64_t(0x0c0d0e0f10111213) << std::int64_t(-20)
+                << float(1.5) << double(-2.75) << std::uint8_t(0xff);
+    data_buffer.AppendValue(std::span<const char>("Hi", 2));
+
+    NetUtil::DataReader reader(data_buffer, 45);
+
+    reader >> u8 >> i8 >> u16 >> i16 >> u32 >> i32 >> u64 >> i64 >> f >> d;
+    reader.Skip(1);
+    reader.ReadValue(std::span<char>(text));
+
+    STF_ASSERT_EQ(0x02, u8);
+    STF_ASSERT_EQ(-3, i8);
+    STF_ASSERT_EQ(0x0405, u16);
+    STF_ASSERT_EQ(-6, i16);
+    STF_ASSERT_EQ(0x0708090a, u32);
+    STF_ASSERT_EQ(-11, i32);
+    STF_ASSERT_EQ(0x0c0d0e0f10111213, u64);
+    STF_ASSERT_EQ(-20, i64);
+    STF_ASSERT_EQ(1.5, f);
+    STF_ASSERT_EQ(-2.75, d);
+    STF_ASSERT_EQ('H', text[0]);
+    STF_ASSERT_EQ('i', text[1]);
+
+    STF_ASSERT_EQ(0, data_buffer.GetReadPosition());
+    reader.Commit();
+    STF_ASSERT_EQ(45, data_buffer.GetReadPosition());
+    STF_ASSERT_EQ(0, data_buffer.GetUnreadLength());
+}
+
+STF_TEST(TestDataCursor, UncommittedReadDiscarded)
+{
+    NetUtil::DataBuffer data_buffer(8);
+    std::uint32_t value{};
+
+    data_buffer << std::uint32_t(0x01020304);
+
+    {
+        NetUtil::DataReader reader(data_buffer, 4);
+        reader >> value;
+    }
+
+    STF_ASSERT_EQ(0x01020304, value);
+    STF_ASSERT_EQ(0, data_buffer.GetReadPosition());
+}
+
+STF_TEST(TestDataCursor, RequireWrite)
+{
+    NetUtil::DataBuffer data_buffer(8);
+    bool exception_caught = false;
+
+    NetUtil::DataWriter writer(data_buffer, 4);
+    writer << std::uint32_t(0x01020304);
+
+    try
+    {
+        writer.Require(5);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+
+    // Requiring the remaining space succeeds
+    writer.Require(4);
+    STF_ASSERT_EQ(4, writer.GetRemaining());
+    writer << std::uint32_t(0x05060708);
+    writer.Commit();
+
+    STF_ASSERT_EQ(8, data_buffer.GetDataLength());
+    for (std::size_t i = 0; i < data_buffer.GetDataLength(); i++)
+    {
+        STF_ASSERT_EQ(i + 1, data_buffer[i]);
+    }
+}
+
+STF_TEST(TestDataCursor, RequireWriteGrowable)
+{
+    NetUtil::DataBuffer data_buffer(4, true);
+
+    NetUtil::DataWriter writer(data_buffer, 2);
+    writer << std::uint16_t(0x0102);
+
+    // Growing must preserve the uncommitted value
+    writer.Require(100);
+    STF_ASSERT_GE(data_buffer.GetBufferSize(), 102);
+    writer << std::uint16_t(0x0304);
+    writer.Commit();
+
+    STF_ASSERT_EQ(4, data_buffer.GetDataLength());
+    for (std::size_t i = 0; i < data_buffer.GetDataLength(); i++)
+    {
+        STF_ASSERT_EQ(i + 1, data_buffer[i]);
+    }
+}
+
+STF_TEST(TestDataCursor, RequireRead)
+{
+    NetUtil::DataBuffer data_buffer(8);
+    std::uint16_t value{};
+    bool exception_caught = false;
+
+    data_buffer << std::uint16_t(0x0102) << std::uint16_t(0x0304);
+    data_buffer >> value;
+
+    try
+    {
+        NetUtil::DataReader reader(data_buffer, 3);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+
+    NetUtil::DataReader reader(data_buffer, 2);
+    reader >> value;
+    STF_ASSERT_EQ(0x0304, value);
+    reader.Commit();
+    STF_ASSERT_EQ(0, data_buffer.GetUnreadLength());
+}
+
+STF_TEST(TestDataCursor, EmptyBuffer)
+{
+    NetUtil::DataBuffer data_buffer;
+    bool exception_caught = false;
+
+    NetUtil::DataWriter writer(data_buffer);
+    writer.Commit();
+    STF_ASSERT_EQ(0, data_buffer.GetDataLength());
+
+    try
+    {
+        writer.Require(1);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+}
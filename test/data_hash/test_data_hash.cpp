@@ -0,0 +1,213 @@
+/*
+ *  test_data_hash.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the CRC-32C and content hash
+ *      functions.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include <terra/netutil/data_hash.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+namespace
+{
+
+// Return a span over the characters of the given string
+std::span<const std::uint8_t> Octets(std::string_view text)
+{
+    return {reinterpret_cast<const std::uint8_t *>(text.data()), text.size()};
+}
+
+// Compute the CRC-32C one bit at a time
+std::uint32_t ReferenceCrc32c(std::span<const std::uint8_t> data)
+{
+    std::uint32_t crc = 0xffffffff;
+
+    for (std::uint8_t octet : data)
+    {
+        crc ^= octet;
+        for (unsigned bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (((crc & 1) != 0) ? 0x82f63b78 : 0);
+        }
+    }
+
+    return ~crc;
+}
+
+// Produce pseudo-random test data
+std::vector<std::uint8_t> TestData(std::size_t length)
+{
+    std::vector<std::uint8_t> data(length);
+    std::uint32_t state = 1;
+
+    for (auto &octet : data)
+    {
+        state = (state * 1103515245) + 12345;
+        octet = static_cast<std::uint8_t>(state >> 16);
+    }
+
+    return data;
+}
+
+} // namespace
+
+STF_TEST(DataHash, Crc32cKnownValues)
+{
+    std::vector<std::uint8_t> zeros(32, 0x00);
+    std::vector<std::uint8_t> ones(32, 0xff);
+    std::vector<std::uint8_t> ascending(32);
+
+    for (std::size_t i = 0; i < ascending.size(); i++)
+    {
+        ascending[i] = static_cast<std::uint8_t>(i);
+    }
+
+    STF_ASSERT_EQ(0, NetUtil::Crc32c({}));
+    STF_ASSERT_EQ(0xe3069283, NetUtil::Crc32c(Octets("123456789")));
+
+    // Test vectors from RFC 3720 Appendix B.4
+    STF_ASSERT_EQ(0x8a9136aa, NetUtil::Crc32c(zeros));
+    STF_ASSERT_EQ(0x62a8ab43, NetUtil::Crc32c(ones));
+    STF_ASSERT_EQ(0x46dd794e, NetUtil::Crc32c(ascending));
+}
+
+STF_TEST(DataHash, Crc32cVariousLengths)
+{
+    std::vector<std::uint8_t> data = TestData(300);
+    std::span<const std::uint8_t> octets(data);
+
+    for (std::size_t offset = 0; offset < 8; offset++)
+    {
+        for (std::size_t length = 0; length < 256; length++)
+        {
+            auto subspan = octets.subspan(offset, length);
+
+            STF_ASSERT_EQ(ReferenceCrc32c(subspan), NetUtil::Crc32c(subspan));
+        }
+    }
+}
+
+STF_TEST(DataHash, Crc32cIncremental)
+{
+    std::vector<std::uint8_t> data = TestData(1000);
+    std::span<const std::uint8_t> octets(data);
+    std::uint32_t expected = NetUtil::Crc32c(octets);
+
+    for (std::size_t split : {0, 1, 7, 8, 9, 500, 999, 1000})
+    {
+        std::uint32_t crc = NetUtil::Crc32c(octets.first(split));
+
+        crc = NetUtil::Crc32c(octets.subspan(split), crc);
+        STF_ASSERT_EQ(expected, crc);
+    }
+
+    // Update the CRC while appending to a DataBuffer
+    NetUtil::DataBuffer data_buffer(1000);
+    std::uint32_t crc = 0;
+
+    for (std::size_t i = 0; i < data.size(); i += 100)
+    {
+        data_buffer.AppendValue(octets.subspan(i, 100));
+        crc = NetUtil::Crc32c(data_buffer.GetBufferSpan(), crc);
+        data_buffer.AdvanceReadPosition(100);
+    }
+
+    STF_ASSERT_EQ(expected, crc);
+}
+
+STF_TEST(DataHash, ContentHashKnownValues)
+{
+    std::span<const std::uint8_t> empty;
+
+    // Values computed by the xxHash reference implementation
+    STF_ASSERT_EQ(0xef46db3751d8e999, NetUtil::ContentHash(empty));
+    STF_ASSERT_EQ(0xd24ec4f1a98c6e5b, NetUtil::ContentHash(Octets("a")));
+    STF_ASSERT_EQ(0x44bc2cf5ad770999, NetUtil::ContentHash(Octets("abc")));
+    STF_ASSERT_EQ(0xfbcea83c8a378bf1,
+                  NetUtil::ContentHash(
+                      Octets("Nobody inspects the spammish repetition")));
+
+    // A different seed produces a different hash
+    STF_ASSERT_NE(NetUtil::ContentHash(Octets("abc"), 0),
+                  NetUtil::ContentHash(Octets("abc"), 1));
+}
+
+STF_TEST(DataHash, ContentHasherIncremental)
+{
+    std::vector<std::uint8_t> data = TestData(1000);
+    std::span<const std::uint8_t> octets(data);
+
+    for (std::size_t length : {0, 5, 31, 32, 33, 64, 100, 1000})
+    {
+        std::uint64_t expected = NetUtil::ContentHash(octets.first(length));
+
+        // Hash the data in pieces of various sizes
+        for (std::size_t piece : {1, 3, 8, 17, 32, 40})
+        {
+            NetUtil::ContentHasher hasher;
+
+            for (std::size_t i = 0; i < length; i += piece)
+            {
+                hasher.Update(octets.subspan(i, std::min(piece, length - i)));
+            }
+
+            STF_ASSERT_EQ(expected, hasher.Digest());
+        }
+    }
+
+    // The digest may be requested while data is still being added
+    NetUtil::ContentHasher hasher(7);
+    hasher.Update(octets.first(10));
+    STF_ASSERT_EQ(NetUtil::ContentHash(octets.first(10), 7), hasher.Digest());
+    hasher.Update(octets.subspan(10, 90));
+    STF_ASSERT_EQ(NetUtil::ContentHash(octets.first(100), 7), hasher.Digest());
+
+    hasher.Reset();
+    STF_ASSERT_EQ(NetUtil::ContentHash(octets.first(0)), hasher.Digest());
+}
+
+STF_TEST(DataHash, DataBufferHash)
+{
+    NetUtil::DataBuffer a(64);
+    NetUtil::DataBuffer b(32);
+    NetUtil::DataBuffer c(32);
+    std::hash<NetUtil::DataBuffer> hash;
+
+    a << std::uint32_t(0x01020304) << std::uint16_t(0x0506);
+    b << std::uint32_t(0x01020304) << std::uint16_t(0x0506);
+    c << std::uint32_t(0x01020304) << std::uint16_t(0x0507);
+
+    // The read position is not a factor, just as with equality
+    b.AdvanceReadPosition(2);
+
+    STF_ASSERT_TRUE(a == b);
+    STF_ASSERT_EQ(hash(a), hash(b));
+    STF_ASSERT_NE(hash(a), hash(c));
+    STF_ASSERT_EQ(NetUtil::ContentHash(NetUtil::DataBuffer()),
+                  NetUtil::ContentHash(std::span<const std::uint8_t>()));
+
+    std::unordered_set<NetUtil::DataBuffer> buffers;
+    buffers.insert(a);
+    buffers.insert(b);
+    buffers.insert(c);
+
+    STF_ASSERT_EQ(2, buffers.size());
+    STF_ASSERT_TRUE(buffers.contains(c));
+}
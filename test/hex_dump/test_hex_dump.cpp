@@ -0,0 +1,248 @@
+/*
+ *  test_hex_dump.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the hex dump and hex parsing
+ *      functions.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <terra/netutil/hex_dump.h>
+#include <terra/netutil/formatters.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+namespace
+{
+
+// Produce test data containing every octet value
+std::vector<std::uint8_t> TestData(std::size_t length)
+{
+    std::vector<std::uint8_t> data(length);
+
+    for (std::size_t i = 0; i < length; i++)
+    {
+        data[i] = static_cast<std::uint8_t>((i * 37) + 5);
+    }
+
+    return data;
+}
+
+} // namespace
+
+STF_TEST(HexDump, Layout)
+{
+    std::vector<std::uint8_t> data = TestData(17);
+    std::array<char, 256> output{};
+    const std::string expected =
+        "00000000: 05 2A 4F 74 99 BE E3 08 2D 52 77 9C C1 E6 0B 30 "
+        ":.*Ot....-Rw....0:\n"
+        "00000010: 55                                              "
+        ":U               :\n";
+
+    STF_ASSERT_EQ(expected.size(), NetUtil::HexDumpLength(data.size()));
+
+    std::size_t length = NetUtil::HexDump(data, output);
+    STF_ASSERT_EQ(expected, std::string(output.data(), length));
+
+    // An output buffer that is too small results in an exception
+    auto test_func = [&]
+    {
+        NetUtil::HexDump(data, std::span(output).first(length - 1));
+    };
+    STF_ASSERT_EXCEPTION_E(test_func, NetUtil::DataBufferException);
+}
+
+STF_TEST(HexDump, HexDumpTo)
+{
+    std::vector<std::uint8_t> data = TestData(100);
+    std::vector<char> output(NetUtil::HexDumpLength(data.size()));
+    std::string text;
+
+    NetUtil::HexDump(data, output);
+    NetUtil::HexDumpTo(std::back_inserter(text), data);
+
+    STF_ASSERT_EQ(std::string(output.begin(), output.end()), text);
+    STF_ASSERT_EQ(0, NetUtil::HexDumpLength(0));
+}
+
+STF_TEST(HexDump, StreamOperator)
+{
+    std::vector<std::uint8_t> data = TestData(40);
+    NetUtil::DataBuffer data_buffer(data.data(), data.size());
+    std::ostringstream oss;
+    std::string expected;
+
+    // Only the unread portion of the buffer is dumped
+    data_buffer.SetDataLength(data.size());
+    data_buffer.AdvanceReadPosition(3);
+    NetUtil::HexDumpTo(std::back_inserter(expected),
+                       std::span(data).subspan(3));
+
+    oss << data_buffer;
+    STF_ASSERT_EQ(expected, oss.str());
+}
+
+STF_TEST(HexDump, LargeOffset)
+{
+    std::array<std::uint8_t, 1> data{0x41};
+    std::array<char, NetUtil::Hex_Dump_Max_Line_Length> line{};
+    const std::string expected = "123456789: 41" + std::string(46, ' ') +
+                                 ":A               :\n";
+
+    std::size_t length = NetUtil::HexDumpLine(data, 0x123456789, line);
+    STF_ASSERT_EQ(expected, std::string(line.data(), length));
+
+    // Lines starting at or beyond 2^32 have an additional offset digit
+    STF_ASSERT_EQ(std::size_t(0x10000000) * 77,
+                  NetUtil::HexDumpLength(0x100000000));
+    STF_ASSERT_EQ((std::size_t(0x10000000) * 77) + 78,
+                  NetUtil::HexDumpLength(0x100000001));
+}
+
+STF_TEST(HexDump, ToHexFromHex)
+{
+    std::vector<std::uint8_t> data = TestData(256);
+    std::vector<char> hex(data.size() * 2);
+
+    STF_ASSERT_EQ(6, NetUtil::ToHex(std::span(data).first(3), hex, false));
+    STF_ASSERT_EQ("052a4f", std::string(hex.data(), 6));
+    STF_ASSERT_EQ(hex.size(), NetUtil::ToHex(data, hex));
+    STF_ASSERT_EQ("052A4F", std::string(hex.data(), 6));
+
+    // Parse various lengths so that both vector and scalar parsing are used
+    for (std::size_t length = 0; length <= data.size(); length++)
+    {
+        NetUtil::DataBuffer data_buffer =
+            NetUtil::FromHex(std::string_view(hex.data(), length * 2));
+
+        STF_ASSERT_EQ(length, data_buffer.GetDataLength());
+        for (std::size_t i = 0; i < length; i++)
+        {
+            STF_ASSERT_EQ(data[i], data_buffer[i]);
+        }
+    }
+}
+
+STF_TEST(HexDump, FromHexCase)
+{
+    NetUtil::DataBuffer data_buffer =
+        NetUtil::FromHex("00ff7F80aBcD0123456789abcdefABCDEF0a");
+
+    STF_ASSERT_EQ(18, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(0x00, data_buffer[0]);
+    STF_ASSERT_EQ(0xff, data_buffer[1]);
+    STF_ASSERT_EQ(0x7f, data_buffer[2]);
+    STF_ASSERT_EQ(0x80, data_buffer[3]);
+    STF_ASSERT_EQ(0xab, data_buffer[4]);
+    STF_ASSERT_EQ(0xcd, data_buffer[5]);
+    STF_ASSERT_EQ(0xef, data_buffer[13]);
+    STF_ASSERT_EQ(0xab, data_buffer[14]);
+    STF_ASSERT_EQ(0x0a, data_buffer[17]);
+}
+
+STF_TEST(HexDump, FromHexInvalid)
+{
+    std::string hex(64, '0');
+
+    // Invalid characters are detected in both vector and scalar parsing
+    for (std::size_t i = 0; i < hex.size(); i++)
+    {
+        for (char c : {'g', 'G', '/', ':', '@', '`', ' ', '\xff'})
+        {
+            std::string bad = hex;
+            bad[i] = c;
+
+            auto test_func = [&] { NetUtil::FromHex(bad); };
+            STF_ASSERT_EXCEPTION_E(test_func, NetUtil::DataBufferException);
+        }
+    }
+
+    auto test_odd = [&] { NetUtil::FromHex("abc"); };
+    STF_ASSERT_EXCEPTION_E(test_odd, NetUtil::DataBufferException);
+}
+
+STF_TEST(HexDump, FromHexDump)
+{
+    for (std::size_t length : {0, 1, 15, 16, 17, 100, 256})
+    {
+        std::vector<std::uint8_t> data = TestData(length);
+        std::string text;
+
+        NetUtil::HexDumpTo(std::back_inserter(text), data);
+
+        NetUtil::DataBuffer data_buffer = NetUtil::FromHexDump(text);
+
+        STF_ASSERT_EQ(length, data_buffer.GetDataLength());
+        for (std::size_t i = 0; i < length; i++)
+        {
+            STF_ASSERT_EQ(data[i], data_buffer[i]);
+        }
+    }
+}
+
+STF_TEST(HexDump, FromHexDumpVariations)
+{
+    // CR LF line endings, lowercase digits, empty lines, and an ASCII map
+    // that contains colons and hex digits are all accepted
+    NetUtil::DataBuffer data_buffer = NetUtil::FromHexDump(
+        "00000000: 3a 41 3A 20 :A: :\r\n"
+        "\n"
+        "00000010: ff\n");
+
+    STF_ASSERT_EQ(5, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(0x3a, data_buffer[0]);
+    STF_ASSERT_EQ(0x41, data_buffer[1]);
+    STF_ASSERT_EQ(0x3a, data_buffer[2]);
+    STF_ASSERT_EQ(0x20, data_buffer[3]);
+    STF_ASSERT_EQ(0xff, data_buffer[4]);
+
+    auto test_colon = [&] { NetUtil::FromHexDump("00000000 41 42\n"); };
+    auto test_digit = [&] { NetUtil::FromHexDump("00000000: 41 4G\n"); };
+
+    STF_ASSERT_EXCEPTION_E(test_colon, NetUtil::DataBufferException);
+    STF_ASSERT_EXCEPTION_E(test_digit, NetUtil::DataBufferException);
+}
+
+#ifdef __cpp_lib_format
+STF_TEST(HexDump, Format)
+{
+    std::vector<std::uint8_t> data = TestData(100);
+    NetUtil::DataBuffer data_buffer(data.data(), data.size());
+    std::string expected;
+
+    data_buffer.SetDataLength(data.size());
+    data_buffer.AdvanceReadPosition(1);
+
+    // The default format is a hex dump of the unread data
+    NetUtil::HexDumpTo(std::back_inserter(expected),
+                       std::span(data).subspan(1));
+    STF_ASSERT_EQ(expected, std::format("{}", data_buffer));
+    STF_ASSERT_EQ(expected, std::format("{:d}", data_buffer));
+
+    // Compact hex is rendered in chunks, so check a long buffer
+    std::string hex = std::format("{:x}", data_buffer);
+    STF_ASSERT_EQ(198, hex.size());
+    STF_ASSERT_EQ(std::string("2a4f74"), hex.substr(0, 6));
+    STF_ASSERT_TRUE(NetUtil::FromHex(hex) ==
+                    NetUtil::FromHex(std::format("{:X}", data_buffer)));
+    STF_ASSERT_EQ(std::string("2A4F74"),
+                  std::format("{:X}", data_buffer).substr(0, 6));
+}
+#endif
@@ -0,0 +1,277 @@
+/*
+ *  test_internet_checksum.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the Internet checksum functions.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <terra/netutil/internet_checksum.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+namespace
+{
+
+// Straightforward computation of the checksum per RFC 1071
+std::uint16_t ReferenceChecksum(const std::vector<std::uint8_t> &data)
+{
+    std::uint32_t sum = 0;
+
+    for (std::size_t i = 0; i < data.size(); i += 2)
+    {
+        sum += static_cast<std::uint32_t>(data[i]) << 8;
+        if ((i + 1) < data.size()) sum += data[i + 1];
+    }
+
+    while ((sum >> 16) != 0) sum = (sum & 0xffff) + (sum >> 16);
+
+    return static_cast<std::uint16_t>(~sum);
+}
+
+// IPv4 header (RFC 791) with the checksum field set to zero
+constexpr std::array<std::uint8_t, 20> IPv4_Header =
+{
+    0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x40, 0x11,
+    0x00, 0x00, 0xc0, 0xa8, 0x00, 0x01, 0xc0, 0xa8, 0x00, 0xc7
+};
+
+} // namespace
+
+STF_TEST(InternetChecksum, RFC1071Example)
+{
+    // Example from section 3 of RFC 1071
+    std::array<std::uint8_t, 8> data =
+    {
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7
+    };
+
+    STF_ASSERT_EQ(0xddf2, NetUtil::OnesComplementSum(data));
+    STF_ASSERT_EQ(0x220d, NetUtil::InternetChecksum(data));
+
+    // Summing in pieces produces the same result
+    std::uint16_t sum = NetUtil::OnesComplementSum(std::span(data).first(2));
+    sum = NetUtil::OnesComplementSum(std::span(data).subspan(2), sum);
+    STF_ASSERT_EQ(0xddf2, sum);
+}
+
+STF_TEST(InternetChecksum, Empty)
+{
+    NetUtil::DataBuffer data_buffer(8);
+
+    STF_ASSERT_EQ(0xffff, NetUtil::InternetChecksum({}));
+    STF_ASSERT_EQ(0xffff, NetUtil::InternetChecksum(data_buffer, 8, 0));
+}
+
+STF_TEST(InternetChecksum, IPv4Header)
+{
+    std::array<std::uint8_t, 20> header = IPv4_Header;
+    NetUtil::DataBuffer data_buffer(header.data(), header.size());
+    std::uint16_t checksum{};
+
+    checksum = NetUtil::InternetChecksum(data_buffer, 0, header.size());
+    STF_ASSERT_EQ(0xb861, checksum);
+
+    // Verifying a header that includes the checksum produces zero
+    data_buffer.SetValue(checksum, 10);
+    STF_ASSERT_EQ(0, NetUtil::InternetChecksum(data_buffer, 0, header.size()));
+}
+
+STF_TEST(InternetChecksum, OddLength)
+{
+    std::array<std::uint8_t, 3> data = {0x01, 0x02, 0x03};
+
+    // The final octet is summed as though followed by a zero octet
+    STF_ASSERT_EQ(static_cast<std::uint16_t>(~(0x0102 + 0x0300)),
+                  NetUtil::InternetChecksum(data));
+}
+
+STF_TEST(InternetChecksum, VariousLengthsAndOffsets)
+{
+    std::vector<std::uint8_t> data(1024);
+    std::uint32_t state = 1;
+
+    // Fill with pseudo-random values, including runs of 0xff octets that
+    // produce many carries
+    for (std::size_t i = 0; i < data.size(); i++)
+    {
+        state = (state * 1103515245) + 12345;
+        data[i] = ((i / 256) == 2) ? 0xff
+                                   : static_cast<std::uint8_t>(state >> 16);
+    }
+
+    NetUtil::DataBuffer data_buffer(data.data(), data.size());
+
+    for (std::size_t offset = 0; offset < 8; offset++)
+    {
+        for (std::size_t length = 0; length < 300; length++)
+        {
+            std::vector<std::uint8_t> expected(data.begin() + offset,
+                                               data.begin() + offset + length);
+
+            STF_ASSERT_EQ(ReferenceChecksum(expected),
+                          NetUtil::InternetChecksum(data_buffer,
+                                                    offset,
+                                                    length));
+        }
+    }
+
+    for (std::size_t offset = 0; offset < data.size(); offset += 127)
+    {
+        std::vector<std::uint8_t> expected(data.begin() + offset, data.end());
+
+        STF_ASSERT_EQ(ReferenceChecksum(expected),
+                      NetUtil::InternetChecksum(data_buffer,
+                                                offset,
+                                                data.size() - offset));
+    }
+}
+
+STF_TEST(InternetChecksum, AllOnes)
+{
+    std::vector<std::uint8_t> data(65536, 0xff);
+
+    STF_ASSERT_EQ(0xffff, NetUtil::OnesComplementSum(data));
+    STF_ASSERT_EQ(0, NetUtil::InternetChecksum(data));
+}
+
+STF_TEST(InternetChecksum, OutOfRange)
+{
+    NetUtil::DataBuffer data_buffer(16);
+
+    auto test_length = [&] { NetUtil::InternetChecksum(data_buffer, 8, 9); };
+    auto test_offset = [&] { NetUtil::InternetChecksum(data_buffer, 17, 0); };
+
+    STF_ASSERT_EXCEPTION_E(test_length, NetUtil::DataBufferException);
+    STF_ASSERT_EXCEPTION_E(test_offset, NetUtil::DataBufferException);
+}
+
+STF_TEST(InternetChecksum, IPv4PseudoHeader)
+{
+    NetUtil::NetworkAddress source("192.0.2.1", 1234);
+    NetUtil::NetworkAddress destination("198.51.100.2", 53);
+    NetUtil::DataBuffer data_buffer(64);
+    std::vector<std::uint8_t> expected =
+    {
+        192, 0, 2, 1, 198, 51, 100, 2, 0, 17, 0, 13
+    };
+
+    // UDP header followed by five octets of payload
+    data_buffer << std::uint16_t(1234) << std::uint16_t(53)
+                << std::uint16_t(13) << std::uint16_t(0);
+    data_buffer << std::uint8_t('h') << std::uint8_t('e') << std::uint8_t('l')
+                << std::uint8_t('l') << std::uint8_t('o');
+
+    for (std::size_t i = 0; i < 13; i++) expected.push_back(data_buffer[i]);
+
+    std::uint16_t checksum = NetUtil::InternetChecksum(data_buffer,
+                                                       0,
+                                                       13,
+                                                       source,
+                                                       destination,
+                                                       17);
+    STF_ASSERT_EQ(ReferenceChecksum(expected), checksum);
+
+    // Verifying the datagram that includes the checksum produces zero
+    data_buffer.SetValue(checksum, 6);
+    STF_ASSERT_EQ(0,
+                  NetUtil::InternetChecksum(data_buffer,
+                                            0,
+                                            13,
+                                            source,
+                                            destination,
+                                            17));
+}
+
+STF_TEST(InternetChecksum, IPv6PseudoHeader)
+{
+    NetUtil::NetworkAddress source("2001:db8::1");
+    NetUtil::NetworkAddress destination("2001:db8::2");
+    NetUtil::DataBuffer data_buffer(64);
+    std::vector<std::uint8_t> expected =
+    {
+        0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+        0, 0, 0, 12, 0, 0, 0, 17
+    };
+
+    data_buffer << std::uint16_t(5000) << std::uint16_t(6000)
+                << std::uint16_t(12) << std::uint16_t(0)
+                << std::uint32_t(0xdeadbeef);
+
+    for (std::size_t i = 0; i < 12; i++) expected.push_back(data_buffer[i]);
+
+    STF_ASSERT_EQ(ReferenceChecksum(expected),
+                  NetUtil::InternetChecksum(data_buffer,
+                                            0,
+                                            12,
+                                            source,
+                                            destination,
+                                            17));
+}
+
+STF_TEST(InternetChecksum, PseudoHeaderMismatch)
+{
+    NetUtil::NetworkAddress source("192.0.2.1");
+    NetUtil::NetworkAddress destination("2001:db8::2");
+    NetUtil::NetworkAddress unknown;
+    NetUtil::DataBuffer data_buffer(8);
+
+    auto test_mismatch = [&]
+    {
+        NetUtil::InternetChecksum(data_buffer, 0, 8, source, destination, 17);
+    };
+    auto test_unknown = [&]
+    {
+        NetUtil::InternetChecksum(data_buffer, 0, 8, unknown, unknown, 17);
+    };
+
+    STF_ASSERT_EXCEPTION_E(test_mismatch, NetUtil::DataBufferException);
+    STF_ASSERT_EXCEPTION_E(test_unknown, NetUtil::DataBufferException);
+}
+
+STF_TEST(InternetChecksum, UpdateChecksum)
+{
+    std::array<std::uint8_t, 20> header = IPv4_Header;
+    NetUtil::DataBuffer data_buffer(header.data(), header.size());
+    std::uint16_t checksum = NetUtil::InternetChecksum(data_buffer, 0, 20);
+    std::uint16_t old_value{};
+    std::uint32_t old_address{};
+
+    data_buffer.SetValue(checksum, 10);
+
+    // Decrement the TTL, which shares a 16-bit value with the protocol
+    data_buffer.GetValue(old_value, 8);
+    data_buffer.SetValue(static_cast<std::uint16_t>(old_value - 0x0100), 8);
+    checksum = NetUtil::UpdateChecksum(
+        checksum,
+        old_value,
+        static_cast<std::uint16_t>(old_value - 0x0100));
+    data_buffer.SetValue(std::uint16_t(0), 10);
+    STF_ASSERT_EQ(NetUtil::InternetChecksum(data_buffer, 0, 20), checksum);
+    data_buffer.SetValue(checksum, 10);
+
+    // Translate the source address
+    data_buffer.GetValue(old_address, 12);
+    data_buffer.SetValue(std::uint32_t(0x0a000001), 12);
+    checksum = NetUtil::UpdateChecksum(checksum,
+                                       old_address,
+                                       std::uint32_t(0x0a000001));
+    data_buffer.SetValue(std::uint16_t(0), 10);
+    STF_ASSERT_EQ(NetUtil::InternetChecksum(data_buffer, 0, 20), checksum);
+    data_buffer.SetValue(checksum, 10);
+    STF_ASSERT_EQ(0, NetUtil::InternetChecksum(data_buffer, 0, 20));
+}
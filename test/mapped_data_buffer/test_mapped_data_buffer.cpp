@@ -0,0 +1,249 @@
+/*
+ *  test_mapped_data_buffer.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the MappedDataBuffer object.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <terra/netutil/data_cursor.h>
+#include <terra/netutil/mapped_data_buffer.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+namespace
+{
+
+// Produce a path for a temporary file unique to this process
+std::filesystem::path TempPath(const std::string &name)
+{
+    return std::filesystem::temp_directory_path() /
+           ("netutil_" + std::to_string(getpid()) + "_" + name);
+}
+
+// Write the contents of the given DataBuffer to a file
+void WriteFile(const std::filesystem::path &path,
+               const NetUtil::DataBuffer &data_buffer)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(data_buffer.GetBufferPointer()),
+               static_cast<std::streamsize>(data_buffer.GetDataLength()));
+}
+
+} // namespace
+
+STF_TEST(TestMappedDataBuffer, ReadFile)
+{
+    const auto path = TempPath("read");
+    NetUtil::DataBuffer data_buffer(64);
+    std::uint8_t u8{};
+    std::uint16_t u16{};
+    std::uint32_t u32{};
+    std::uint64_t u64{};
+    double d{};
+
+    data_buffer << std::uint8_t(0x01) << std::uint16_t(0x0203)
+                << std::uint32_t(0x04050607)
+                << std::uint64_t(0x08090a0b0c0d0e0f) << double(-2.75);
+    WriteFile(path, data_buffer);
+
+    {
+        NetUtil::MappedDataBuffer mapped(path);
+
+        STF_ASSERT_TRUE(mapped.IsOpen());
+        STF_ASSERT_TRUE(mapped.GetMode() == NetUtil::MappedFileMode::Read);
+        STF_ASSERT_EQ(23, mapped.GetDataLength());
+        STF_ASSERT_EQ(23, mapped.GetBufferSize());
+
+        mapped >> u8 >> u16 >> u32 >> u64 >> d;
+
+        STF_ASSERT_EQ(0x01, u8);
+        STF_ASSERT_EQ(0x0203, u16);
+        STF_ASSERT_EQ(0x04050607, u32);
+        STF_ASSERT_EQ(0x08090a0b0c0d0e0f, u64);
+        STF_ASSERT_EQ(-2.75, d);
+        STF_ASSERT_EQ(0, mapped.GetUnreadLength());
+
+        mapped.GetValue(u16, 1);
+        STF_ASSERT_EQ(0x0203, u16);
+        STF_ASSERT_TRUE(mapped.TryReadValue(u8) ==
+                        NetUtil::DataBufferStatus::BeyondDataLength);
+
+        // Changes are private to the process
+        mapped.SetValue(std::uint8_t(0xff), 0);
+        STF_ASSERT_EQ(0xff, mapped[0]);
+    }
+
+    {
+        NetUtil::MappedDataBuffer mapped(path);
+        STF_ASSERT_EQ(0x01, mapped[0]);
+        STF_ASSERT_EQ(23, std::filesystem::file_size(path));
+    }
+
+    std::filesystem::remove(path);
+}
+
+STF_TEST(TestMappedDataBuffer, WriteFile)
+{
+    const auto path = TempPath("write");
+    bool exception_caught = false;
+    std::uint16_t u16{};
+    std::uint32_t u32{};
+
+    std::filesystem::remove(path);
+
+    {
+        NetUtil::MappedDataBuffer mapped(path,
+                                         NetUtil::MappedFileMode::ReadWrite,
+                                         4096);
+
+        STF_ASSERT_EQ(4096, mapped.GetBufferSize());
+        STF_ASSERT_EQ(0, mapped.GetDataLength());
+
+        mapped << std::uint16_t(0x0102) << std::uint32_t(0x03040506);
+        mapped.Sync();
+        STF_ASSERT_EQ(6, mapped.GetDataLength());
+
+        // The file retains its capacity until closed
+        STF_ASSERT_EQ(4096, std::filesystem::file_size(path));
+        mapped.Close();
+        STF_ASSERT_FALSE(mapped.IsOpen());
+        STF_ASSERT_EQ(0, mapped.GetBufferSize());
+    }
+
+    STF_ASSERT_EQ(6, std::filesystem::file_size(path));
+
+    // Reopening without additional capacity appends nothing
+    {
+        NetUtil::MappedDataBuffer mapped(path,
+                                         NetUtil::MappedFileMode::ReadWrite);
+
+        STF_ASSERT_EQ(6, mapped.GetBufferSize());
+        STF_ASSERT_EQ(6, mapped.GetDataLength());
+
+        try
+        {
+            mapped.AppendValue(std::uint8_t(0x07));
+        }
+        catch (const NetUtil::DataBufferException &)
+        {
+            exception_caught = true;
+        }
+
+        STF_ASSERT_TRUE(exception_caught);
+
+        // Modify a value in place and shorten the file
+        mapped.SetValue(std::uint16_t(0x0a0b), 0);
+        mapped.SetDataLength(4);
+    }
+
+    STF_ASSERT_EQ(4, std::filesystem::file_size(path));
+
+    {
+        NetUtil::MappedDataBuffer mapped(path);
+        NetUtil::DataReader reader(mapped.GetDataBuffer(), 4);
+
+        reader >> u16;
+        STF_ASSERT_EQ(0x0a0b, u16);
+        reader.Commit();
+
+        STF_ASSERT_EQ(2, mapped.GetReadPosition());
+        STF_ASSERT_TRUE(mapped.TryReadValue(u32) ==
+                        NetUtil::DataBufferStatus::BeyondDataLength);
+    }
+
+    std::filesystem::remove(path);
+}
+
+STF_TEST(TestMappedDataBuffer, AdviseAndRelease)
+{
+    const auto path = TempPath("release");
+    NetUtil::DataBuffer data_buffer(65536);
+    std::uint32_t value{};
+
+    for (std::uint32_t i = 0; i < 16384; i++) data_buffer << i;
+    WriteFile(path, data_buffer);
+
+    {
+        NetUtil::MappedDataBuffer mapped(path);
+
+        STF_ASSERT_TRUE(mapped.Advise(NetUtil::MappedFileAdvice::Sequential));
+        STF_ASSERT_TRUE(mapped.Advise(NetUtil::MappedFileAdvice::WillNeed,
+                                      1000,
+                                      5000));
+        STF_ASSERT_FALSE(mapped.Advise(NetUtil::MappedFileAdvice::Normal,
+                                       65536));
+
+        for (std::uint32_t i = 0; i < 16384; i++)
+        {
+            mapped >> value;
+            STF_ASSERT_EQ(i, value);
+            if ((i % 1024) == 0) mapped.Release();
+        }
+        mapped.Release();
+
+        // Released pages remain accessible
+        mapped.SetReadPosition(0);
+        for (std::uint32_t i = 0; i < 16384; i++)
+        {
+            mapped >> value;
+            STF_ASSERT_EQ(i, value);
+        }
+    }
+
+    std::filesystem::remove(path);
+}
+
+STF_TEST(TestMappedDataBuffer, EmptyFile)
+{
+    const auto path = TempPath("empty");
+
+    WriteFile(path, NetUtil::DataBuffer());
+
+    {
+        NetUtil::MappedDataBuffer mapped(path);
+
+        STF_ASSERT_TRUE(mapped.IsOpen());
+        STF_ASSERT_TRUE(mapped.Empty());
+        STF_ASSERT_EQ(0, mapped.GetBufferSize());
+        STF_ASSERT_FALSE(mapped.Advise(NetUtil::MappedFileAdvice::Sequential));
+        mapped.Release();
+        mapped.Sync();
+    }
+
+    std::filesystem::remove(path);
+}
+
+STF_TEST(TestMappedDataBuffer, MissingFile)
+{
+    const auto path = TempPath("missing");
+    bool exception_caught = false;
+
+    std::filesystem::remove(path);
+
+    try
+    {
+        NetUtil::MappedDataBuffer mapped(path);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+}
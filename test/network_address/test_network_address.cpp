@@ -15,10 +15,12 @@
  *      None.
  */
 
+#include <array>
 #include <map>
 #include <unordered_map>
 #include <sstream>
 #include <terra/netutil/network_address.h>
+#include <terra/netutil/formatters.h>
 #include <terra/stf/stf.h>
 
 using namespace Terra;
@@ -303,3 +305,67 @@ STF_TEST(NetworkAddress, AddressReassignment)
         STF_ASSERT_EQ(std::string("[fd88::5]"), oss.str());
     }
 }
+
+STF_TEST(NetworkAddress, AddressStyles)
+{
+    NetUtil::NetworkAddress ipv4("192.0.2.1", 80);
+    NetUtil::NetworkAddress ipv6("2001:db8::1", 0);
+    NetUtil::NetworkAddress empty;
+    std::array<char, NetUtil::Network_Address_Max_Length> buffer{};
+
+    auto text = [&](const NetUtil::NetworkAddress &address,
+                    NetUtil::NetworkAddressStyle style)
+    {
+        return std::string(buffer.data(), address.GetAddress(buffer, style));
+    };
+
+    STF_ASSERT_EQ(std::string("192.0.2.1"),
+                  text(ipv4, NetUtil::NetworkAddressStyle::Address));
+    STF_ASSERT_EQ(std::string("192.0.2.1"),
+                  text(ipv4, NetUtil::NetworkAddressStyle::Bracketed));
+    STF_ASSERT_EQ(std::string("192.0.2.1:80"),
+                  text(ipv4, NetUtil::NetworkAddressStyle::Default));
+    STF_ASSERT_EQ(std::string("192.0.2.1:80"),
+                  text(ipv4, NetUtil::NetworkAddressStyle::AddressPort));
+
+    STF_ASSERT_EQ(std::string("2001:db8::1"),
+                  text(ipv6, NetUtil::NetworkAddressStyle::Address));
+    STF_ASSERT_EQ(std::string("[2001:db8::1]"),
+                  text(ipv6, NetUtil::NetworkAddressStyle::Bracketed));
+    STF_ASSERT_EQ(std::string("[2001:db8::1]"),
+                  text(ipv6, NetUtil::NetworkAddressStyle::Default));
+    STF_ASSERT_EQ(std::string("[2001:db8::1]:0"),
+                  text(ipv6, NetUtil::NetworkAddressStyle::AddressPort));
+
+    STF_ASSERT_EQ(std::string(""),
+                  text(empty, NetUtil::NetworkAddressStyle::Default));
+
+    // A long address and port fit in the buffer
+    NetUtil::NetworkAddress longest("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff",
+                                    65535);
+    STF_ASSERT_EQ(std::string("[ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff]"
+                              ":65535"),
+                  text(longest, NetUtil::NetworkAddressStyle::Default));
+
+    // Nothing is written if the buffer is too small
+    STF_ASSERT_EQ(0, ipv4.GetAddress(std::span(buffer).first(11),
+                                     NetUtil::NetworkAddressStyle::Default));
+    STF_ASSERT_EQ(12, ipv4.GetAddress(std::span(buffer).first(12),
+                                      NetUtil::NetworkAddressStyle::Default));
+}
+
+#ifdef __cpp_lib_format
+STF_TEST(NetworkAddress, Format)
+{
+    NetUtil::NetworkAddress ipv4("192.0.2.1", 80);
+    NetUtil::NetworkAddress ipv6("2001:db8::1", 443);
+
+    STF_ASSERT_EQ(std::string("192.0.2.1:80"), std::format("{}", ipv4));
+    STF_ASSERT_EQ(std::string("[2001:db8::1]:443"), std::format("{}", ipv6));
+    STF_ASSERT_EQ(std::string("2001:db8::1"), std::format("{:a}", ipv6));
+    STF_ASSERT_EQ(std::string("[2001:db8::1]"), std::format("{:b}", ipv6));
+    STF_ASSERT_EQ(std::string("[2001:db8::1]:443"),
+                  std::format("{:p}", ipv6));
+    STF_ASSERT_EQ(std::string("<192.0.2.1>"), std::format("<{:a}>", ipv4));
+}
+#endif
@@ -0,0 +1,203 @@
+/*
+ *  test_ring_data_buffer.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the RingDataBuffer object.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+#include <unistd.h>
+#include <terra/netutil/ring_data_buffer.h>
+#include <terra/netutil/data_cursor.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+STF_TEST(TestRingDataBuffer, BufferSize)
+{
+    NetUtil::RingDataBuffer ring_buffer(100);
+    const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+    STF_ASSERT_EQ(page_size, ring_buffer.GetBufferSize());
+    STF_ASSERT_EQ(page_size, ring_buffer.GetFreeLength());
+    STF_ASSERT_EQ(0, ring_buffer.GetUnreadLength());
+    STF_ASSERT_TRUE(ring_buffer.Empty());
+}
+
+STF_TEST(TestRingDataBuffer, WrapAround)
+{
+    NetUtil::RingDataBuffer ring_buffer(1);
+    const std::size_t size = ring_buffer.GetBufferSize();
+    std::uint32_t value{};
+
+    // Repeatedly append and read values so values straddle the buffer end
+    for (std::uint32_t i = 0; i < (size / 2); i++)
+    {
+        ring_buffer << std::uint32_t(i) << std::uint16_t(i);
+        ring_buffer << std::uint8_t(i);
+
+        std::uint16_t u16{};
+        std::uint8_t u8{};
+        ring_buffer >> value >> u16 >> u8;
+
+        STF_ASSERT_EQ(i, value);
+        STF_ASSERT_EQ(static_cast<std::uint16_t>(i), u16);
+        STF_ASSERT_EQ(static_cast<std::uint8_t>(i), u8);
+    }
+
+    STF_ASSERT_TRUE(ring_buffer.Empty());
+}
+
+STF_TEST(TestRingDataBuffer, ContiguousSpans)
+{
+    NetUtil::RingDataBuffer ring_buffer(1);
+    const std::size_t size = ring_buffer.GetBufferSize();
+    std::vector<std::uint8_t> octets(size - 10, 0x11);
+
+    // Position the read position near the end of the buffer
+    ring_buffer.AppendValue(std::span<const std::uint8_t>(octets));
+    ring_buffer.AdvanceReadPosition(octets.size());
+
+    // The free space wraps, but is contiguous
+    std::span<std::uint8_t> free_span = ring_buffer.GetFreeSpan();
+    STF_ASSERT_EQ(size, free_span.size());
+    for (std::size_t i = 0; i < 20; i++)
+    {
+        free_span[i] = static_cast<std::uint8_t>(i);
+    }
+    ring_buffer.AdvanceDataLength(20);
+
+    // The unread data wraps, but is contiguous
+    std::span<std::uint8_t> data_span = ring_buffer.GetBufferSpan();
+    STF_ASSERT_EQ(20, data_span.size());
+    for (std::size_t i = 0; i < 20; i++)
+    {
+        STF_ASSERT_EQ(i, data_span[i]);
+    }
+
+    STF_ASSERT_EQ(size - 20, ring_buffer.GetFreeLength());
+}
+
+STF_TEST(TestRingDataBuffer, Full)
+{
+    NetUtil::RingDataBuffer ring_buffer(1);
+    const std::size_t size = ring_buffer.GetBufferSize();
+    std::vector<std::uint8_t> octets(size - 2, 0x22);
+    std::uint16_t value{};
+    bool exception_caught = false;
+
+    ring_buffer.AppendValue(std::span<const std::uint8_t>(octets));
+    ring_buffer << std::uint16_t(0x0102);
+    STF_ASSERT_EQ(0, ring_buffer.GetFreeLength());
+
+    // Appending to a full buffer must not overwrite unread data
+    try
+    {
+        ring_buffer << std::uint8_t(0);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondBuffer,
+                  ring_buffer.TryAppendValue(std::uint8_t(0)));
+
+    // Reading makes space available
+    ring_buffer.AdvanceReadPosition(octets.size());
+    ring_buffer << std::uint16_t(0x0304);
+    ring_buffer >> value;
+    STF_ASSERT_EQ(0x0102, value);
+    ring_buffer >> value;
+    STF_ASSERT_EQ(0x0304, value);
+    STF_ASSERT_TRUE(ring_buffer.Empty());
+
+    exception_caught = false;
+    try
+    {
+        ring_buffer.AdvanceDataLength(size + 1);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+}
+
+STF_TEST(TestRingDataBuffer, Pipe)
+{
+    NetUtil::RingDataBuffer ring_buffer(1);
+    const std::size_t size = ring_buffer.GetBufferSize();
+    std::vector<std::uint8_t> message(size / 3);
+    int fds[2];
+
+    STF_ASSERT_EQ(0, pipe(fds));
+
+    for (std::size_t i = 0; i < message.size(); i++)
+    {
+        message[i] = static_cast<std::uint8_t>(i * 7);
+    }
+
+    // Receive and consume enough messages to wrap several times
+    for (std::size_t i = 0; i < 10; i++)
+    {
+        STF_ASSERT_EQ(static_cast<ssize_t>(message.size()),
+                      write(fds[1], message.data(), message.size()));
+
+        std::span<std::uint8_t> free_span = ring_buffer.GetFreeSpan();
+        ssize_t received = read(fds[0], free_span.data(), free_span.size());
+        STF_ASSERT_EQ(static_cast<ssize_t>(message.size()), received);
+        ring_buffer.AdvanceDataLength(static_cast<std::size_t>(received));
+
+        std::span<std::uint8_t> data_span = ring_buffer.GetBufferSpan();
+        STF_ASSERT_EQ(message.size(), data_span.size());
+        STF_ASSERT_EQ(0, std::memcmp(data_span.data(),
+                                     message.data(),
+                                     message.size()));
+        ring_buffer.AdvanceReadPosition(data_span.size());
+    }
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+STF_TEST(TestRingDataBuffer, Cursors)
+{
+    NetUtil::RingDataBuffer ring_buffer(1);
+    const std::size_t size = ring_buffer.GetBufferSize();
+    std::vector<std::uint8_t> octets(size - 3, 0x33);
+    std::uint64_t value{};
+
+    ring_buffer.AppendValue(std::span<const std::uint8_t>(octets));
+    ring_buffer.AdvanceReadPosition(octets.size());
+
+    {
+        NetUtil::DataWriter writer(ring_buffer.GetDataBuffer(), 8);
+        writer << std::uint64_t(0x0102030405060708);
+        writer.Commit();
+    }
+
+    {
+        NetUtil::DataReader reader(ring_buffer.GetDataBuffer(), 8);
+        reader >> value;
+        reader.Commit();
+    }
+
+    STF_ASSERT_EQ(0x0102030405060708, value);
+    STF_ASSERT_TRUE(ring_buffer.Empty());
+}
@@ -0,0 +1,223 @@
+/*
+ *  test_shared_data_buffer.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the SharedDataBuffer object.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <terra/netutil/shared_data_buffer.h>
+#include <terra/netutil/small_data_buffer.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+namespace
+{
+
+// Produce a DataBuffer containing a short message
+NetUtil::DataBuffer MakeMessage()
+{
+    NetUtil::DataBuffer data_buffer(32);
+
+    data_buffer << std::uint16_t(0x0102) << std::uint32_t(0x03040506)
+                << std::uint16_t(0x0708);
+
+    return data_buffer;
+}
+
+} // namespace
+
+STF_TEST(TestSharedDataBuffer, DefaultConstructor)
+{
+    NetUtil::SharedDataBuffer shared;
+
+    STF_ASSERT_EQ(0, shared.GetDataLength());
+    STF_ASSERT_TRUE(shared.Empty());
+    STF_ASSERT_EQ(0, shared.GetUseCount());
+    STF_ASSERT_EQ(nullptr, shared.GetBufferPointer());
+}
+
+STF_TEST(TestSharedDataBuffer, MoveConstructorNoCopy)
+{
+    NetUtil::DataBuffer data_buffer = MakeMessage();
+    const std::uint8_t *pointer = data_buffer.GetBufferPointer();
+
+    NetUtil::SharedDataBuffer shared(std::move(data_buffer));
+
+    STF_ASSERT_EQ(pointer, shared.GetBufferPointer());
+    STF_ASSERT_EQ(8, shared.GetDataLength());
+    STF_ASSERT_EQ(1, shared.GetUseCount());
+}
+
+STF_TEST(TestSharedDataBuffer, CopyConstructorFromDataBuffer)
+{
+    NetUtil::DataBuffer data_buffer = MakeMessage();
+
+    NetUtil::SharedDataBuffer shared(data_buffer);
+
+    STF_ASSERT_NE(data_buffer.GetBufferPointer(), shared.GetBufferPointer());
+    STF_ASSERT_TRUE(data_buffer == shared.GetDataBuffer());
+}
+
+STF_TEST(TestSharedDataBuffer, InlineSource)
+{
+    NetUtil::SmallDataBuffer<16> small_buffer;
+
+    small_buffer << std::uint32_t(0x01020304);
+
+    NetUtil::SharedDataBuffer shared(std::move(small_buffer));
+    std::uint32_t value{};
+
+    shared >> value;
+    STF_ASSERT_EQ(0x01020304, value);
+}
+
+STF_TEST(TestSharedDataBuffer, CopyShares)
+{
+    NetUtil::SharedDataBuffer shared(MakeMessage());
+    std::uint16_t value{};
+
+    shared >> value;
+
+    NetUtil::SharedDataBuffer copy = shared;
+
+    STF_ASSERT_EQ(2, shared.GetUseCount());
+    STF_ASSERT_EQ(shared.GetBufferPointer(), copy.GetBufferPointer());
+    STF_ASSERT_EQ(2, copy.GetReadPosition());
+    STF_ASSERT_TRUE(shared == copy);
+
+    // Reading one should not affect the other
+    std::uint32_t value32{};
+    copy >> value32;
+    STF_ASSERT_EQ(0x03040506, value32);
+    STF_ASSERT_EQ(6, copy.GetReadPosition());
+    STF_ASSERT_EQ(2, shared.GetReadPosition());
+
+    // Moving should leave the source empty
+    NetUtil::SharedDataBuffer moved = std::move(copy);
+    STF_ASSERT_EQ(2, moved.GetUseCount());
+    STF_ASSERT_EQ(6, moved.GetReadPosition());
+    STF_ASSERT_TRUE(copy.Empty());
+    STF_ASSERT_EQ(0, copy.GetUseCount());
+}
+
+STF_TEST(TestSharedDataBuffer, SliceOutlivesParent)
+{
+    NetUtil::SharedDataBuffer slice;
+
+    {
+        NetUtil::SharedDataBuffer shared(MakeMessage());
+
+        slice = shared.Slice(2, 4);
+
+        STF_ASSERT_EQ(2, shared.GetUseCount());
+        STF_ASSERT_EQ(shared.GetBufferPointer(2), slice.GetBufferPointer());
+    }
+
+    STF_ASSERT_EQ(1, slice.GetUseCount());
+    STF_ASSERT_EQ(4, slice.GetDataLength());
+
+    std::uint32_t value{};
+    std::uint16_t value16{};
+    slice.GetValue(value16, 2);
+    slice >> value;
+
+    STF_ASSERT_EQ(0x0506, value16);
+    STF_ASSERT_EQ(0x03040506, value);
+    STF_ASSERT_EQ(0, slice.GetUnreadLength());
+
+    // A slice of a slice is relative to the slice
+    NetUtil::SharedDataBuffer tail = slice.Slice(3);
+    STF_ASSERT_EQ(1, tail.GetDataLength());
+    STF_ASSERT_EQ(0x06, tail[0]);
+
+    NetUtil::SharedDataBuffer empty = slice.Slice(4);
+    STF_ASSERT_TRUE(empty.Empty());
+}
+
+STF_TEST(TestSharedDataBuffer, SliceBeyondData)
+{
+    NetUtil::SharedDataBuffer shared(MakeMessage());
+    bool exception_caught = false;
+
+    try
+    {
+        static_cast<void>(shared.Slice(6, 3));
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+
+    exception_caught = false;
+    try
+    {
+        static_cast<void>(shared.Slice(9));
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+}
+
+STF_TEST(TestSharedDataBuffer, ReadBeyondData)
+{
+    NetUtil::SharedDataBuffer shared(MakeMessage());
+    NetUtil::SharedDataBuffer slice = shared.Slice(0, 2);
+    std::uint32_t value{};
+    bool exception_caught = false;
+
+    try
+    {
+        slice >> value;
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+}
+
+STF_TEST(TestSharedDataBuffer, FanOutThreads)
+{
+    NetUtil::SharedDataBuffer shared(MakeMessage());
+    std::vector<std::thread> threads;
+    std::array<std::uint64_t, 8> results{};
+
+    for (std::size_t i = 0; i < results.size(); i++)
+    {
+        threads.emplace_back(
+            [copy = shared, &result = results[i]]() mutable
+            {
+                for (std::size_t j = 0; j < 1000; j++)
+                {
+                    NetUtil::SharedDataBuffer slice = copy.Slice(0);
+                    slice >> result;
+                }
+            });
+    }
+
+    for (auto &thread : threads) thread.join();
+
+    STF_ASSERT_EQ(1, shared.GetUseCount());
+    for (auto result : results) STF_ASSERT_EQ(0x0102030405060708, result);
+}
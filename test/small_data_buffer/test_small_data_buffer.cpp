@@ -0,0 +1,192 @@
+/*
+ *  test_small_data_buffer.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the SmallDataBuffer object.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstdint>
+#include <utility>
+#include <terra/netutil/small_data_buffer.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+STF_TEST(TestSmallDataBuffer, InlineStorage)
+{
+    NetUtil::SmallDataBuffer<128> data_buffer;
+
+    STF_ASSERT_EQ(128, data_buffer.GetInlineSize());
+    STF_ASSERT_EQ(128, data_buffer.GetBufferSize());
+    STF_ASSERT_TRUE(data_buffer.IsInline());
+
+    // Pointer to the buffer must lie within the object itself
+    const std::uint8_t *object_start =
+        reinterpret_cast<const std::uint8_t *>(&data_buffer);
+    STF_ASSERT_TRUE(data_buffer.GetBufferPointer() >= object_start);
+    STF_ASSERT_TRUE(data_buffer.GetBufferPointer() <
+                    object_start + sizeof(data_buffer));
+
+    data_buffer << std::uint32_t(0xcafebabe) << 3.25;
+
+    std::uint32_t value1;
+    double value2;
+
+    data_buffer >> value1 >> value2;
+
+    STF_ASSERT_EQ(0xcafebabe, value1);
+    STF_ASSERT_CLOSE(3.25, value2, 0.001);
+    STF_ASSERT_EQ(12, data_buffer.GetDataLength());
+}
+
+STF_TEST(TestSmallDataBuffer, SmallerThanInline)
+{
+    NetUtil::SmallDataBuffer<128> data_buffer(16);
+
+    STF_ASSERT_EQ(16, data_buffer.GetBufferSize());
+    STF_ASSERT_TRUE(data_buffer.IsInline());
+}
+
+STF_TEST(TestSmallDataBuffer, LargerThanInline)
+{
+    NetUtil::SmallDataBuffer<16> data_buffer(1500);
+
+    STF_ASSERT_EQ(1500, data_buffer.GetBufferSize());
+    STF_ASSERT_FALSE(data_buffer.IsInline());
+
+    data_buffer.SetValue(std::uint16_t(0x1234), 1498);
+    std::uint16_t value;
+    data_buffer.GetValue(value, 1498);
+    STF_ASSERT_EQ(0x1234, value);
+}
+
+STF_TEST(TestSmallDataBuffer, Spill)
+{
+    NetUtil::SmallDataBuffer<8> data_buffer(8, true);
+
+    data_buffer << std::uint32_t(0x01020304) << std::uint32_t(0x05060708);
+    STF_ASSERT_TRUE(data_buffer.IsInline());
+
+    // Appending beyond the inline storage moves the data to the heap
+    data_buffer << std::uint32_t(0x090a0b0c);
+    STF_ASSERT_FALSE(data_buffer.IsInline());
+    STF_ASSERT_EQ(12, data_buffer.GetDataLength());
+
+    for (std::uint8_t i = 0; i < 12; i++)
+    {
+        STF_ASSERT_EQ(i + 1, data_buffer[i]);
+    }
+
+    // Shrinking the buffer moves the data back to inline storage
+    data_buffer.Resize(8);
+    STF_ASSERT_TRUE(data_buffer.IsInline());
+    STF_ASSERT_EQ(8, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(8, data_buffer[7]);
+}
+
+STF_TEST(TestSmallDataBuffer, NotGrowable)
+{
+    NetUtil::SmallDataBuffer<4> data_buffer;
+    bool exception_caught = false;
+
+    data_buffer << std::uint32_t(0);
+
+    try
+    {
+        data_buffer << std::uint8_t(0);
+    }
+    catch (const NetUtil::DataBufferException &)
+    {
+        exception_caught = true;
+    }
+
+    STF_ASSERT_TRUE(exception_caught);
+}
+
+STF_TEST(TestSmallDataBuffer, Copy)
+{
+    NetUtil::SmallDataBuffer<32> data_buffer(32);
+
+    data_buffer << std::uint32_t(0xcafebabe);
+
+    NetUtil::SmallDataBuffer<32> data_buffer2(data_buffer);
+    STF_ASSERT_TRUE(data_buffer2.IsInline());
+    STF_ASSERT_NE(data_buffer.GetBufferPointer(),
+                  data_buffer2.GetBufferPointer());
+    STF_ASSERT_TRUE(data_buffer == data_buffer2);
+
+    // Copying to an ordinary DataBuffer allocates from the heap
+    NetUtil::DataBuffer data_buffer3(data_buffer);
+    STF_ASSERT_TRUE(data_buffer == data_buffer3);
+
+    // Copying from an ordinary DataBuffer uses inline storage if possible
+    NetUtil::SmallDataBuffer<32> data_buffer4;
+    data_buffer4 = data_buffer3;
+    STF_ASSERT_TRUE(data_buffer4.IsInline());
+    STF_ASSERT_TRUE(data_buffer == data_buffer4);
+}
+
+STF_TEST(TestSmallDataBuffer, MoveInline)
+{
+    NetUtil::SmallDataBuffer<32> data_buffer(32);
+
+    data_buffer << std::uint32_t(0xcafebabe) << std::uint16_t(0x1234);
+
+    std::uint8_t value;
+    data_buffer >> value;
+
+    NetUtil::SmallDataBuffer<32> data_buffer2(std::move(data_buffer));
+
+    // The contents are copied into the new object's inline storage
+    STF_ASSERT_TRUE(data_buffer2.IsInline());
+    STF_ASSERT_EQ(32, data_buffer2.GetBufferSize());
+    STF_ASSERT_EQ(6, data_buffer2.GetDataLength());
+    STF_ASSERT_EQ(1, data_buffer2.GetReadPosition());
+    STF_ASSERT_EQ(0xfe, data_buffer2[1]);
+
+    // The original object is left empty
+    STF_ASSERT_EQ(0, data_buffer.GetBufferSize());
+    STF_ASSERT_EQ(0, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(nullptr, data_buffer.GetBufferPointer());
+
+    // Moving to an ordinary DataBuffer must copy to the heap
+    NetUtil::DataBuffer data_buffer3(std::move(data_buffer2));
+    STF_ASSERT_EQ(32, data_buffer3.GetBufferSize());
+    STF_ASSERT_EQ(6, data_buffer3.GetDataLength());
+    STF_ASSERT_EQ(0x34, data_buffer3[5]);
+    STF_ASSERT_EQ(nullptr, data_buffer2.GetBufferPointer());
+
+    // Move assignment from the heap back into a SmallDataBuffer
+    NetUtil::SmallDataBuffer<32> data_buffer4;
+    std::uint8_t *heap_pointer = data_buffer3.GetBufferPointer();
+    data_buffer4 = std::move(data_buffer3);
+    STF_ASSERT_FALSE(data_buffer4.IsInline());
+    STF_ASSERT_EQ(heap_pointer, data_buffer4.GetBufferPointer());
+    STF_ASSERT_EQ(6, data_buffer4.GetDataLength());
+}
+
+STF_TEST(TestSmallDataBuffer, MoveHeap)
+{
+    NetUtil::SmallDataBuffer<8> data_buffer(64);
+
+    data_buffer << std::uint64_t(0x0102030405060708);
+    std::uint8_t *heap_pointer = data_buffer.GetBufferPointer();
+
+    // A heap buffer is transferred rather than copied
+    NetUtil::SmallDataBuffer<8> data_buffer2;
+    data_buffer2 = std::move(data_buffer);
+
+    STF_ASSERT_EQ(heap_pointer, data_buffer2.GetBufferPointer());
+    STF_ASSERT_EQ(8, data_buffer2.GetDataLength());
+    STF_ASSERT_EQ(nullptr, data_buffer.GetBufferPointer());
+}
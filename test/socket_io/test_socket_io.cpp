@@ -0,0 +1,346 @@
+/*
+ *  test_socket_io.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements unit tests for the functions that send and
+ *      receive data between a socket and a DataBuffer.  Datagrams are sent
+ *      over the loopback interface.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <terra/netutil/socket_io.h>
+#include <terra/stf/stf.h>
+
+using namespace Terra;
+
+namespace
+{
+
+// Create a UDP socket bound to an ephemeral loopback port
+int CreateSocket(NetUtil::NetworkAddress &address)
+{
+    NetUtil::NetworkAddress loopback("127.0.0.1");
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+
+    if (fd < 0) return fd;
+
+    if (bind(fd,
+             reinterpret_cast<const sockaddr *>(loopback.GetAddressStorage()),
+             loopback.GetAddressStorageSize()) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    // Determine the assigned port
+    sockaddr_storage storage{};
+    socklen_t storage_length = sizeof(storage);
+    getsockname(fd, reinterpret_cast<sockaddr *>(&storage), &storage_length);
+    address.AssignAddress(&storage, storage_length);
+
+    return fd;
+}
+
+} // namespace
+
+STF_TEST(TestSocketIO, SendToReceiveFrom)
+{
+    NetUtil::NetworkAddress sender_address;
+    NetUtil::NetworkAddress receiver_address;
+    NetUtil::NetworkAddress source_address;
+    int sender = CreateSocket(sender_address);
+    int receiver = CreateSocket(receiver_address);
+    NetUtil::DataBuffer send_buffer(64);
+    NetUtil::DataBuffer receive_buffer(64);
+    std::uint32_t value{};
+
+    STF_ASSERT_GE(sender, 0);
+    STF_ASSERT_GE(receiver, 0);
+
+    send_buffer << std::uint32_t(0x01020304) << std::uint16_t(0x0506);
+    send_buffer.AdvanceReadPosition(2);
+
+    // Only the unread data is sent
+    STF_ASSERT_EQ(4,
+                  NetUtil::SendTo(sender, send_buffer, receiver_address));
+    STF_ASSERT_EQ(0, send_buffer.GetUnreadLength());
+
+    receive_buffer << std::uint8_t(0xff);
+    STF_ASSERT_EQ(4,
+                  NetUtil::ReceiveFrom(receiver,
+                                       receive_buffer,
+                                       source_address));
+    STF_ASSERT_EQ(4, receive_buffer.GetDataLength());
+    STF_ASSERT_TRUE(source_address == sender_address);
+
+    receive_buffer >> value;
+    STF_ASSERT_EQ(0x03040506, value);
+
+    close(sender);
+    close(receiver);
+}
+
+STF_TEST(TestSocketIO, ReceiveFromTruncated)
+{
+    NetUtil::NetworkAddress sender_address;
+    NetUtil::NetworkAddress receiver_address;
+    NetUtil::NetworkAddress source_address;
+    int sender = CreateSocket(sender_address);
+    int receiver = CreateSocket(receiver_address);
+    NetUtil::DataBuffer send_buffer(64);
+    NetUtil::DataBuffer receive_buffer(2);
+
+    send_buffer << std::uint32_t(0x01020304);
+    STF_ASSERT_EQ(4,
+                  NetUtil::SendTo(sender, send_buffer, receiver_address));
+
+    STF_ASSERT_EQ(2,
+                  NetUtil::ReceiveFrom(receiver,
+                                       receive_buffer,
+                                       source_address));
+    STF_ASSERT_EQ(2, receive_buffer.GetDataLength());
+    STF_ASSERT_EQ(0x01, receive_buffer[0]);
+    STF_ASSERT_EQ(0x02, receive_buffer[1]);
+
+    close(sender);
+    close(receiver);
+}
+
+STF_TEST(TestSocketIO, BatchedDatagrams)
+{
+    NetUtil::NetworkAddress sender_address;
+    NetUtil::NetworkAddress receiver_address;
+    int sender = CreateSocket(sender_address);
+    int receiver = CreateSocket(receiver_address);
+    constexpr std::size_t Count = NetUtil::Socket_Batch_Size + 6;
+    std::vector<NetUtil::Datagram> outgoing(Count);
+    std::vector<NetUtil::Datagram> incoming(Count);
+    std::size_t received = 0;
+
+    STF_ASSERT_GE(sender, 0);
+    STF_ASSERT_GE(receiver, 0);
+
+    for (std::size_t i = 0; i < Count; i++)
+    {
+        outgoing[i].data_buffer = NetUtil::DataBuffer(16);
+        outgoing[i].data_buffer << static_cast<std::uint32_t>(i);
+        outgoing[i].address = receiver_address;
+        incoming[i].data_buffer = NetUtil::DataBuffer((i == 3) ? 2 : 16);
+    }
+
+    STF_ASSERT_EQ(static_cast<std::ptrdiff_t>(Count),
+                  NetUtil::SendTo(sender, outgoing));
+    for (const auto &datagram : outgoing)
+    {
+        STF_ASSERT_EQ(0, datagram.data_buffer.GetUnreadLength());
+    }
+
+    // Datagrams are received in batches of no more than the batch size
+    while (received < Count)
+    {
+        std::ptrdiff_t result =
+            NetUtil::ReceiveFrom(receiver,
+                                 std::span(incoming).subspan(received));
+
+        STF_ASSERT_GT(result, 0);
+        STF_ASSERT_LE(static_cast<std::size_t>(result),
+                      NetUtil::Socket_Batch_Size);
+        received += static_cast<std::size_t>(result);
+    }
+
+    for (std::size_t i = 0; i < Count; i++)
+    {
+        std::uint32_t value{};
+
+        STF_ASSERT_TRUE(incoming[i].address == sender_address);
+
+        if (i == 3)
+        {
+            STF_ASSERT_EQ(2, incoming[i].data_buffer.GetDataLength());
+#ifdef __linux__
+            STF_ASSERT_TRUE(incoming[i].truncated);
+#endif
+            continue;
+        }
+
+        STF_ASSERT_FALSE(incoming[i].truncated);
+        STF_ASSERT_EQ(4, incoming[i].data_buffer.GetDataLength());
+        incoming[i].data_buffer >> value;
+        STF_ASSERT_EQ(i, value);
+    }
+
+    close(sender);
+    close(receiver);
+}
+
+STF_TEST(TestSocketIO, StreamSendReceive)
+{
+    int sockets[2];
+    NetUtil::DataBuffer send_buffer(64);
+    NetUtil::DataBuffer receive_buffer(64);
+    std::uint16_t u16{};
+    std::uint32_t u32{};
+
+    STF_ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, sockets));
+
+    send_buffer << std::uint16_t(0x0102);
+    STF_ASSERT_EQ(2, NetUtil::Send(sockets[0], send_buffer));
+    STF_ASSERT_EQ(2, NetUtil::Receive(sockets[1], receive_buffer));
+
+    // Received data is appended following any existing data
+    send_buffer << std::uint32_t(0x03040506);
+    STF_ASSERT_EQ(4, NetUtil::Send(sockets[0], send_buffer));
+    STF_ASSERT_EQ(4, NetUtil::Receive(sockets[1], receive_buffer));
+
+    STF_ASSERT_EQ(6, receive_buffer.GetDataLength());
+    receive_buffer >> u16 >> u32;
+    STF_ASSERT_EQ(0x0102, u16);
+    STF_ASSERT_EQ(0x03040506, u32);
+
+    // A closed connection results in zero octets received
+    close(sockets[0]);
+    STF_ASSERT_EQ(0, NetUtil::Receive(sockets[1], receive_buffer));
+
+    close(sockets[1]);
+}
+
+STF_TEST(TestSocketIO, SegmentOffload)
+{
+    NetUtil::NetworkAddress sender_address;
+    NetUtil::NetworkAddress receiver_address;
+    NetUtil::NetworkAddress source_address;
+    int sender = CreateSocket(sender_address);
+    int receiver = CreateSocket(receiver_address);
+    NetUtil::DataBuffer send_buffer(1050);
+    NetUtil::DataBuffer receive_buffer(NetUtil::Segment_Offload_Length);
+    std::array<NetUtil::DataBuffer, 16> segments;
+    std::size_t received = 0;
+    std::size_t datagrams = 0;
+
+    STF_ASSERT_GE(sender, 0);
+    STF_ASSERT_GE(receiver, 0);
+
+#ifdef __linux__
+    STF_ASSERT_TRUE(NetUtil::EnableReceiveOffload(receiver));
+#else
+    NetUtil::EnableReceiveOffload(receiver);
+#endif
+
+    for (std::size_t i = 0; i < 1050; i++)
+    {
+        send_buffer.AppendValue(static_cast<std::uint8_t>(i / 100));
+    }
+
+    STF_ASSERT_EQ(1050,
+                  NetUtil::SendSegments(sender,
+                                        send_buffer,
+                                        100,
+                                        receiver_address));
+    STF_ASSERT_EQ(0, send_buffer.GetUnreadLength());
+
+    // Datagrams may or may not have been coalesced
+    while (received < 1050)
+    {
+        std::size_t segment_size{};
+
+        std::ptrdiff_t result = NetUtil::ReceiveSegments(receiver,
+                                                         receive_buffer,
+                                                         source_address,
+                                                         segment_size);
+        STF_ASSERT_GT(result, 0);
+        STF_ASSERT_TRUE(source_address == sender_address);
+        received += static_cast<std::size_t>(result);
+
+        std::size_t count = NetUtil::SplitSegments(receive_buffer,
+                                                   segment_size,
+                                                   segments);
+        STF_ASSERT_EQ(0, receive_buffer.GetUnreadLength());
+
+        for (std::size_t i = 0; i < count; i++, datagrams++)
+        {
+            STF_ASSERT_EQ((datagrams == 10) ? 50 : 100,
+                          segments[i].GetDataLength());
+            for (std::uint8_t octet : segments[i])
+            {
+                STF_ASSERT_EQ(datagrams, octet);
+            }
+        }
+    }
+
+    STF_ASSERT_EQ(1050, received);
+    STF_ASSERT_EQ(11, datagrams);
+
+    close(sender);
+    close(receiver);
+}
+
+STF_TEST(TestSocketIO, SendSegmentsSingle)
+{
+    NetUtil::NetworkAddress sender_address;
+    NetUtil::NetworkAddress receiver_address;
+    NetUtil::NetworkAddress source_address;
+    int sender = CreateSocket(sender_address);
+    int receiver = CreateSocket(receiver_address);
+    NetUtil::DataBuffer send_buffer(64);
+    NetUtil::DataBuffer receive_buffer(64);
+    std::size_t segment_size{};
+
+    // A segment size of zero sends all unread data as one datagram
+    send_buffer << std::uint32_t(0x01020304);
+    STF_ASSERT_EQ(4,
+                  NetUtil::SendSegments(sender,
+                                        send_buffer,
+                                        0,
+                                        receiver_address));
+
+    STF_ASSERT_EQ(4,
+                  NetUtil::ReceiveSegments(receiver,
+                                           receive_buffer,
+                                           source_address,
+                                           segment_size));
+    STF_ASSERT_EQ(4, segment_size);
+    STF_ASSERT_EQ(4, receive_buffer.GetDataLength());
+
+    close(sender);
+    close(receiver);
+}
+
+STF_TEST(TestSocketIO, SplitSegments)
+{
+    NetUtil::DataBuffer data_buffer(16);
+    std::array<NetUtil::DataBuffer, 2> segments;
+
+    for (std::uint8_t i = 0; i < 10; i++) data_buffer << i;
+
+    STF_ASSERT_EQ(2, NetUtil::SplitSegments(data_buffer, 4, segments));
+    STF_ASSERT_EQ(8, data_buffer.GetReadPosition());
+    STF_ASSERT_EQ(4, segments[0].GetDataLength());
+    STF_ASSERT_EQ(4, segments[1].GetDataLength());
+    STF_ASSERT_EQ(0, segments[0][0]);
+    STF_ASSERT_EQ(4, segments[1][0]);
+
+    // The views refer to the original buffer
+    STF_ASSERT_TRUE(segments[1].GetBufferPointer() ==
+                    data_buffer.GetBufferPointer(4));
+
+    // The remaining datagram is assigned by calling again
+    STF_ASSERT_EQ(1, NetUtil::SplitSegments(data_buffer, 4, segments));
+    STF_ASSERT_EQ(2, segments[0].GetDataLength());
+    STF_ASSERT_EQ(8, segments[0][0]);
+
+    STF_ASSERT_EQ(0, NetUtil::SplitSegments(data_buffer, 4, segments));
+}
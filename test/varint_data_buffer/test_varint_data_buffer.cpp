@@ -18,7 +18,9 @@
 #include <span>
 #include <cstdint>
 #include <sstream>
+#include <string_view>
 #include <limits>
+#include <vector>
 #include <terra/netutil/varint_data_buffer.h>
 #include <terra/stf/stf.h>
 
@@ -1022,3 +1024,225 @@ STF_TEST(TestDataBuffer, StreamingOperators)
     STF_ASSERT_EQ(original.v, output.v);
     STF_ASSERT_EQ(original.vi64, output.vi64);
 }
+
+STF_TEST(TestDataBuffer, GrowableAppend)
+{
+    NetUtil::VarIntDataBuffer data_buffer(1, true);
+
+    // Append values requiring more space than the initial buffer
+    data_buffer << NetUtil::VarUint64_t(0xffffffffffffffff)
+                << NetUtil::VarInt64_t(-65);
+
+    STF_ASSERT_EQ(12, data_buffer.GetDataLength());
+    STF_ASSERT_GE(data_buffer.GetBufferSize(), 12);
+
+    NetUtil::VarUint64_t value1;
+    NetUtil::VarInt64_t value2;
+
+    data_buffer >> value1 >> value2;
+
+    STF_ASSERT_EQ(0xffffffffffffffff, value1);
+    STF_ASSERT_EQ(-65, value2);
+}
+
+STF_TEST(TestDataBuffer, TryReadValueVarUint)
+{
+    NetUtil::VarIntDataBuffer data_buffer(16);
+    NetUtil::VarUint64_t value = 7;
+    NetUtil::VarUint16_t small_value = 7;
+    std::size_t length = 0;
+
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryAppendValue(NetUtil::VarUint64_t(0x1000)));
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryAppendValue(NetUtil::VarUint64_t(0x10000)));
+    STF_ASSERT_EQ(5, data_buffer.GetDataLength());
+
+    // The second value does not fit into a VarUint16_t
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryReadValue(small_value));
+    STF_ASSERT_EQ(0x1000, small_value);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::OutOfRange,
+                  data_buffer.TryReadValue(small_value));
+    STF_ASSERT_EQ(0x1000, small_value);
+    STF_ASSERT_EQ(2, data_buffer.GetReadPosition());
+
+    // Truncate the second value so it extends beyond the data length
+    data_buffer.SetDataLength(4);
+    data_buffer.SetReadPosition(2);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondDataLength,
+                  data_buffer.TryReadValue(value));
+    STF_ASSERT_EQ(7, value);
+    STF_ASSERT_EQ(2, data_buffer.GetReadPosition());
+
+    // The value is still within the buffer
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryGetValue(value, 2, length));
+    STF_ASSERT_EQ(0x10000, value);
+    STF_ASSERT_EQ(3, length);
+
+    // An offset at the end of the buffer has nothing to read
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondBuffer,
+                  data_buffer.TryGetValue(value, 16, length));
+    STF_ASSERT_EQ(3, length);
+}
+
+STF_TEST(TestDataBuffer, TryReadValueVarInt)
+{
+    NetUtil::VarIntDataBuffer data_buffer(16);
+    NetUtil::VarInt64_t value = 7;
+    NetUtil::VarInt16_t small_value = 7;
+    std::size_t length = 0;
+
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryAppendValue(NetUtil::VarInt64_t(-65)));
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryAppendValue(NetUtil::VarInt64_t(-40000)));
+
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryReadValue(small_value));
+    STF_ASSERT_EQ(-65, small_value);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::OutOfRange,
+                  data_buffer.TryReadValue(small_value));
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryReadValue(value));
+    STF_ASSERT_EQ(-40000, value);
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondDataLength,
+                  data_buffer.TryReadValue(value));
+    STF_ASSERT_EQ(-40000, value);
+
+    // A value longer than 10 octets is malformed
+    for (std::size_t i = 0; i < 11; i++) data_buffer[i] = 0xff;
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Malformed,
+                  data_buffer.TryGetValue(value, 0, length));
+    STF_ASSERT_EQ(0, length);
+}
+
+STF_TEST(TestDataBuffer, TryAppendValueVarUint)
+{
+    NetUtil::VarIntDataBuffer data_buffer(2);
+
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondBuffer,
+                  data_buffer.TryAppendValue(NetUtil::VarUint64_t(0x10000)));
+    STF_ASSERT_EQ(0, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryAppendValue(NetUtil::VarUint16_t(0x1000)));
+    STF_ASSERT_EQ(2, data_buffer.GetDataLength());
+}
+
+STF_TEST(TestDataBuffer, VarUintLengthFields)
+{
+    NetUtil::VarIntDataBuffer data_buffer(4, true);
+    NetUtil::VarUint64_t length;
+    std::uint16_t fixed_length{};
+    std::vector<std::uint8_t> body(200, 0x5a);
+
+    // The outer length is reserved as ten octets, the inner as three
+    std::size_t outer = data_buffer.BeginLength();
+    std::size_t inner = data_buffer.BeginLength<NetUtil::VarUint16_t>();
+    STF_ASSERT_EQ(13, data_buffer.GetDataLength());
+    data_buffer.AppendValue(body);
+
+    // The inner length of 200 requires two octets, so the body moves by one
+    STF_ASSERT_EQ(200, data_buffer.EndLength<NetUtil::VarUint16_t>(inner));
+    STF_ASSERT_EQ(212, data_buffer.GetDataLength());
+    std::size_t fixed = data_buffer.BeginLength<std::uint16_t>();
+    data_buffer.AppendValue(NetUtil::VarUint64_t(0));
+    STF_ASSERT_EQ(1, data_buffer.EndLength<std::uint16_t>(fixed));
+
+    // The outer length of 205 requires two octets, so it moves by eight
+    STF_ASSERT_EQ(205, data_buffer.EndLength(outer));
+    STF_ASSERT_EQ(207, data_buffer.GetDataLength());
+
+    data_buffer >> length;
+    STF_ASSERT_EQ(205, length);
+    data_buffer >> length;
+    STF_ASSERT_EQ(200, length);
+    for (std::size_t i = 0; i < body.size(); i++)
+    {
+        STF_ASSERT_EQ(0x5a, data_buffer[data_buffer.GetReadPosition() + i]);
+    }
+    data_buffer.AdvanceReadPosition(body.size());
+    data_buffer >> fixed_length;
+    STF_ASSERT_EQ(1, fixed_length);
+    data_buffer >> length;
+    STF_ASSERT_EQ(0, length);
+    STF_ASSERT_EQ(0, data_buffer.GetUnreadLength());
+
+    // An empty structure has a one-octet length
+    std::size_t empty = data_buffer.BeginLength<NetUtil::VarUint32_t>();
+    STF_ASSERT_EQ(0, data_buffer.EndLength<NetUtil::VarUint32_t>(empty));
+    STF_ASSERT_EQ(208, data_buffer.GetDataLength());
+    STF_ASSERT_EQ(0, data_buffer[207]);
+
+    // A length exceeding the maximum value of the type results in an
+    // exception, even though it could be encoded in the reserved octets
+    std::size_t too_long = data_buffer.BeginLength<NetUtil::VarUint16_t>();
+    data_buffer.AppendValue(std::vector<std::uint8_t>(65536));
+    auto test_func = [&]
+    {
+        data_buffer.EndLength<NetUtil::VarUint16_t>(too_long);
+    };
+    STF_ASSERT_EXCEPTION_E(test_func, NetUtil::DataBufferException);
+}
+
+STF_TEST(TestDataBuffer, ReadViews)
+{
+    NetUtil::VarIntDataBuffer data_buffer(256, true);
+    const std::string_view text = "example.com";
+    std::span<std::uint8_t> bytes;
+    std::string_view view;
+
+    // Write a string using a length field and another directly
+    std::size_t offset = data_buffer.BeginLength<NetUtil::VarUint16_t>();
+    data_buffer.AppendValue(std::span(text.data(), text.size()));
+    data_buffer.EndLength<NetUtil::VarUint16_t>(offset);
+    data_buffer.AppendValue(NetUtil::VarUint64_t(200));
+    data_buffer.AppendValue(std::vector<std::uint8_t>(200, 0x5a));
+    data_buffer.AppendValue(NetUtil::VarUint64_t(0));
+
+    // The views refer to the buffer rather than copying
+    view = data_buffer.ReadStringView();
+    STF_ASSERT_EQ(text, view);
+    STF_ASSERT_EQ(reinterpret_cast<const char *>(
+                      data_buffer.GetBufferPointer(1)),
+                  view.data());
+
+    bytes = data_buffer.ReadBytesView();
+    STF_ASSERT_EQ(200, bytes.size());
+    STF_ASSERT_EQ(data_buffer.GetBufferPointer(14), bytes.data());
+    STF_ASSERT_EQ(0x5a, bytes[199]);
+
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Success,
+                  data_buffer.TryReadStringView(view));
+    STF_ASSERT_TRUE(view.empty());
+    STF_ASSERT_EQ(0, data_buffer.GetUnreadLength());
+
+    // A string extending beyond the data length is not read
+    data_buffer.AppendValue(NetUtil::VarUint64_t(3));
+    data_buffer.AppendValue(std::uint16_t(0x4142));
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondDataLength,
+                  data_buffer.TryReadBytesView(bytes));
+    STF_ASSERT_EQ(200, bytes.size());
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::BeyondDataLength,
+                  data_buffer.TryReadStringView(view));
+    STF_ASSERT_TRUE(view.empty());
+    STF_ASSERT_EQ(215, data_buffer.GetReadPosition());
+
+    auto test_bytes = [&] { data_buffer.ReadBytesView(); };
+    auto test_string = [&] { data_buffer.ReadStringView(); };
+    STF_ASSERT_EXCEPTION_E(test_bytes, NetUtil::DataBufferException);
+    STF_ASSERT_EXCEPTION_E(test_string, NetUtil::DataBufferException);
+
+    data_buffer.AppendValue(std::uint8_t(0x43));
+    STF_ASSERT_EQ(std::string_view("ABC"), data_buffer.ReadStringView());
+
+    // A malformed length is reported
+    for (std::size_t i = 0; i < 11; i++)
+    {
+        data_buffer.AppendValue(std::uint8_t(0xff));
+    }
+    STF_ASSERT_EQ(NetUtil::DataBufferStatus::Malformed,
+                  data_buffer.TryReadBytesView(bytes));
+    STF_ASSERT_EQ(219, data_buffer.GetReadPosition());
+}